@@ -78,4 +78,35 @@ partial class UWorld
 
         return result as T;
     }
+
+    /// <summary>
+    /// Spawns actors with deferred construction, see ActorInteropUtils.SpawnActors.
+    /// Use ActorSpawnBatch to spread a large batch across frames.
+    /// </summary>
+    /// <param name="class">The class.</param>
+    /// <param name="transforms">The transforms.</param>
+    /// <param name="initializer">Invoked with each actor and its index before BeginPlay.</param>
+    /// <returns>AActor?[], null for actors failed to spawn.</returns>
+    public AActor?[] SpawnActors(UClass? @class, ReadOnlySpan<FTransform> transforms, Action<AActor, int>? initializer = null)
+    {
+        var result = new AActor?[transforms.Length];
+
+        ActorInteropUtils.SpawnActors(this, @class, transforms, result, initializer);
+
+        return result;
+    }
+
+    /// <summary>
+    /// Spawns actors with deferred construction.
+    /// </summary>
+    /// <typeparam name="T"></typeparam>
+    /// <param name="transforms">The transforms.</param>
+    /// <param name="initializer">Invoked with each actor and its index before BeginPlay.</param>
+    /// <returns>T?[].</returns>
+    public T?[] SpawnActors<T>(ReadOnlySpan<FTransform> transforms, Action<T, int>? initializer = null) where T : AActor
+    {
+        var actors = SpawnActors(UClass.GetClassOf<T>(), transforms, initializer != null ? (actor, index) => initializer((T)actor, index) : null);
+
+        return Array.ConvertAll(actors, actor => actor as T);
+    }
 }
\ No newline at end of file
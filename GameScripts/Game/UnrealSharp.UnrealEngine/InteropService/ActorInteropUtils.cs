@@ -23,6 +23,7 @@
 
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
+using System.Buffers;
 using UnrealSharp.Utils.Misc;
 // ReSharper disable MemberHidesStaticFromOuterClass
 
@@ -37,30 +38,17 @@ public static unsafe class ActorInteropUtils
         
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]            
-        public static readonly IntPtr GetActorWorld;            
-        public static readonly IntPtr GetActorGameInstance;            
-        public static readonly IntPtr SpawnActorByTransform;
-        public static readonly IntPtr SpawnActor;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr GetActorWorld = InteropFunctions.FunctionTable->GetActorWorld;
+        public static readonly IntPtr GetActorGameInstance = InteropFunctions.FunctionTable->GetActorGameInstance;
+        public static readonly IntPtr SpawnActorByTransform = InteropFunctions.FunctionTable->SpawnActorByTransform;
+        public static readonly IntPtr SpawnActor = InteropFunctions.FunctionTable->SpawnActor;
+        public static readonly IntPtr SpawnActorsDeferred = InteropFunctions.FunctionTable->SpawnActorsDeferred;
+        public static readonly IntPtr FinishSpawningActors = InteropFunctions.FunctionTable->FinishSpawningActors;
     }
     #endregion
 
@@ -145,4 +133,87 @@ public static unsafe class ActorInteropUtils
 
         return ObjectInteropUtils.MarshalObject<AActor>(value);
     }
+
+    /// <summary>
+    /// Spawns actors of a class with deferred construction.
+    /// All actors are constructed in one interop call, then initializer is invoked for each actor before it is spawned,
+    /// at last all actors finish spawning in one interop call.
+    /// </summary>
+    /// <param name="world">The world.</param>
+    /// <param name="class">The class.</param>
+    /// <param name="transforms">The transforms, one actor for each.</param>
+    /// <param name="outActors">The spawned actors, null if failed to spawn, must be as long as transforms.</param>
+    /// <param name="initializer">Invoked with each actor and its index before BeginPlay, can be null.</param>
+    /// <returns>count of spawned actors.</returns>
+    public static int SpawnActors(UWorld world, UClass? @class, ReadOnlySpan<FTransform> transforms, Span<AActor?> outActors, Action<AActor, int>? initializer = null)
+    {
+        return SpawnActors(world, @class, transforms, outActors, initializer, 0);
+    }
+
+    /// <summary>
+    /// Spawns actors of a class with deferred construction.
+    /// </summary>
+    /// <param name="world">The world.</param>
+    /// <param name="class">The class.</param>
+    /// <param name="transforms">The transforms.</param>
+    /// <param name="outActors">The spawned actors.</param>
+    /// <param name="initializer">The initializer.</param>
+    /// <param name="baseIndex">Added to the index passed to initializer.</param>
+    /// <returns>count of spawned actors.</returns>
+    internal static int SpawnActors(UWorld world, UClass? @class, ReadOnlySpan<FTransform> transforms, Span<AActor?> outActors, Action<AActor, int>? initializer, int baseIndex)
+    {
+        if (!world.IsBindingToUnreal || transforms.IsEmpty)
+        {
+            return 0;
+        }
+
+        Logger.EnsureNotNull(@class);
+        Logger.Assert(outActors.Length >= transforms.Length);
+
+        var count = transforms.Length;
+        var nativeActors = ArrayPool<IntPtr>.Shared.Rent(count);
+
+        try
+        {
+            fixed (FTransform* transformsPtr = transforms)
+            fixed (IntPtr* nativeActorsPtr = nativeActors)
+            {
+                var spawnedCount = ((delegate* unmanaged[Cdecl]<IntPtr, IntPtr, FTransform*, int, int, IntPtr*, int>)InteropFunctionPointers.SpawnActorsDeferred)(
+                    world.GetNativePtr(), 
+                    @class.GetNativePtr(), 
+                    transformsPtr, 
+                    sizeof(FTransform), 
+                    count, 
+                    nativeActorsPtr
+                    );
+
+                try
+                {
+                    for (var i = 0; i < count; ++i)
+                    {
+                        // proxies are created by SpawnActorsDeferred, they are found without interop calls
+                        var actor = ObjectInteropUtils.GetCSharpObjectOfUnrealObject(nativeActors[i]) as AActor;
+
+                        outActors[i] = actor;
+
+                        if (actor != null)
+                        {
+                            initializer?.Invoke(actor, baseIndex + i);
+                        }
+                    }
+                }
+                finally
+                {
+                    // never leave actors half spawned
+                    ((delegate* unmanaged[Cdecl]<IntPtr*, FTransform*, int, int, void>)InteropFunctionPointers.FinishSpawningActors)(nativeActorsPtr, transformsPtr, sizeof(FTransform), count);
+                }
+
+                return spawnedCount;
+            }
+        }
+        finally
+        {
+            ArrayPool<IntPtr>.Shared.Return(nativeActors);
+        }
+    }
 }
\ No newline at end of file
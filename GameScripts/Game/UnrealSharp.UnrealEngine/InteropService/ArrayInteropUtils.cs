@@ -34,54 +34,39 @@ public static unsafe class ArrayInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The get element property of array
         /// </summary>
-        public static readonly IntPtr GetElementPropertyOfArray;
+        public static readonly IntPtr GetElementPropertyOfArray = InteropFunctions.FunctionTable->GetElementPropertyOfArray;
         /// <summary>
         /// The get length of array
         /// </summary>
-        public static readonly IntPtr GetLengthOfArray;
+        public static readonly IntPtr GetLengthOfArray = InteropFunctions.FunctionTable->GetLengthOfArray;
         /// <summary>
         /// The get element address of array
         /// </summary>
-        public static readonly IntPtr GetElementAddressOfArray;
+        public static readonly IntPtr GetElementAddressOfArray = InteropFunctions.FunctionTable->GetElementAddressOfArray;
         /// <summary>
         /// The clear array
         /// </summary>
-        public static readonly IntPtr ClearArray;
+        public static readonly IntPtr ClearArray = InteropFunctions.FunctionTable->ClearArray;
         /// <summary>
         /// The remove at array index
         /// </summary>
-        public static readonly IntPtr RemoveAtArrayIndex;
+        public static readonly IntPtr RemoveAtArrayIndex = InteropFunctions.FunctionTable->RemoveAtArrayIndex;
         /// <summary>
         /// The insert empty at array index
         /// </summary>
-        public static readonly IntPtr InsertEmptyAtArrayIndex;
+        public static readonly IntPtr InsertEmptyAtArrayIndex = InteropFunctions.FunctionTable->InsertEmptyAtArrayIndex;
         /// <summary>
         /// The find index of array element
         /// </summary>
-        public static readonly IntPtr FindIndexOfArrayElement;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr FindIndexOfArrayElement = InteropFunctions.FunctionTable->FindIndexOfArrayElement;
     }
     #endregion
 
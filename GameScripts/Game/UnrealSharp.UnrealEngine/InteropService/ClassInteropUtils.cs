@@ -23,6 +23,7 @@
 
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
+using System.Runtime.InteropServices;
 using UnrealSharp.Utils.UnrealEngine;
 // ReSharper disable MemberHidesStaticFromOuterClass
 
@@ -36,75 +37,72 @@ public static unsafe class ClassInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The get c sharp default object of class
         /// </summary>
-        public static readonly IntPtr GetDefaultObjectOfClass;
+        public static readonly IntPtr GetDefaultObjectOfClass = InteropFunctions.FunctionTable->GetDefaultObjectOfClass;
         /// <summary>
         /// The get class pointer of unreal object
         /// </summary>
-        public static readonly IntPtr GetClassPointerOfUnrealObject;
+        public static readonly IntPtr GetClassPointerOfUnrealObject = InteropFunctions.FunctionTable->GetClassPointerOfUnrealObject;
         /// <summary>
         /// The load unreal field
         /// </summary>
-        public static readonly IntPtr LoadUnrealField;
+        public static readonly IntPtr LoadUnrealField = InteropFunctions.FunctionTable->LoadUnrealField;
+        /// <summary>
+        /// The load unreal fields
+        /// </summary>
+        public static readonly IntPtr LoadUnrealFields = InteropFunctions.FunctionTable->LoadUnrealFields;
         /// <summary>
         /// The check u class is child of
         /// </summary>
-        public static readonly IntPtr CheckUClassIsChildOf;
+        public static readonly IntPtr CheckUClassIsChildOf = InteropFunctions.FunctionTable->CheckUClassIsChildOf;
         /// <summary>
         /// The get super class
         /// </summary>
-        public static readonly IntPtr GetSuperClass;
+        public static readonly IntPtr GetSuperClass = InteropFunctions.FunctionTable->GetSuperClass;
         /// <summary>
         /// The get property
         /// </summary>
-        public static readonly IntPtr GetProperty;
+        public static readonly IntPtr GetProperty = InteropFunctions.FunctionTable->GetProperty;
+        /// <summary>
+        /// The get property meta caches
+        /// </summary>
+        public static readonly IntPtr GetPropertyMetaCaches = InteropFunctions.FunctionTable->GetPropertyMetaCaches;
+        /// <summary>
+        /// The load struct property meta caches
+        /// </summary>
+        public static readonly IntPtr LoadStructPropertyMetaCaches = InteropFunctions.FunctionTable->LoadStructPropertyMetaCaches;
         /// <summary>
         /// The get function
         /// </summary>
-        public static readonly IntPtr GetFunction;
+        public static readonly IntPtr GetFunction = InteropFunctions.FunctionTable->GetFunction;
         /// <summary>
         /// The get structure size
         /// </summary>
-        public static readonly IntPtr GetStructSize;
+        public static readonly IntPtr GetStructSize = InteropFunctions.FunctionTable->GetStructSize;
         /// <summary>
         /// The initialize structure
         /// </summary>
-        public static readonly IntPtr InitializeStructData;
+        public static readonly IntPtr InitializeStructData = InteropFunctions.FunctionTable->InitializeStructData;
         /// <summary>
         /// The uninitialize structure
         /// </summary>
-        public static readonly IntPtr UninitializeStructData;
+        public static readonly IntPtr UninitializeStructData = InteropFunctions.FunctionTable->UninitializeStructData;
         /// <summary>
         /// The get field c sharp full path
         /// </summary>
-        public static readonly IntPtr GetFieldCSharpFullPath;
+        public static readonly IntPtr GetFieldCSharpFullPath = InteropFunctions.FunctionTable->GetFieldCSharpFullPath;
 
         /// <summary>
         /// The get class flags
         /// </summary>
-        public static readonly IntPtr GetClassFlags;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr GetClassFlags = InteropFunctions.FunctionTable->GetClassFlags;
     }
     #endregion
 
@@ -141,6 +139,37 @@ public static unsafe class ClassInteropUtils
         return ((delegate* unmanaged[Cdecl]<string, IntPtr>)InteropFunctionPointers.LoadUnrealField)(fieldPath);
     }
 
+    /// <summary>
+    /// Loads many unreal fields with one interop call, fields in the same package are resolved together.
+    /// </summary>
+    /// <param name="fieldPaths">The field paths, separated by ';'.</param>
+    /// <param name="fields">The fields, receive the UField pointer of each path or IntPtr.Zero.</param>
+    /// <returns>The count of fields found.</returns>
+    public static int LoadUnrealFields(string fieldPaths, Span<IntPtr> fields)
+    {
+        fixed (IntPtr* fieldsPtr = fields)
+        {
+            return ((delegate* unmanaged[Cdecl]<string, IntPtr*, int, int>)InteropFunctionPointers.LoadUnrealFields)(fieldPaths, fieldsPtr, fields.Length);
+        }
+    }
+
+    /// <summary>
+    /// Loads many unreal fields with one interop call.
+    /// </summary>
+    /// <param name="fieldPaths">The field paths.</param>
+    /// <returns>The UField pointers, IntPtr.Zero for the fields not found.</returns>
+    public static IntPtr[] LoadUnrealFields(IReadOnlyList<string> fieldPaths)
+    {
+        var fields = new IntPtr[fieldPaths.Count];
+
+        if (fields.Length > 0)
+        {
+            LoadUnrealFields(string.Join(';', fieldPaths), fields);
+        }
+
+        return fields;
+    }
+
     /// <summary>
     /// Check UClass is child of the base UClass
     /// </summary>
@@ -173,6 +202,59 @@ public static unsafe class ClassInteropUtils
         return ((delegate* unmanaged[Cdecl]<IntPtr, string, IntPtr>)InteropFunctionPointers.GetProperty)(structPtr, propertyName);
     }
 
+    /// <summary>
+    /// Struct FPropertyMetaCache
+    /// Sync with C++
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FPropertyMetaCache
+    {
+        /// <summary>
+        /// The property pointer
+        /// </summary>
+        public IntPtr PropertyPointer;
+
+        /// <summary>
+        /// The offset
+        /// </summary>
+        public int Offset;
+
+        /// <summary>
+        /// The size
+        /// </summary>
+        public int Size;
+    }
+
+    /// <summary>
+    /// Gets the property pointers, offsets and sizes of many properties of a UStruct with one interop call.
+    /// </summary>
+    /// <param name="structPtr">The structure PTR.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    /// <param name="metaCaches">The meta caches, receive the result of each property.</param>
+    /// <returns>The count of properties found.</returns>
+    public static int GetPropertyMetaCaches(IntPtr structPtr, string propertyNames, Span<FPropertyMetaCache> metaCaches)
+    {
+        fixed (FPropertyMetaCache* metaCachesPtr = metaCaches)
+        {
+            return ((delegate* unmanaged[Cdecl]<IntPtr, string, FPropertyMetaCache*, int, int>)InteropFunctionPointers.GetPropertyMetaCaches)(structPtr, propertyNames, metaCachesPtr, metaCaches.Length);
+        }
+    }
+
+    /// <summary>
+    /// Loads a UStruct and gets the property pointers, offsets and sizes of many properties of it with one interop call.
+    /// </summary>
+    /// <param name="structPath">The structure path.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    /// <param name="metaCaches">The meta caches, receive the result of each property.</param>
+    /// <returns>nint. it is UStruct pointer, metaCaches is not filled if it is IntPtr.Zero</returns>
+    public static IntPtr LoadStructPropertyMetaCaches(string structPath, string propertyNames, Span<FPropertyMetaCache> metaCaches)
+    {
+        fixed (FPropertyMetaCache* metaCachesPtr = metaCaches)
+        {
+            return ((delegate* unmanaged[Cdecl]<string, string, FPropertyMetaCache*, int, IntPtr>)InteropFunctionPointers.LoadStructPropertyMetaCaches)(structPath, propertyNames, metaCachesPtr, metaCaches.Length);
+        }
+    }
+
     /// <summary>
     /// Gets UFunction Pointer of a UClass.
     /// </summary>
@@ -34,50 +34,35 @@ public static unsafe class DelegateInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The bind delegate
         /// </summary>
-        public static readonly IntPtr BindDelegate;
+        public static readonly IntPtr BindDelegate = InteropFunctions.FunctionTable->BindDelegate;
         /// <summary>
         /// The unbind delegate
         /// </summary>
-        public static readonly IntPtr UnbindDelegate;
+        public static readonly IntPtr UnbindDelegate = InteropFunctions.FunctionTable->UnbindDelegate;
         /// <summary>
         /// The add delegate
         /// </summary>
-        public static readonly IntPtr AddDelegate;
+        public static readonly IntPtr AddDelegate = InteropFunctions.FunctionTable->AddDelegate;
         /// <summary>
         /// The remove delegate
         /// </summary>
-        public static readonly IntPtr RemoveDelegate;
+        public static readonly IntPtr RemoveDelegate = InteropFunctions.FunctionTable->RemoveDelegate;
         /// <summary>
         /// The remove all delegate
         /// </summary>
-        public static readonly IntPtr RemoveAllDelegate;
+        public static readonly IntPtr RemoveAllDelegate = InteropFunctions.FunctionTable->RemoveAllDelegate;
         /// <summary>
         /// The clear delegate
         /// </summary>
-        public static readonly IntPtr ClearDelegate;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr ClearDelegate = InteropFunctions.FunctionTable->ClearDelegate;
     }
     #endregion
 
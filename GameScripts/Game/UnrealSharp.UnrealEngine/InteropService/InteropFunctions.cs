@@ -46,6 +46,9 @@ public static unsafe class InteropFunctions
     {
         var interopInfo = UnrealSharpEntry.InteropFunctionInfo;
         NativeInstance = new IntPtr(interopInfo.NativeInteropFunctionsPtr);
+        FunctionTable = interopInfo.FunctionTable;
+
+        Logger.Ensure<Exception>(FunctionTable != null, "Failed bind interop function table");
 
         Logger.Ensure<Exception>(interopInfo.GetUnrealInteropFunctionPointerFunc != null, "Failed bind Main interop function : GetUnrealInteropFunctionPointer");
                         
@@ -55,6 +58,12 @@ public static unsafe class InteropFunctions
         Logger.Ensure<Exception>(ValidateUnrealSharpBuildInfo != null, "Failed find interop function:ValidateUnrealSharpBuildInfo");
     }
 
+    /// <summary>
+    /// The built-in interop function table
+    /// all built-in interop functions are read from this table by fixed offsets.
+    /// </summary>
+    public static readonly FUnrealInteropFunctionTable* FunctionTable;
+
     #region Internal Methods
 
     /// <summary>
@@ -71,6 +80,7 @@ public static unsafe class InteropFunctions
     #region Binding Help Utils
     /// <summary>
     /// Binds the interop function pointers.
+    /// bind functions registered at runtime by name, built-in functions should be read from FunctionTable.
     /// </summary>
     /// <param name="type">The type.</param>
     public static void BindInteropFunctionPointers([DynamicallyAccessedMembers(DynamicallyAccessedMemberTypes.PublicFields|DynamicallyAccessedMemberTypes.NonPublicFields)]Type type)
@@ -34,58 +34,43 @@ public static unsafe class InvocationInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// create unreal invocation
         /// </summary>
-        public static readonly IntPtr CreateUnrealInvocation;
+        public static readonly IntPtr CreateUnrealInvocation = InteropFunctions.FunctionTable->CreateUnrealInvocation;
         /// <summary>
         /// create unreal invocation from delegate property
         /// </summary>
-        public static readonly IntPtr CreateUnrealInvocationFromDelegateProperty;
+        public static readonly IntPtr CreateUnrealInvocationFromDelegateProperty = InteropFunctions.FunctionTable->CreateUnrealInvocationFromDelegateProperty;
         /// <summary>
         /// The destroy unreal invocation
         /// </summary>
-        public static readonly IntPtr DestroyUnrealInvocation;
+        public static readonly IntPtr DestroyUnrealInvocation = InteropFunctions.FunctionTable->DestroyUnrealInvocation;
         /// <summary>
         /// The invoke unreal invocation
         /// </summary>
-        public static readonly IntPtr InvokeUnrealInvocation;
+        public static readonly IntPtr InvokeUnrealInvocation = InteropFunctions.FunctionTable->InvokeUnrealInvocation;
         /// <summary>
         /// The get unreal invocation function
         /// </summary>
-        public static readonly IntPtr GetUnrealInvocationFunction;
+        public static readonly IntPtr GetUnrealInvocationFunction = InteropFunctions.FunctionTable->GetUnrealInvocationFunction;
         /// <summary>
         /// The get unreal invocation parameter size
         /// </summary>
-        public static readonly IntPtr GetUnrealInvocationParameterSize;
+        public static readonly IntPtr GetUnrealInvocationParameterSize = InteropFunctions.FunctionTable->GetUnrealInvocationParameterSize;
         /// <summary>
         /// The initialize unreal invocation parameters
         /// </summary>
-        public static readonly IntPtr InitializeUnrealInvocationParameters;
+        public static readonly IntPtr InitializeUnrealInvocationParameters = InteropFunctions.FunctionTable->InitializeUnrealInvocationParameters;
         /// <summary>
         /// The un initialize unreal invocation parameters
         /// </summary>
-        public static readonly IntPtr UnInitializeUnrealInvocationParameters;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr UnInitializeUnrealInvocationParameters = InteropFunctions.FunctionTable->UnInitializeUnrealInvocationParameters;
     }
     #endregion
 
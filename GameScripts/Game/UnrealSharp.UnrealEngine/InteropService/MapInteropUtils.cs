@@ -36,66 +36,51 @@ public static unsafe class MapInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The get key property of map
         /// </summary>
-        public static readonly IntPtr GetKeyPropertyOfMap;
+        public static readonly IntPtr GetKeyPropertyOfMap = InteropFunctions.FunctionTable->GetKeyPropertyOfMap;
         /// <summary>
         /// The get value property of map
         /// </summary>
-        public static readonly IntPtr GetValuePropertyOfMap;
+        public static readonly IntPtr GetValuePropertyOfMap = InteropFunctions.FunctionTable->GetValuePropertyOfMap;
         /// <summary>
         /// The get length of map
         /// </summary>
-        public static readonly IntPtr GetLengthOfMap;
+        public static readonly IntPtr GetLengthOfMap = InteropFunctions.FunctionTable->GetLengthOfMap;
         /// <summary>
         /// The clear map
         /// </summary>
-        public static readonly IntPtr ClearMap;
+        public static readonly IntPtr ClearMap = InteropFunctions.FunctionTable->ClearMap;
         /// <summary>
         /// The get key address of map element
         /// </summary>
-        public static readonly IntPtr GetKeyAddressOfMapElement;
+        public static readonly IntPtr GetKeyAddressOfMapElement = InteropFunctions.FunctionTable->GetKeyAddressOfMapElement;
         /// <summary>
         /// The get value address of map element
         /// </summary>
-        public static readonly IntPtr GetValueAddressOfMapElement;
+        public static readonly IntPtr GetValueAddressOfMapElement = InteropFunctions.FunctionTable->GetValueAddressOfMapElement;
         /// <summary>
         /// The get address of map element
         /// </summary>
-        public static readonly IntPtr GetAddressOfMapElement;
+        public static readonly IntPtr GetAddressOfMapElement = InteropFunctions.FunctionTable->GetAddressOfMapElement;
         /// <summary>
         /// The find value address of element key
         /// </summary>
-        public static readonly IntPtr FindValueAddressOfElementKey;
+        public static readonly IntPtr FindValueAddressOfElementKey = InteropFunctions.FunctionTable->FindValueAddressOfElementKey;
         /// <summary>
         /// The try add new element to map
         /// </summary>
-        public static readonly IntPtr TryAddNewElementToMap;
+        public static readonly IntPtr TryAddNewElementToMap = InteropFunctions.FunctionTable->TryAddNewElementToMap;
         /// <summary>
         /// The remove element from map
         /// </summary>
-        public static readonly IntPtr RemoveElementFromMap;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr RemoveElementFromMap = InteropFunctions.FunctionTable->RemoveElementFromMap;
     }
     #endregion
 
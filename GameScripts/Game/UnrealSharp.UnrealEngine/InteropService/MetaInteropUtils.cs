@@ -158,6 +158,147 @@ public static class MetaInteropUtils
         BindPropertyMetaCache(type, invocation.GetFunction());
     }
 
+    #region Property Meta Caches
+    /// <summary>
+    /// Loads the property meta caches of a UStruct.
+    /// Unlike BindPropertyMetaCache, all properties are queried by one interop call, 
+    /// and the generated code assigns the results to its meta fields directly without reflection.
+    /// </summary>
+    /// <param name="structPtr">The structure PTR.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    /// <param name="propertyCount">The property count.</param>
+    /// <returns>The meta caches, in the same order as property names.</returns>
+    public static ClassInteropUtils.FPropertyMetaCache[] LoadPropertyMetaCaches(IntPtr structPtr, string propertyNames, int propertyCount)
+    {
+        if (propertyCount <= 0)
+        {
+            return [];
+        }
+
+        var metaCaches = new ClassInteropUtils.FPropertyMetaCache[propertyCount];
+
+        ClassInteropUtils.GetPropertyMetaCaches(structPtr, propertyNames, metaCaches);
+
+        EnsurePropertyMetaCaches(metaCaches, propertyNames);
+
+        return metaCaches;
+    }
+
+    /// <summary>
+    /// Ensures all properties are found and their offsets are valid.
+    /// </summary>
+    /// <param name="metaCaches">The meta caches.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    private static void EnsurePropertyMetaCaches(ClassInteropUtils.FPropertyMetaCache[] metaCaches, string propertyNames)
+    {
+        if (metaCaches.Any(x => x.PropertyPointer == IntPtr.Zero))
+        {
+            var names = propertyNames.Split(';');
+
+            for (var i = 0; i < metaCaches.Length; ++i)
+            {
+                Logger.Ensure<AccessViolationException>(metaCaches[i].PropertyPointer != IntPtr.Zero, "Failed find property {0}", i < names.Length ? names[i] : i.ToString());
+            }
+        }
+
+        foreach (var metaCache in metaCaches)
+        {
+            Logger.Ensure<ArgumentException>(metaCache.Offset < short.MaxValue);
+            Logger.Ensure<ArgumentException>(metaCache.Offset != -1);
+        }
+    }
+
+    /// <summary>
+    /// Loads the structure property meta caches.
+    /// The UStruct and its properties are loaded by one interop call.
+    /// </summary>
+    /// <param name="structPath">The structure path.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    /// <param name="propertyCount">The property count.</param>
+    /// <returns>The meta caches, in the same order as property names.</returns>
+    public static ClassInteropUtils.FPropertyMetaCache[] LoadStructPropertyMetaCaches(string structPath, string propertyNames, int propertyCount)
+    {
+        return LoadStructPropertyMetaCaches(structPath, propertyNames, propertyCount, out _);
+    }
+
+    /// <summary>
+    /// Loads the class property meta caches.
+    /// The UClass is loaded with its properties by one interop call if it is not loaded yet.
+    /// </summary>
+    /// <param name="classObject">The class object.</param>
+    /// <param name="classPath">The class path.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    /// <param name="propertyCount">The property count.</param>
+    /// <returns>The meta caches, in the same order as property names.</returns>
+    public static ClassInteropUtils.FPropertyMetaCache[] LoadClassPropertyMetaCaches([NotNull] ref UClass? classObject, string classPath, string propertyNames, int propertyCount)
+    {
+        if (classObject != null)
+        {
+            return LoadPropertyMetaCaches(classObject.GetNativePtr(), propertyNames, propertyCount);
+        }
+
+        var metaCaches = LoadStructPropertyMetaCaches(classPath, propertyNames, propertyCount, out var classNativePtr);
+
+        classObject = new UClass(classNativePtr);
+
+        return metaCaches;
+    }
+
+    /// <summary>
+    /// Loads the structure and its property meta caches.
+    /// </summary>
+    /// <param name="structPath">The structure path.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    /// <param name="propertyCount">The property count.</param>
+    /// <param name="structPtr">The structure PTR.</param>
+    /// <returns>The meta caches, in the same order as property names.</returns>
+    private static ClassInteropUtils.FPropertyMetaCache[] LoadStructPropertyMetaCaches(string structPath, string propertyNames, int propertyCount, out IntPtr structPtr)
+    {
+        var metaCaches = new ClassInteropUtils.FPropertyMetaCache[Math.Max(propertyCount, 0)];
+
+        structPtr = ClassInteropUtils.LoadStructPropertyMetaCaches(structPath, propertyNames, metaCaches);
+
+        Logger.Ensure<AccessViolationException>(structPtr != IntPtr.Zero, "Failed load UStruct:{0}", structPath);
+
+        EnsurePropertyMetaCaches(metaCaches, propertyNames);
+
+        return metaCaches;
+    }
+
+    /// <summary>
+    /// Loads the function property meta caches.
+    /// </summary>
+    /// <param name="classPtr">The class PTR.</param>
+    /// <param name="functionName">Name of the function.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    /// <param name="propertyCount">The property count.</param>
+    /// <returns>The meta caches, in the same order as property names.</returns>
+    public static ClassInteropUtils.FPropertyMetaCache[] LoadFunctionPropertyMetaCaches(UClass classPtr, string functionName, string propertyNames, int propertyCount)
+    {
+        var functionPtr = classPtr.FindFunction(functionName);
+
+        Logger.Ensure<Exception>(functionPtr != IntPtr.Zero, "Failed find function:{0}", functionName);
+
+        return LoadPropertyMetaCaches(functionPtr, propertyNames, propertyCount);
+    }
+
+    /// <summary>
+    /// Loads the function and its property meta caches.
+    /// </summary>
+    /// <param name="invocation">The invocation.</param>
+    /// <param name="class">The class.</param>
+    /// <param name="methodName">Name of the method.</param>
+    /// <param name="propertyNames">The property names, separated by ';'.</param>
+    /// <param name="propertyCount">The property count.</param>
+    /// <returns>The meta caches, in the same order as property names.</returns>
+    public static ClassInteropUtils.FPropertyMetaCache[] LoadFunctionMetaCaches([NotNull] ref UnrealInvocation? invocation, UClass @class, string methodName, string propertyNames, int propertyCount)
+    {
+        LoadFunctionIfNeed(ref invocation, @class, methodName);
+
+        return LoadPropertyMetaCaches(invocation.GetFunction(), propertyNames, propertyCount);
+    }
+    #endregion
+
     #region Fast Access Struct Helpers
 
     /// <summary>
@@ -33,59 +33,44 @@ public static unsafe class ObjectInitializerInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The get class of object initializer
         /// </summary>
-        public static readonly IntPtr GetClassOfObjectInitializer;
+        public static readonly IntPtr GetClassOfObjectInitializer = InteropFunctions.FunctionTable->GetClassOfObjectInitializer;
         /// <summary>
         /// The get object of object initializer
         /// </summary>
-        public static readonly IntPtr GetObjectOfObjectInitializer;
+        public static readonly IntPtr GetObjectOfObjectInitializer = InteropFunctions.FunctionTable->GetObjectOfObjectInitializer;
         /// <summary>
         /// create default subobject of object initializer
         /// </summary>
-        public static readonly IntPtr CreateDefaultSubobjectOfObjectInitializer;
+        public static readonly IntPtr CreateDefaultSubobjectOfObjectInitializer = InteropFunctions.FunctionTable->CreateDefaultSubobjectOfObjectInitializer;
         /// <summary>
         /// create editor only default subobject of object initializer
         /// </summary>
-        public static readonly IntPtr CreateEditorOnlyDefaultSubobjectOfObjectInitializer;
+        public static readonly IntPtr CreateEditorOnlyDefaultSubobjectOfObjectInitializer = InteropFunctions.FunctionTable->CreateEditorOnlyDefaultSubobjectOfObjectInitializer;
         /// <summary>
         /// The set default subobject class of object initializer
         /// </summary>
-        public static readonly IntPtr SetDefaultSubobjectClassOfObjectInitializer;
+        public static readonly IntPtr SetDefaultSubobjectClassOfObjectInitializer = InteropFunctions.FunctionTable->SetDefaultSubobjectClassOfObjectInitializer;
         /// <summary>
         /// do not create default subobject of object initializer
         /// </summary>
-        public static readonly IntPtr DoNotCreateDefaultSubobjectOfObjectInitializer;
+        public static readonly IntPtr DoNotCreateDefaultSubobjectOfObjectInitializer = InteropFunctions.FunctionTable->DoNotCreateDefaultSubobjectOfObjectInitializer;
         /// <summary>
         /// The set nested default subobject class of object initializer
         /// </summary>
-        public static readonly IntPtr SetNestedDefaultSubobjectClassOfObjectInitializer;
+        public static readonly IntPtr SetNestedDefaultSubobjectClassOfObjectInitializer = InteropFunctions.FunctionTable->SetNestedDefaultSubobjectClassOfObjectInitializer;
         /// <summary>
         /// do not create nested default subobject of object initializer
         /// </summary>
-        public static readonly IntPtr DoNotCreateNestedDefaultSubobjectOfObjectInitializer;
+        public static readonly IntPtr DoNotCreateNestedDefaultSubobjectOfObjectInitializer = InteropFunctions.FunctionTable->DoNotCreateNestedDefaultSubobjectOfObjectInitializer;
 
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
     }
     #endregion
 
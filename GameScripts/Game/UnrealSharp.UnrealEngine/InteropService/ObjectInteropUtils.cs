@@ -44,6 +44,32 @@ public struct FCSharpObjectMarshalValue
     public object? Value;
 }
 
+/// <summary>
+/// Struct FCSharpObjectHandleSlotTable
+/// GC handles of C# proxy objects indexed by the GUObjectArray index of their UObject, owned by C++.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+// ReSharper disable once InconsistentNaming
+public unsafe struct FCSharpObjectHandleSlotTable
+{
+    /// <summary>
+    /// The chunks, a chunk is null if no object in its range has a proxy
+    /// </summary>
+    public IntPtr** Chunks;
+    /// <summary>
+    /// The number of chunks
+    /// </summary>
+    public int NumChunks;
+    /// <summary>
+    /// The chunk shift
+    /// </summary>
+    public int ChunkShift;
+    /// <summary>
+    /// The offset of the GUObjectArray index in UObject, -1 if the table can't be used
+    /// </summary>
+    public int InternalIndexOffset;
+}
+
 /// <summary>
 /// Class ObjectInteropUtils.
 /// </summary>
@@ -52,118 +78,113 @@ public static unsafe class ObjectInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The get default unreal object of class
         /// </summary>
-        public static readonly IntPtr GetDefaultUnrealObjectOfClass;
+        public static readonly IntPtr GetDefaultUnrealObjectOfClass = InteropFunctions.FunctionTable->GetDefaultUnrealObjectOfClass;
         /// <summary>
         /// The get c sharp object of unreal object
         /// </summary>
-        public static readonly IntPtr GetCSharpObjectOfUnrealObject;
+        public static readonly IntPtr GetCSharpObjectOfUnrealObject = InteropFunctions.FunctionTable->GetCSharpObjectOfUnrealObject;
+        /// <summary>
+        /// The get c sharp object handle slot table
+        /// </summary>
+        public static readonly IntPtr GetCSharpObjectHandleSlotTable = InteropFunctions.FunctionTable->GetCSharpObjectHandleSlotTable;
         /// <summary>
         /// The get outer of unreal object
         /// </summary>
-        public static readonly IntPtr GetOuterOfUnrealObject;
+        public static readonly IntPtr GetOuterOfUnrealObject = InteropFunctions.FunctionTable->GetOuterOfUnrealObject;
         /// <summary>
         /// The get name of unreal object
         /// </summary>
-        public static readonly IntPtr GetNameOfUnrealObject;
+        public static readonly IntPtr GetNameOfUnrealObject = InteropFunctions.FunctionTable->GetNameOfUnrealObject;
         /// <summary>
         /// The get path name of unreal object
         /// </summary>
-        public static readonly IntPtr GetPathNameOfUnrealObject;
+        public static readonly IntPtr GetPathNameOfUnrealObject = InteropFunctions.FunctionTable->GetPathNameOfUnrealObject;
         /// <summary>
         /// create default subobject
         /// </summary>
-        public static readonly IntPtr CreateDefaultSubobject;
+        public static readonly IntPtr CreateDefaultSubobject = InteropFunctions.FunctionTable->CreateDefaultSubobject;
         /// <summary>
         /// The get default subobject by name
         /// </summary>
-        public static readonly IntPtr GetDefaultSubobjectByName;
+        public static readonly IntPtr GetDefaultSubobjectByName = InteropFunctions.FunctionTable->GetDefaultSubobjectByName;
 
         /// <summary>
         /// Creates new unreal object.
         /// </summary>
-        public static readonly IntPtr NewUnrealObject;
+        public static readonly IntPtr NewUnrealObject = InteropFunctions.FunctionTable->NewUnrealObject;
 
         /// <summary>
         /// The duplicate unreal object
         /// </summary>
-        public static readonly IntPtr DuplicateUnrealObject;
+        public static readonly IntPtr DuplicateUnrealObject = InteropFunctions.FunctionTable->DuplicateUnrealObject;
 
         /// <summary>
         /// The get unreal transient package
         /// </summary>
-        public static readonly IntPtr GetUnrealTransientPackage;
+        public static readonly IntPtr GetUnrealTransientPackage = InteropFunctions.FunctionTable->GetUnrealTransientPackage;
 
         /// <summary>
         /// The add unreal object to root
         /// </summary>
-        public static readonly IntPtr AddUnrealObjectToRoot;
+        public static readonly IntPtr AddUnrealObjectToRoot = InteropFunctions.FunctionTable->AddUnrealObjectToRoot;
 
         /// <summary>
         /// The remove unreal object from root
         /// </summary>
-        public static readonly IntPtr RemoveUnrealObjectFromRoot;
+        public static readonly IntPtr RemoveUnrealObjectFromRoot = InteropFunctions.FunctionTable->RemoveUnrealObjectFromRoot;
 
         /// <summary>
         /// The is unreal object rooted
         /// </summary>
-        public static readonly IntPtr IsUnrealObjectRooted;
+        public static readonly IntPtr IsUnrealObjectRooted = InteropFunctions.FunctionTable->IsUnrealObjectRooted;
 
         /// <summary>
         /// The is unreal object valid
         /// </summary>
-        public static readonly IntPtr IsUnrealObjectValid;
+        public static readonly IntPtr IsUnrealObjectValid = InteropFunctions.FunctionTable->IsUnrealObjectValid;
 
         /// <summary>
         /// The find unreal object fast
         /// </summary>
-        public static readonly IntPtr FindUnrealObjectFast;
+        public static readonly IntPtr FindUnrealObjectFast = InteropFunctions.FunctionTable->FindUnrealObjectFast;
 
         /// <summary>
         /// The find unreal object
         /// </summary>
-        public static readonly IntPtr FindUnrealObject;
+        public static readonly IntPtr FindUnrealObject = InteropFunctions.FunctionTable->FindUnrealObject;
 
         /// <summary>
         /// The find unreal object checked
         /// </summary>
-        public static readonly IntPtr FindUnrealObjectChecked;
+        public static readonly IntPtr FindUnrealObjectChecked = InteropFunctions.FunctionTable->FindUnrealObjectChecked;
 
         /// <summary>
         /// The find unreal object safe
         /// </summary>
-        public static readonly IntPtr FindUnrealObjectSafe;
+        public static readonly IntPtr FindUnrealObjectSafe = InteropFunctions.FunctionTable->FindUnrealObjectSafe;
 
         /// <summary>
         /// The load unreal object
         /// </summary>
-        public static readonly IntPtr LoadUnrealObject;
+        public static readonly IntPtr LoadUnrealObject = InteropFunctions.FunctionTable->LoadUnrealObject;
 
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
     }
     #endregion
 
+    /// <summary>
+    /// The handle slot table, it lives as long as the C++ object table
+    /// </summary>
+    private static readonly FCSharpObjectHandleSlotTable* HandleSlotTable = 
+        ((delegate* unmanaged[Cdecl]<FCSharpObjectHandleSlotTable*>)InteropFunctionPointers.GetCSharpObjectHandleSlotTable)();
+
     #region Imports        
     /// <summary>
     /// Gets the default object pointer of class.
@@ -196,11 +217,64 @@ public static unsafe class ObjectInteropUtils
     /// <returns>UnrealSharp.UnrealEngine.UObject?.</returns>
     public static UObject? GetCSharpObjectOfUnrealObject(IntPtr unrealObjectPtr)
     {
+        if (unrealObjectPtr == IntPtr.Zero)
+        {
+            return null;
+        }
+
+        var existing = FindExistingCSharpObject(unrealObjectPtr);
+
+        if (existing != null)
+        {
+            return existing;
+        }
+
         var value = ((delegate* unmanaged[Cdecl]<IntPtr, FCSharpObjectMarshalValue>)InteropFunctionPointers.GetCSharpObjectOfUnrealObject)(unrealObjectPtr);
 
         return MarshalObject(value);
     }
 
+    /// <summary>
+    /// Finds the existing c# object of UObject pointer by the handle slot table without interop call.
+    /// </summary>
+    /// <param name="unrealObjectPtr">The unreal object PTR.</param>
+    /// <returns>UnrealSharp.UnrealEngine.UObject?, null if the proxy is not created yet.</returns>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static UObject? FindExistingCSharpObject(IntPtr unrealObjectPtr)
+    {
+        var table = HandleSlotTable;
+
+        if (table == null || table->InternalIndexOffset < 0)
+        {
+            return null;
+        }
+
+        var index = *(int*)((byte*)unrealObjectPtr + table->InternalIndexOffset);
+        var chunkIndex = index >> table->ChunkShift;
+
+        if (index < 0 || chunkIndex >= table->NumChunks)
+        {
+            return null;
+        }
+
+        var chunk = table->Chunks[chunkIndex];
+
+        if (chunk == null)
+        {
+            return null;
+        }
+
+        var handle = chunk[index & ((1 << table->ChunkShift) - 1)];
+
+        if (handle == IntPtr.Zero)
+        {
+            return null;
+        }
+
+        // the slot may belong to a new object which reuses the index, it will be set when its proxy is created
+        return GCHandle.FromIntPtr(handle).Target is UObject result && result.GetNativePtr() == unrealObjectPtr ? result : null;
+    }
+
     /// <summary>
     /// Gets the unreal object outer.
     /// </summary>
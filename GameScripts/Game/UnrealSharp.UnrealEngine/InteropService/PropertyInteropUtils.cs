@@ -34,72 +34,57 @@ public static unsafe class PropertyInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The get property offset
         /// </summary>
-        public static readonly IntPtr GetPropertyOffset;
+        public static readonly IntPtr GetPropertyOffset = InteropFunctions.FunctionTable->GetPropertyOffset;
         /// <summary>
         /// The get property size
         /// </summary>
-        public static readonly IntPtr GetPropertySize;
+        public static readonly IntPtr GetPropertySize = InteropFunctions.FunctionTable->GetPropertySize;
         /// <summary>
         /// The initialize property data
         /// </summary>
-        public static readonly IntPtr InitializePropertyData;
+        public static readonly IntPtr InitializePropertyData = InteropFunctions.FunctionTable->InitializePropertyData;
         /// <summary>
         /// The un initialize property data
         /// </summary>
-        public static readonly IntPtr UnInitializePropertyData;
+        public static readonly IntPtr UnInitializePropertyData = InteropFunctions.FunctionTable->UnInitializePropertyData;
         /// <summary>
         /// The get property cast flags
         /// </summary>
-        public static readonly IntPtr GetPropertyCastFlags;
+        public static readonly IntPtr GetPropertyCastFlags = InteropFunctions.FunctionTable->GetPropertyCastFlags;
         /// <summary>
         /// The get property inner field
         /// </summary>
-        public static readonly IntPtr GetPropertyInnerField;
+        public static readonly IntPtr GetPropertyInnerField = InteropFunctions.FunctionTable->GetPropertyInnerField;
 
         /// <summary>
         /// The set property value in container
         /// </summary>
-        public static readonly IntPtr SetPropertyValueInContainer;
+        public static readonly IntPtr SetPropertyValueInContainer = InteropFunctions.FunctionTable->SetPropertyValueInContainer;
 
         /// <summary>
         /// The get property value in container
         /// </summary>
-        public static readonly IntPtr GetPropertyValueInContainer;
+        public static readonly IntPtr GetPropertyValueInContainer = InteropFunctions.FunctionTable->GetPropertyValueInContainer;
 
         /// <summary>
         /// The set bool property value
         /// compatible with old version engine
         /// </summary>
-        public static readonly IntPtr SetBoolPropertyValue;
+        public static readonly IntPtr SetBoolPropertyValue = InteropFunctions.FunctionTable->SetBoolPropertyValue;
 
         /// <summary>
         /// The get bool property value
         /// compatible with old version engine
         /// </summary>
-        public static readonly IntPtr GetBoolPropertyValue;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr GetBoolPropertyValue = InteropFunctions.FunctionTable->GetBoolPropertyValue;
     }
     #endregion
 
@@ -34,54 +34,39 @@ public static unsafe class SetInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The get element property of set
         /// </summary>
-        public static readonly IntPtr GetElementPropertyOfSet;
+        public static readonly IntPtr GetElementPropertyOfSet = InteropFunctions.FunctionTable->GetElementPropertyOfSet;
         /// <summary>
         /// The get length of set
         /// </summary>
-        public static readonly IntPtr GetLengthOfSet;
+        public static readonly IntPtr GetLengthOfSet = InteropFunctions.FunctionTable->GetLengthOfSet;
         /// <summary>
         /// The get element address of set
         /// </summary>
-        public static readonly IntPtr GetElementAddressOfSet;
+        public static readonly IntPtr GetElementAddressOfSet = InteropFunctions.FunctionTable->GetElementAddressOfSet;
         /// <summary>
         /// The is set contains element
         /// </summary>
-        public static readonly IntPtr IsSetContainsElement;
+        public static readonly IntPtr IsSetContainsElement = InteropFunctions.FunctionTable->IsSetContainsElement;
         /// <summary>
         /// The add set element
         /// </summary>
-        public static readonly IntPtr AddSetElement;
+        public static readonly IntPtr AddSetElement = InteropFunctions.FunctionTable->AddSetElement;
         /// <summary>
         /// The remove set element
         /// </summary>
-        public static readonly IntPtr RemoveSetElement;
+        public static readonly IntPtr RemoveSetElement = InteropFunctions.FunctionTable->RemoveSetElement;
         /// <summary>
         /// The clear set
         /// </summary>
-        public static readonly IntPtr ClearSet;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr ClearSet = InteropFunctions.FunctionTable->ClearSet;
     }
     #endregion
 
@@ -23,6 +23,7 @@
 
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
+using System.Runtime.InteropServices;
 // ReSharper disable MemberHidesStaticFromOuterClass
 namespace UnrealSharp.UnrealEngine.InteropService;
 
@@ -34,70 +35,79 @@ public static unsafe class SoftObjectPtrInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The reset soft object PTR
         /// </summary>
-        public static readonly IntPtr ResetSoftObjectPtr;
+        public static readonly IntPtr ResetSoftObjectPtr = InteropFunctions.FunctionTable->ResetSoftObjectPtr;
         /// <summary>
         /// The reset soft object PTR weak PTR
         /// </summary>
-        public static readonly IntPtr ResetSoftObjectPtrWeakPtr;
+        public static readonly IntPtr ResetSoftObjectPtrWeakPtr = InteropFunctions.FunctionTable->ResetSoftObjectPtrWeakPtr;
         /// <summary>
         /// The is soft object PTR pending
         /// </summary>
-        public static readonly IntPtr IsSoftObjectPtrPending;
+        public static readonly IntPtr IsSoftObjectPtrPending = InteropFunctions.FunctionTable->IsSoftObjectPtrPending;
         /// <summary>
         /// The is soft object PTR valid
         /// </summary>
-        public static readonly IntPtr IsSoftObjectPtrValid;
+        public static readonly IntPtr IsSoftObjectPtrValid = InteropFunctions.FunctionTable->IsSoftObjectPtrValid;
         /// <summary>
         /// The is soft object PTR stale
         /// </summary>
-        public static readonly IntPtr IsSoftObjectPtrStale;
+        public static readonly IntPtr IsSoftObjectPtrStale = InteropFunctions.FunctionTable->IsSoftObjectPtrStale;
         /// <summary>
         /// The is soft object PTR null
         /// </summary>
-        public static readonly IntPtr IsSoftObjectPtrNull;
+        public static readonly IntPtr IsSoftObjectPtrNull = InteropFunctions.FunctionTable->IsSoftObjectPtrNull;
         /// <summary>
         /// The get unreal object pointer of soft object PTR
         /// </summary>
-        public static readonly IntPtr GetUnrealObjectPointerOfSoftObjectPtr;
+        public static readonly IntPtr GetUnrealObjectPointerOfSoftObjectPtr = InteropFunctions.FunctionTable->GetUnrealObjectPointerOfSoftObjectPtr;
         /// <summary>
         /// The get unreal object pointer of soft object PTR ex
         /// </summary>
-        public static readonly IntPtr GetUnrealObjectPointerOfSoftObjectPtrEx;
+        public static readonly IntPtr GetUnrealObjectPointerOfSoftObjectPtrEx = InteropFunctions.FunctionTable->GetUnrealObjectPointerOfSoftObjectPtrEx;
         /// <summary>
         /// The get object identifier pointer of soft object PTR
         /// </summary>
-        public static readonly IntPtr GetObjectIdPointerOfSoftObjectPtr;
+        public static readonly IntPtr GetObjectIdPointerOfSoftObjectPtr = InteropFunctions.FunctionTable->GetObjectIdPointerOfSoftObjectPtr;
         /// <summary>
         /// The load synchronous soft object PTR
         /// </summary>
-        public static readonly IntPtr LoadSynchronousSoftObjectPtr;
+        public static readonly IntPtr LoadSynchronousSoftObjectPtr = InteropFunctions.FunctionTable->LoadSynchronousSoftObjectPtr;
         /// <summary>
         /// The copy soft object PTR
         /// </summary>
-        public static readonly IntPtr CopySoftObjectPtr;
-#pragma warning restore CS0649
-
+        public static readonly IntPtr CopySoftObjectPtr = InteropFunctions.FunctionTable->CopySoftObjectPtr;
+        /// <summary>
+        /// The request async load soft object ptrs
+        /// </summary>
+        public static readonly IntPtr RequestAsyncLoadSoftObjectPtrs = InteropFunctions.FunctionTable->RequestAsyncLoadSoftObjectPtrs;
+        /// <summary>
+        /// The get async load state
+        /// </summary>
+        public static readonly IntPtr GetAsyncLoadState = InteropFunctions.FunctionTable->GetAsyncLoadState;
+        /// <summary>
+        /// The get async loaded objects
+        /// </summary>
+        public static readonly IntPtr GetAsyncLoadedObjects = InteropFunctions.FunctionTable->GetAsyncLoadedObjects;
+        /// <summary>
+        /// The cancel async load
+        /// </summary>
+        public static readonly IntPtr CancelAsyncLoad = InteropFunctions.FunctionTable->CancelAsyncLoad;
         /// <summary>
-        /// static constructor
+        /// The release async load
         /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr ReleaseAsyncLoad = InteropFunctions.FunctionTable->ReleaseAsyncLoad;
+        /// <summary>
+        /// The get async load statistics
+        /// </summary>
+        public static readonly IntPtr GetAsyncLoadStatistics = InteropFunctions.FunctionTable->GetAsyncLoadStatistics;
     }
     #endregion
 
@@ -209,4 +219,126 @@ public static unsafe class SoftObjectPtrInteropUtils
     {
         ((delegate* unmanaged[Cdecl]<IntPtr, IntPtr, void>)InteropFunctionPointers.CopySoftObjectPtr)(destAddressOfSoftObjectPtr, sourceAddressOfSoftObjectPtr);
     }
+
+    /// <summary>
+    /// Requests asynchronous load of soft object pointers, the paths are copied, so the pointers can be destroyed after this call.
+    /// </summary>
+    /// <param name="addressesOfSoftObjectPtr">The addresses of soft object PTR.</param>
+    /// <param name="count">The count.</param>
+    /// <param name="priority">The priority.</param>
+    /// <returns>id of the request, 0 if nothing to load.</returns>
+    public static int RequestAsyncLoadSoftObjectPtrs(IntPtr* addressesOfSoftObjectPtr, int count, int priority)
+    {
+        return ((delegate* unmanaged[Cdecl]<IntPtr*, int, int, int>)InteropFunctionPointers.RequestAsyncLoadSoftObjectPtrs)(addressesOfSoftObjectPtr, count, priority);
+    }
+
+    /// <summary>
+    /// Gets the state of asynchronous load.
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    /// <param name="progress">The progress, from 0 to 1.</param>
+    /// <returns>EAsyncLoadState.</returns>
+    public static EAsyncLoadState GetAsyncLoadState(int requestId, out float progress)
+    {
+        float localProgress;
+        var state = ((delegate* unmanaged[Cdecl]<int, float*, int>)InteropFunctionPointers.GetAsyncLoadState)(requestId, &localProgress);
+        progress = localProgress;
+
+        return (EAsyncLoadState)state;
+    }
+
+    /// <summary>
+    /// Gets the UObject pointers loaded by a completed request, in the order of requested soft object pointers.
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    /// <param name="objects">The objects.</param>
+    /// <param name="count">The count.</param>
+    /// <returns>count of loaded objects.</returns>
+    public static int GetAsyncLoadedObjects(int requestId, IntPtr* objects, int count)
+    {
+        return ((delegate* unmanaged[Cdecl]<int, IntPtr*, int, int>)InteropFunctionPointers.GetAsyncLoadedObjects)(requestId, objects, count);
+    }
+
+    /// <summary>
+    /// Cancels the asynchronous load.
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    public static void CancelAsyncLoad(int requestId)
+    {
+        ((delegate* unmanaged[Cdecl]<int, void>)InteropFunctionPointers.CancelAsyncLoad)(requestId);
+    }
+
+    /// <summary>
+    /// Releases the asynchronous load, it is canceled if it is not completed.
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    public static void ReleaseAsyncLoad(int requestId)
+    {
+        ((delegate* unmanaged[Cdecl]<int, void>)InteropFunctionPointers.ReleaseAsyncLoad)(requestId);
+    }
+
+    /// <summary>
+    /// Gets the asynchronous load statistics.
+    /// </summary>
+    /// <returns>FCSharpAsyncLoadStatistics.</returns>
+    public static FCSharpAsyncLoadStatistics GetAsyncLoadStatistics()
+    {
+        FCSharpAsyncLoadStatistics statistics;
+        ((delegate* unmanaged[Cdecl]<FCSharpAsyncLoadStatistics*, void>)InteropFunctionPointers.GetAsyncLoadStatistics)(&statistics);
+
+        return statistics;
+    }
+}
+
+/// <summary>
+/// Enum EAsyncLoadState
+/// must match with C++ FCSharpAsyncLoadManager::ERequestState
+/// </summary>
+public enum EAsyncLoadState
+{
+    /// <summary>
+    /// The request is released or never exists
+    /// </summary>
+    Invalid,
+    /// <summary>
+    /// The pending
+    /// </summary>
+    Pending,
+    /// <summary>
+    /// The completed
+    /// </summary>
+    Completed,
+    /// <summary>
+    /// The canceled
+    /// </summary>
+    Canceled
+}
+
+/// <summary>
+/// Struct FCSharpAsyncLoadStatistics
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+// ReSharper disable once InconsistentNaming
+public struct FCSharpAsyncLoadStatistics
+{
+    /// <summary>
+    /// The pending count
+    /// </summary>
+    public int PendingCount;
+    /// <summary>
+    /// The completed count
+    /// </summary>
+    public int CompletedCount;
+    /// <summary>
+    /// The canceled count
+    /// </summary>
+    public int CanceledCount;
+    /// <summary>
+    /// The total load seconds of completed requests
+    /// </summary>
+    public double TotalLoadSeconds;
+    /// <summary>
+    /// The maximum load seconds
+    /// </summary>
+    public double MaxLoadSeconds;
 }
\ No newline at end of file
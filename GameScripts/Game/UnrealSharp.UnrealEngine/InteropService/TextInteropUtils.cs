@@ -34,38 +34,23 @@ public static unsafe class TextInteropUtils
     #region Interop Function Pointers     
     /// <summary>
     /// Class InteropFunctionPointers
-    /// Since mono does not support setting delegate* unmanaged type fields directly through reflection,
-    /// Therefore we cannot directly declare delegate* unmanaged fields and set them through reflection
-    /// So we use this method to set it indirectly, first save the external function pointer to these IntPtr,
-    /// and then solve it through forced type conversion when calling.Although this is a bit inconvenient,
-    /// there is currently no other way unless Mono supports it in the future.
-    /// ReSharper disable once CommentTypo
-    /// @reference check here: https://github.com/dotnet/runtime/blob/main/src/mono/mono/metadata/icall.c#L2134  ves_icall_RuntimeFieldInfo_SetValueInternal
+    /// All function pointers are read from the built-in interop function table by fixed offsets,
+    /// see also FUnrealInteropFunctionTable.
     /// </summary>
     private static class InteropFunctionPointers
     {
-#pragma warning disable CS0649 // The compiler detected an uninitialized private or internal field declaration that is never assigned a value. [We use reflection to bind all fields of this class]
         /// <summary>
         /// The get text c sharp marshal string from unreal text
         /// </summary>
-        public static readonly IntPtr GetTextCSharpMarshalStringFromUnrealText;
+        public static readonly IntPtr GetTextCSharpMarshalStringFromUnrealText = InteropFunctions.FunctionTable->GetTextCSharpMarshalStringFromUnrealText;
         /// <summary>
         /// The get text c sharp marshal string from c sharp string
         /// </summary>
-        public static readonly IntPtr GetTextCSharpMarshalStringFromCSharpString;
+        public static readonly IntPtr GetTextCSharpMarshalStringFromCSharpString = InteropFunctions.FunctionTable->GetTextCSharpMarshalStringFromCSharpString;
         /// <summary>
         /// The set unreal text from c sharp string
         /// </summary>
-        public static readonly IntPtr SetUnrealTextFromCSharpString;
-#pragma warning restore CS0649
-
-        /// <summary>
-        /// static constructor
-        /// </summary>
-        static InteropFunctionPointers()
-        {
-            InteropFunctions.BindInteropFunctionPointers(typeof(InteropFunctionPointers));
-        }
+        public static readonly IntPtr SetUnrealTextFromCSharpString = InteropFunctions.FunctionTable->SetUnrealTextFromCSharpString;
     }
     #endregion
 
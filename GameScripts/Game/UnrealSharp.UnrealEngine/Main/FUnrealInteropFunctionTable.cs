@@ -0,0 +1,607 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+
+using System.Reflection;
+using System.Runtime.InteropServices;
+
+namespace UnrealSharp.UnrealEngine.Main;
+
+/// <summary>
+/// Struct FUnrealInteropFunctionTable
+/// All built-in interop functions, stored by ordinal.
+/// Sync with C++, the order of fields must be the same as InteropApiDefines.inl
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct FUnrealInteropFunctionTable
+{
+    #region Actor Interop Utils
+    /// <summary>
+    /// The get actor world
+    /// </summary>
+    public IntPtr GetActorWorld;
+    /// <summary>
+    /// The get actor game instance
+    /// </summary>
+    public IntPtr GetActorGameInstance;
+    /// <summary>
+    /// The spawn actor by transform
+    /// </summary>
+    public IntPtr SpawnActorByTransform;
+    /// <summary>
+    /// The spawn actor
+    /// </summary>
+    public IntPtr SpawnActor;
+    /// <summary>
+    /// The spawn actors deferred
+    /// </summary>
+    public IntPtr SpawnActorsDeferred;
+    /// <summary>
+    /// The finish spawning actors
+    /// </summary>
+    public IntPtr FinishSpawningActors;
+    #endregion
+
+    #region Array Interop Utils
+    /// <summary>
+    /// The get element property of array
+    /// </summary>
+    public IntPtr GetElementPropertyOfArray;
+    /// <summary>
+    /// The get length of array
+    /// </summary>
+    public IntPtr GetLengthOfArray;
+    /// <summary>
+    /// The get element address of array
+    /// </summary>
+    public IntPtr GetElementAddressOfArray;
+    /// <summary>
+    /// The clear array
+    /// </summary>
+    public IntPtr ClearArray;
+    /// <summary>
+    /// The insert empty at array index
+    /// </summary>
+    public IntPtr InsertEmptyAtArrayIndex;
+    /// <summary>
+    /// The remove at array index
+    /// </summary>
+    public IntPtr RemoveAtArrayIndex;
+    /// <summary>
+    /// The find index of array element
+    /// </summary>
+    public IntPtr FindIndexOfArrayElement;
+    #endregion
+
+    #region Class Interop Utils
+    /// <summary>
+    /// The get default object of class
+    /// </summary>
+    public IntPtr GetDefaultObjectOfClass;
+    /// <summary>
+    /// The get class pointer of unreal object
+    /// </summary>
+    public IntPtr GetClassPointerOfUnrealObject;
+    /// <summary>
+    /// The load unreal field
+    /// </summary>
+    public IntPtr LoadUnrealField;
+    /// <summary>
+    /// The load unreal fields
+    /// </summary>
+    public IntPtr LoadUnrealFields;
+    /// <summary>
+    /// The check u class is child of
+    /// </summary>
+    public IntPtr CheckUClassIsChildOf;
+    /// <summary>
+    /// The get super class
+    /// </summary>
+    public IntPtr GetSuperClass;
+    /// <summary>
+    /// The get property
+    /// </summary>
+    public IntPtr GetProperty;
+    /// <summary>
+    /// The get property meta caches
+    /// </summary>
+    public IntPtr GetPropertyMetaCaches;
+    /// <summary>
+    /// The load struct property meta caches
+    /// </summary>
+    public IntPtr LoadStructPropertyMetaCaches;
+    /// <summary>
+    /// The get function
+    /// </summary>
+    public IntPtr GetFunction;
+    /// <summary>
+    /// The get struct size
+    /// </summary>
+    public IntPtr GetStructSize;
+    /// <summary>
+    /// The initialize struct data
+    /// </summary>
+    public IntPtr InitializeStructData;
+    /// <summary>
+    /// The uninitialize struct data
+    /// </summary>
+    public IntPtr UninitializeStructData;
+    /// <summary>
+    /// The get field c sharp full path
+    /// </summary>
+    public IntPtr GetFieldCSharpFullPath;
+    /// <summary>
+    /// The get class flags
+    /// </summary>
+    public IntPtr GetClassFlags;
+    #endregion
+
+    #region Delegate Interop Utils
+    /// <summary>
+    /// The bind delegate
+    /// </summary>
+    public IntPtr BindDelegate;
+    /// <summary>
+    /// The unbind delegate
+    /// </summary>
+    public IntPtr UnbindDelegate;
+    /// <summary>
+    /// The clear delegate
+    /// </summary>
+    public IntPtr ClearDelegate;
+    /// <summary>
+    /// The add delegate
+    /// </summary>
+    public IntPtr AddDelegate;
+    /// <summary>
+    /// The remove delegate
+    /// </summary>
+    public IntPtr RemoveDelegate;
+    /// <summary>
+    /// The remove all delegate
+    /// </summary>
+    public IntPtr RemoveAllDelegate;
+    #endregion
+
+    #region Invocation Interop Utils
+    /// <summary>
+    /// The create unreal invocation
+    /// </summary>
+    public IntPtr CreateUnrealInvocation;
+    /// <summary>
+    /// The create unreal invocation from delegate property
+    /// </summary>
+    public IntPtr CreateUnrealInvocationFromDelegateProperty;
+    /// <summary>
+    /// The destroy unreal invocation
+    /// </summary>
+    public IntPtr DestroyUnrealInvocation;
+    /// <summary>
+    /// The invoke unreal invocation
+    /// </summary>
+    public IntPtr InvokeUnrealInvocation;
+    /// <summary>
+    /// The get unreal invocation function
+    /// </summary>
+    public IntPtr GetUnrealInvocationFunction;
+    /// <summary>
+    /// The get unreal invocation parameter size
+    /// </summary>
+    public IntPtr GetUnrealInvocationParameterSize;
+    /// <summary>
+    /// The initialize unreal invocation parameters
+    /// </summary>
+    public IntPtr InitializeUnrealInvocationParameters;
+    /// <summary>
+    /// The un initialize unreal invocation parameters
+    /// </summary>
+    public IntPtr UnInitializeUnrealInvocationParameters;
+    #endregion
+
+    #region Map Interop Utils
+    /// <summary>
+    /// The get key property of map
+    /// </summary>
+    public IntPtr GetKeyPropertyOfMap;
+    /// <summary>
+    /// The get value property of map
+    /// </summary>
+    public IntPtr GetValuePropertyOfMap;
+    /// <summary>
+    /// The get length of map
+    /// </summary>
+    public IntPtr GetLengthOfMap;
+    /// <summary>
+    /// The clear map
+    /// </summary>
+    public IntPtr ClearMap;
+    /// <summary>
+    /// The get key address of map element
+    /// </summary>
+    public IntPtr GetKeyAddressOfMapElement;
+    /// <summary>
+    /// The get value address of map element
+    /// </summary>
+    public IntPtr GetValueAddressOfMapElement;
+    /// <summary>
+    /// The get address of map element
+    /// </summary>
+    public IntPtr GetAddressOfMapElement;
+    /// <summary>
+    /// The find value address of element key
+    /// </summary>
+    public IntPtr FindValueAddressOfElementKey;
+    /// <summary>
+    /// The try add new element to map
+    /// </summary>
+    public IntPtr TryAddNewElementToMap;
+    /// <summary>
+    /// The remove element from map
+    /// </summary>
+    public IntPtr RemoveElementFromMap;
+    #endregion
+
+    #region Misc Interop Utils
+    /// <summary>
+    /// The make guid from string
+    /// </summary>
+    public IntPtr MakeGuidFromString;
+    #endregion
+
+    #region Name Interop Utils
+    /// <summary>
+    /// The get string of name
+    /// </summary>
+    public IntPtr GetStringOfName;
+    /// <summary>
+    /// The get name of string
+    /// </summary>
+    public IntPtr GetNameOfString;
+    #endregion
+
+    #region ObjectInitializer Interop Utils
+    /// <summary>
+    /// The get class of object initializer
+    /// </summary>
+    public IntPtr GetClassOfObjectInitializer;
+    /// <summary>
+    /// The get object of object initializer
+    /// </summary>
+    public IntPtr GetObjectOfObjectInitializer;
+    /// <summary>
+    /// The create default subobject of object initializer
+    /// </summary>
+    public IntPtr CreateDefaultSubobjectOfObjectInitializer;
+    /// <summary>
+    /// The create editor only default subobject of object initializer
+    /// </summary>
+    public IntPtr CreateEditorOnlyDefaultSubobjectOfObjectInitializer;
+    /// <summary>
+    /// The set default subobject class of object initializer
+    /// </summary>
+    public IntPtr SetDefaultSubobjectClassOfObjectInitializer;
+    /// <summary>
+    /// The do not create default subobject of object initializer
+    /// </summary>
+    public IntPtr DoNotCreateDefaultSubobjectOfObjectInitializer;
+    /// <summary>
+    /// The set nested default subobject class of object initializer
+    /// </summary>
+    public IntPtr SetNestedDefaultSubobjectClassOfObjectInitializer;
+    /// <summary>
+    /// The do not create nested default subobject of object initializer
+    /// </summary>
+    public IntPtr DoNotCreateNestedDefaultSubobjectOfObjectInitializer;
+    #endregion
+
+    #region Object Interop Utils
+    /// <summary>
+    /// The get default unreal object of class
+    /// </summary>
+    public IntPtr GetDefaultUnrealObjectOfClass;
+    /// <summary>
+    /// The get unreal object of c sharp object
+    /// </summary>
+    public IntPtr GetUnrealObjectOfCSharpObject;
+    /// <summary>
+    /// The get c sharp object of unreal object
+    /// </summary>
+    public IntPtr GetCSharpObjectOfUnrealObject;
+    /// <summary>
+    /// The get c sharp object handle slot table
+    /// </summary>
+    public IntPtr GetCSharpObjectHandleSlotTable;
+    /// <summary>
+    /// The get outer of unreal object
+    /// </summary>
+    public IntPtr GetOuterOfUnrealObject;
+    /// <summary>
+    /// The get name of unreal object
+    /// </summary>
+    public IntPtr GetNameOfUnrealObject;
+    /// <summary>
+    /// The get path name of unreal object
+    /// </summary>
+    public IntPtr GetPathNameOfUnrealObject;
+    /// <summary>
+    /// The create default subobject
+    /// </summary>
+    public IntPtr CreateDefaultSubobject;
+    /// <summary>
+    /// The get default subobject by name
+    /// </summary>
+    public IntPtr GetDefaultSubobjectByName;
+    /// <summary>
+    /// The new unreal object
+    /// </summary>
+    public IntPtr NewUnrealObject;
+    /// <summary>
+    /// The duplicate unreal object
+    /// </summary>
+    public IntPtr DuplicateUnrealObject;
+    /// <summary>
+    /// The get unreal transient package
+    /// </summary>
+    public IntPtr GetUnrealTransientPackage;
+    /// <summary>
+    /// The add unreal object to root
+    /// </summary>
+    public IntPtr AddUnrealObjectToRoot;
+    /// <summary>
+    /// The remove unreal object from root
+    /// </summary>
+    public IntPtr RemoveUnrealObjectFromRoot;
+    /// <summary>
+    /// The is unreal object rooted
+    /// </summary>
+    public IntPtr IsUnrealObjectRooted;
+    /// <summary>
+    /// The is unreal object valid
+    /// </summary>
+    public IntPtr IsUnrealObjectValid;
+    /// <summary>
+    /// The find unreal object fast
+    /// </summary>
+    public IntPtr FindUnrealObjectFast;
+    /// <summary>
+    /// The find unreal object
+    /// </summary>
+    public IntPtr FindUnrealObject;
+    /// <summary>
+    /// The find unreal object checked
+    /// </summary>
+    public IntPtr FindUnrealObjectChecked;
+    /// <summary>
+    /// The find unreal object safe
+    /// </summary>
+    public IntPtr FindUnrealObjectSafe;
+    /// <summary>
+    /// The load unreal object
+    /// </summary>
+    public IntPtr LoadUnrealObject;
+    #endregion
+
+    #region Property Interop Utils
+    /// <summary>
+    /// The get property offset
+    /// </summary>
+    public IntPtr GetPropertyOffset;
+    /// <summary>
+    /// The get property size
+    /// </summary>
+    public IntPtr GetPropertySize;
+    /// <summary>
+    /// The initialize property data
+    /// </summary>
+    public IntPtr InitializePropertyData;
+    /// <summary>
+    /// The un initialize property data
+    /// </summary>
+    public IntPtr UnInitializePropertyData;
+    /// <summary>
+    /// The get property cast flags
+    /// </summary>
+    public IntPtr GetPropertyCastFlags;
+    /// <summary>
+    /// The get property inner field
+    /// </summary>
+    public IntPtr GetPropertyInnerField;
+    /// <summary>
+    /// The set property value in container
+    /// </summary>
+    public IntPtr SetPropertyValueInContainer;
+    /// <summary>
+    /// The get property value in container
+    /// </summary>
+    public IntPtr GetPropertyValueInContainer;
+    /// <summary>
+    /// The set bool property value
+    /// </summary>
+    public IntPtr SetBoolPropertyValue;
+    /// <summary>
+    /// The get bool property value
+    /// </summary>
+    public IntPtr GetBoolPropertyValue;
+    #endregion
+
+    #region Set Interop Utils
+    /// <summary>
+    /// The get element property of set
+    /// </summary>
+    public IntPtr GetElementPropertyOfSet;
+    /// <summary>
+    /// The get length of set
+    /// </summary>
+    public IntPtr GetLengthOfSet;
+    /// <summary>
+    /// The get element address of set
+    /// </summary>
+    public IntPtr GetElementAddressOfSet;
+    /// <summary>
+    /// The is set contains element
+    /// </summary>
+    public IntPtr IsSetContainsElement;
+    /// <summary>
+    /// The add set element
+    /// </summary>
+    public IntPtr AddSetElement;
+    /// <summary>
+    /// The remove set element
+    /// </summary>
+    public IntPtr RemoveSetElement;
+    /// <summary>
+    /// The clear set
+    /// </summary>
+    public IntPtr ClearSet;
+    #endregion
+
+    #region Soft Object Ptr Interop Utils
+    /// <summary>
+    /// The reset soft object ptr
+    /// </summary>
+    public IntPtr ResetSoftObjectPtr;
+    /// <summary>
+    /// The reset soft object ptr weak ptr
+    /// </summary>
+    public IntPtr ResetSoftObjectPtrWeakPtr;
+    /// <summary>
+    /// The is soft object ptr pending
+    /// </summary>
+    public IntPtr IsSoftObjectPtrPending;
+    /// <summary>
+    /// The is soft object ptr valid
+    /// </summary>
+    public IntPtr IsSoftObjectPtrValid;
+    /// <summary>
+    /// The is soft object ptr stale
+    /// </summary>
+    public IntPtr IsSoftObjectPtrStale;
+    /// <summary>
+    /// The is soft object ptr null
+    /// </summary>
+    public IntPtr IsSoftObjectPtrNull;
+    /// <summary>
+    /// The get unreal object pointer of soft object ptr
+    /// </summary>
+    public IntPtr GetUnrealObjectPointerOfSoftObjectPtr;
+    /// <summary>
+    /// The get unreal object pointer of soft object ptr ex
+    /// </summary>
+    public IntPtr GetUnrealObjectPointerOfSoftObjectPtrEx;
+    /// <summary>
+    /// The get object id pointer of soft object ptr
+    /// </summary>
+    public IntPtr GetObjectIdPointerOfSoftObjectPtr;
+    /// <summary>
+    /// The load synchronous soft object ptr
+    /// </summary>
+    public IntPtr LoadSynchronousSoftObjectPtr;
+    /// <summary>
+    /// The copy soft object ptr
+    /// </summary>
+    public IntPtr CopySoftObjectPtr;
+    /// <summary>
+    /// The request async load soft object ptrs
+    /// </summary>
+    public IntPtr RequestAsyncLoadSoftObjectPtrs;
+    /// <summary>
+    /// The get async load state
+    /// </summary>
+    public IntPtr GetAsyncLoadState;
+    /// <summary>
+    /// The get async loaded objects
+    /// </summary>
+    public IntPtr GetAsyncLoadedObjects;
+    /// <summary>
+    /// The cancel async load
+    /// </summary>
+    public IntPtr CancelAsyncLoad;
+    /// <summary>
+    /// The release async load
+    /// </summary>
+    public IntPtr ReleaseAsyncLoad;
+    /// <summary>
+    /// The get async load statistics
+    /// </summary>
+    public IntPtr GetAsyncLoadStatistics;
+    #endregion
+
+    #region String Interop Utils
+    /// <summary>
+    /// The get c sharp marshal string
+    /// </summary>
+    public IntPtr GetCSharpMarshalString;
+    /// <summary>
+    /// The set unreal string
+    /// </summary>
+    public IntPtr SetUnrealString;
+    /// <summary>
+    /// The get unreal string length
+    /// </summary>
+    public IntPtr GetUnrealStringLength;
+    /// <summary>
+    /// The copy unreal string
+    /// </summary>
+    public IntPtr CopyUnrealString;
+    #endregion
+
+    #region Text Interop Utils
+    /// <summary>
+    /// The get text c sharp marshal string from unreal text
+    /// </summary>
+    public IntPtr GetTextCSharpMarshalStringFromUnrealText;
+    /// <summary>
+    /// The get text c sharp marshal string from c sharp string
+    /// </summary>
+    public IntPtr GetTextCSharpMarshalStringFromCSharpString;
+    /// <summary>
+    /// The set unreal text from c sharp string
+    /// </summary>
+    public IntPtr SetUnrealTextFromCSharpString;
+    #endregion
+
+    /// <summary>
+    /// Calculates the layout hash.
+    /// must match with C++ FUnrealInteropFunctionTable::GetLayoutHash
+    /// </summary>
+    /// <returns>System.UInt32.</returns>
+    public static uint CalcLayoutHash()
+    {
+        // FNV-1a of all function names, each name is terminated by ';'
+        var hash = 2166136261u;
+
+        foreach (var field in typeof(FUnrealInteropFunctionTable).GetFields(BindingFlags.Instance | BindingFlags.Public))
+        {
+            foreach (var character in field.Name)
+            {
+                hash = (hash ^ (byte)character) * 16777619u;
+            }
+
+            hash = (hash ^ (byte)';') * 16777619u;
+        }
+
+        return hash;
+    }
+}
@@ -54,6 +54,11 @@ public unsafe struct FUnrealInteropFunctionsInfo
     /// </summary>
     public void* LogMessageFunctionPointer;
 
+    /// <summary>
+    /// The built-in interop function table
+    /// </summary>
+    public FUnrealInteropFunctionTable* FunctionTable;
+
     /// <summary>
     /// The unreal major version
     /// </summary>
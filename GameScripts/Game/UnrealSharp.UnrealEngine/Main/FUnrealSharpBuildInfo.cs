@@ -92,6 +92,10 @@ public struct FUnrealSharpBuildInfo
     /// The b with editor
     /// </summary>
     public bool bWithEditor;
+    /// <summary>
+    /// The layout hash of interop function table
+    /// </summary>
+    public uint InteropFunctionTableLayoutHash;
 
     /// <summary>
     /// Gets this instance.
@@ -129,6 +133,8 @@ public struct FUnrealSharpBuildInfo
 #error "You should add DEBUG or NDEBUG for your build configuration."
 #endif
 
+        result.InteropFunctionTableLayoutHash = FUnrealInteropFunctionTable.CalcLayoutHash();
+
         return result;
     }
 }
\ No newline at end of file
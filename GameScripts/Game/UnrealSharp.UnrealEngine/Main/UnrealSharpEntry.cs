@@ -56,6 +56,18 @@ public static class UnrealSharpEntry
     /// <value>The unreal version.</value>
     public static string UnrealVersion => $"{InteropFunctionInfo.UnrealMajorVersion}.{InteropFunctionInfo.UnrealMinorVersion}.{InteropFunctionInfo.UnrealPatchVersion}";
 
+    /// <summary>
+    /// Gets the managed thread identifier of the game thread, Main is always called on it.
+    /// </summary>
+    /// <value>The game thread identifier.</value>
+    public static int GameThreadId { get; private set; } = -1;
+
+    /// <summary>
+    /// Gets a value indicating whether the current thread is the game thread.
+    /// </summary>
+    /// <value><c>true</c> if the current thread is the game thread; otherwise, <c>false</c>.</value>
+    public static bool IsInGameThread => Environment.CurrentManagedThreadId == GameThreadId;
+
     /// <summary>
     /// The log message pointer
     /// </summary>
@@ -68,6 +80,8 @@ public static class UnrealSharpEntry
     /// <param name="commandArgumentStringPtr">The command argument string PTR.</param>
     public static void Main(nint interopInfoPtr, nint commandArgumentStringPtr)
     {
+        GameThreadId = Environment.CurrentManagedThreadId;
+
         unsafe
         {
             InteropFunctionInfo = *(FUnrealInteropFunctionsInfo*)interopInfoPtr;
@@ -97,13 +111,14 @@ public static class UnrealSharpEntry
 
         Logger.Log("Unreal Engine Version : {0}", UnrealVersion);
 
-        MetaInteropUtils.DumpAllPossibleFastAccessInAssembly(typeof(UnrealSharpEntry).Assembly);
-
+        // validate before any interop function is read from the function table
         unsafe
         {
             var buildInfo = FUnrealSharpBuildInfo.Get();
             InteropFunctions.ValidateUnrealSharpBuildInfo(&buildInfo);
         }
+
+        MetaInteropUtils.DumpAllPossibleFastAccessInAssembly(typeof(UnrealSharpEntry).Assembly);
     }
 
     /// <summary>
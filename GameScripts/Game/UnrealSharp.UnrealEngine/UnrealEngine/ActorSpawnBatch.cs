@@ -0,0 +1,156 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+using System.Diagnostics;
+using UnrealSharp.UnrealEngine.InteropService;
+using UnrealSharp.Utils.Misc;
+
+namespace UnrealSharp.UnrealEngine;
+
+/// <summary>
+/// Class ActorSpawnBatch.
+/// Spawns a large number of actors across frames with a time budget,
+/// call Step from a tick function until it returns true.
+/// </summary>
+public class ActorSpawnBatch
+{
+    /// <summary>
+    /// The transforms
+    /// </summary>
+    private readonly FTransform[] _transforms;
+    /// <summary>
+    /// The initializer
+    /// </summary>
+    private readonly Action<AActor, int>? _initializer;
+    /// <summary>
+    /// The count of actors spawned in each interop round trip
+    /// </summary>
+    private readonly int _chunkSize;
+    /// <summary>
+    /// The index of next transform
+    /// </summary>
+    private int _nextIndex;
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="ActorSpawnBatch"/> class.
+    /// </summary>
+    /// <param name="world">The world.</param>
+    /// <param name="class">The class.</param>
+    /// <param name="transforms">The transforms, one actor for each.</param>
+    /// <param name="initializer">Invoked with each actor and its index before BeginPlay.</param>
+    /// <param name="chunkSize">The count of actors spawned between two checks of the time budget.</param>
+    public ActorSpawnBatch(UWorld world, UClass @class, FTransform[] transforms, Action<AActor, int>? initializer = null, int chunkSize = 16)
+    {
+        Logger.Assert(chunkSize > 0);
+
+        World = world;
+        Class = @class;
+        _transforms = transforms;
+        _initializer = initializer;
+        _chunkSize = Math.Max(chunkSize, 1);
+
+        Actors = new AActor?[transforms.Length];
+    }
+
+    /// <summary>
+    /// Gets the world.
+    /// </summary>
+    /// <value>The world.</value>
+    public UWorld World { get; }
+
+    /// <summary>
+    /// Gets the class.
+    /// </summary>
+    /// <value>The class.</value>
+    public UClass Class { get; }
+
+    /// <summary>
+    /// Gets the actors, null for actors not spawned yet or failed to spawn.
+    /// </summary>
+    /// <value>The actors.</value>
+    public AActor?[] Actors { get; }
+
+    /// <summary>
+    /// Gets the count of processed transforms.
+    /// </summary>
+    /// <value>The processed count.</value>
+    public int ProcessedCount => _nextIndex;
+
+    /// <summary>
+    /// Gets a value indicating whether all actors are spawned.
+    /// </summary>
+    /// <value><c>true</c> if this instance is completed; otherwise, <c>false</c>.</value>
+    public bool IsCompleted => _nextIndex >= _transforms.Length;
+
+    /// <summary>
+    /// Occurs when all actors are spawned.
+    /// </summary>
+    public event Action<ActorSpawnBatch>? Completed;
+
+    /// <summary>
+    /// Spawns actors until the time budget is used up, at least one chunk is spawned in each step.
+    /// </summary>
+    /// <param name="budgetMilliseconds">The budget in milliseconds, 0 or less spawns all remaining actors.</param>
+    /// <returns><c>true</c> if all actors are spawned, <c>false</c> otherwise.</returns>
+    public bool Step(double budgetMilliseconds)
+    {
+        if (IsCompleted)
+        {
+            return true;
+        }
+
+        var startTimestamp = Stopwatch.GetTimestamp();
+
+        do
+        {
+            var count = budgetMilliseconds > 0 ? Math.Min(_chunkSize, _transforms.Length - _nextIndex) : _transforms.Length - _nextIndex;
+
+            try
+            {
+                ActorInteropUtils.SpawnActors(
+                    World, 
+                    Class, 
+                    _transforms.AsSpan(_nextIndex, count), 
+                    Actors.AsSpan(_nextIndex, count), 
+                    _initializer, 
+                    _nextIndex
+                    );
+            }
+            finally
+            {
+                // the chunk is spawned and finished even if the initializer throws, never spawn it again
+                _nextIndex += count;
+            }
+        } 
+        while (!IsCompleted && Stopwatch.GetElapsedTime(startTimestamp).TotalMilliseconds < budgetMilliseconds);
+
+        if (IsCompleted)
+        {
+            Completed?.Invoke(this);
+        }
+
+        return IsCompleted;
+    }
+}
@@ -0,0 +1,245 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+using UnrealSharp.UnrealEngine.InteropService;
+using UnrealSharp.UnrealEngine.Main;
+using UnrealSharp.Utils.Misc;
+
+namespace UnrealSharp.UnrealEngine;
+
+/// <summary>
+/// Class AsyncLoadManager.
+/// Load soft object pointers asynchronously by FStreamableManager of C++ without blocking the game thread.
+/// Tasks are completed on the game thread when C++ finishes loading, continuations of await run on the game thread too.
+/// </summary>
+public static class AsyncLoadManager
+{
+    /// <summary>
+    /// The default priority
+    /// </summary>
+    public const int DefaultPriority = 0;
+
+    /// <summary>
+    /// The high priority, the same as FStreamableManager::AsyncLoadHighPriority
+    /// </summary>
+    public const int HighPriority = 100;
+
+    /// <summary>
+    /// Class PendingRequest.
+    /// </summary>
+    private class PendingRequest
+    {
+        /// <summary>
+        /// The identifier
+        /// </summary>
+        public int Id;
+        /// <summary>
+        /// The count of requested objects
+        /// </summary>
+        public int Count;
+        /// <summary>
+        /// The completion source
+        /// </summary>
+        public readonly TaskCompletionSource<UObject?[]> CompletionSource = new();
+        /// <summary>
+        /// The cancellation registration
+        /// </summary>
+        public CancellationTokenRegistration Registration;
+    }
+
+    /// <summary>
+    /// The pending requests, only accessed on the game thread
+    /// </summary>
+    private static readonly Dictionary<int, PendingRequest> PendingRequests = new();
+
+    /// <summary>
+    /// Gets the count of pending requests made by C#.
+    /// </summary>
+    /// <value>The pending count.</value>
+    public static int PendingCount => PendingRequests.Count;
+
+    /// <summary>
+    /// Loads the soft object pointers asynchronously.
+    /// </summary>
+    /// <param name="addressesOfSoftObjectPtr">The addresses of soft object PTR.</param>
+    /// <param name="priority">The priority, higher is loaded first.</param>
+    /// <param name="cancellationToken">The cancellation token, cancel it on the game thread to stop loading.</param>
+    /// <returns>loaded objects in the order of soft object pointers, null for the ones failed to load.</returns>
+    public static unsafe Task<UObject?[]> LoadAsync(ReadOnlySpan<IntPtr> addressesOfSoftObjectPtr, int priority = DefaultPriority, CancellationToken cancellationToken = default)
+    {
+        if (cancellationToken.IsCancellationRequested)
+        {
+            return Task.FromCanceled<UObject?[]>(cancellationToken);
+        }
+
+        int requestId;
+
+        fixed (IntPtr* addressesPtr = addressesOfSoftObjectPtr)
+        {
+            requestId = SoftObjectPtrInteropUtils.RequestAsyncLoadSoftObjectPtrs(addressesPtr, addressesOfSoftObjectPtr.Length, priority);
+        }
+
+        if (requestId == 0)
+        {
+            return Task.FromResult(new UObject?[addressesOfSoftObjectPtr.Length]);
+        }
+
+        var request = new PendingRequest
+        {
+            Id = requestId,
+            Count = addressesOfSoftObjectPtr.Length
+        };
+
+        // objects are loaded already, the completion notification is sent before the request is recorded
+        if (SoftObjectPtrInteropUtils.GetAsyncLoadState(requestId, out _) == EAsyncLoadState.Completed)
+        {
+            Complete(request);
+
+            return request.CompletionSource.Task;
+        }
+
+        PendingRequests.Add(requestId, request);
+
+        if (cancellationToken.CanBeCanceled)
+        {
+            request.Registration = cancellationToken.Register(() => Cancel(request, cancellationToken));
+        }
+
+        return request.CompletionSource.Task;
+    }
+
+    /// <summary>
+    /// Loads the soft object pointers asynchronously.
+    /// </summary>
+    /// <typeparam name="T"></typeparam>
+    /// <param name="softObjectPtrs">The soft object PTRs.</param>
+    /// <param name="priority">The priority.</param>
+    /// <param name="cancellationToken">The cancellation token.</param>
+    /// <returns>T?[].</returns>
+    public static async Task<T?[]> LoadAsync<T>(IReadOnlyList<TSoftObjectPtr<T>> softObjectPtrs, int priority = DefaultPriority, CancellationToken cancellationToken = default)
+        where T : UObject
+    {
+        var addresses = new IntPtr[softObjectPtrs.Count];
+
+        for (var i = 0; i < addresses.Length; ++i)
+        {
+            addresses[i] = softObjectPtrs[i].GetNativePtr();
+        }
+
+        var objects = await LoadAsync(addresses, priority, cancellationToken);
+
+        return Array.ConvertAll(objects, x => x as T);
+    }
+
+    /// <summary>
+    /// Gets the statistics of all asynchronous loads requested by C#.
+    /// </summary>
+    /// <returns>FCSharpAsyncLoadStatistics.</returns>
+    public static FCSharpAsyncLoadStatistics GetStatistics()
+    {
+        return SoftObjectPtrInteropUtils.GetAsyncLoadStatistics();
+    }
+
+    /// <summary>
+    /// Called by C++ when a request is completed.
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    // ReSharper disable once UnusedMember.Local
+    private static void OnAsyncLoadCompleted(int requestId)
+    {
+        if (PendingRequests.Remove(requestId, out var request))
+        {
+            Complete(request);
+        }
+    }
+
+    /// <summary>
+    /// Called by C++ when all requests are canceled and released, eg: the PIE session is ended.
+    /// </summary>
+    // ReSharper disable once UnusedMember.Local
+    private static void OnAllAsyncLoadsCanceled()
+    {
+        if (PendingRequests.Count == 0)
+        {
+            return;
+        }
+
+        // continuations may make new requests
+        var requests = PendingRequests.Values.ToArray();
+        PendingRequests.Clear();
+
+        foreach (var request in requests)
+        {
+            request.Registration.Dispose();
+            request.CompletionSource.TrySetCanceled();
+        }
+    }
+
+    /// <summary>
+    /// Takes the loaded objects and releases the request.
+    /// </summary>
+    /// <param name="request">The request.</param>
+    private static unsafe void Complete(PendingRequest request)
+    {
+        var result = new UObject?[request.Count];
+        var buffer = request.Count <= 256 ? stackalloc IntPtr[request.Count] : new IntPtr[request.Count];
+
+        fixed (IntPtr* bufferPtr = buffer)
+        {
+            SoftObjectPtrInteropUtils.GetAsyncLoadedObjects(request.Id, bufferPtr, request.Count);
+        }
+
+        SoftObjectPtrInteropUtils.ReleaseAsyncLoad(request.Id);
+        request.Registration.Dispose();
+
+        for (var i = 0; i < result.Length; ++i)
+        {
+            result[i] = ObjectInteropUtils.GetCSharpObjectOfUnrealObject(buffer[i]);
+        }
+
+        request.CompletionSource.TrySetResult(result);
+    }
+
+    /// <summary>
+    /// Cancels the specified request.
+    /// </summary>
+    /// <param name="request">The request.</param>
+    /// <param name="cancellationToken">The cancellation token.</param>
+    private static void Cancel(PendingRequest request, CancellationToken cancellationToken)
+    {
+        // C++ can only be called on the game thread, 
+        // if it is canceled on other threads, the task is canceled and the request is released when it is completed.
+        if (UnrealSharpEntry.IsInGameThread && PendingRequests.Remove(request.Id))
+        {
+            SoftObjectPtrInteropUtils.ReleaseAsyncLoad(request.Id);
+        }
+        else
+        {
+            Logger.LogWarning("Async load {0} is canceled on a worker thread, it is released when loaded.", request.Id);
+        }
+
+        request.CompletionSource.TrySetCanceled(cancellationToken);
+    }
+}
@@ -237,6 +237,24 @@ public class TSoftObjectPtr<T> : ISoftObjectPtr
         }
     }
 
+    /// <summary>
+    /// Load the asset object represented by this asset ptr without blocking the game thread, see AsyncLoadManager
+    /// </summary>
+    /// <param name="priority">The priority, higher is loaded first.</param>
+    /// <param name="cancellationToken">The cancellation token.</param>
+    /// <returns>loaded object, null if failed to load.</returns>
+    public async Task<T?> LoadAsync(int priority = AsyncLoadManager.DefaultPriority, CancellationToken cancellationToken = default)
+    {
+        if (!IsBindingToUnreal)
+        {
+            return null;
+        }
+
+        var objects = await AsyncLoadManager.LoadAsync(new[] { _nativePtr }, priority, cancellationToken);
+
+        return objects[0] as T;
+    }
+
     /// <summary>
     /// Returns the StringObjectPath that is wrapped by this TSoftObjectPtr
     /// </summary>
@@ -405,6 +423,24 @@ public class TSoftClassPtr<T> : ISoftClassPtr
         return unrealObjectPtr == IntPtr.Zero ? null : new UClass(unrealObjectPtr);
     }
 
+    /// <summary>
+    /// Load the soft class without blocking the game thread, see AsyncLoadManager
+    /// </summary>
+    /// <param name="priority">The priority, higher is loaded first.</param>
+    /// <param name="cancellationToken">The cancellation token.</param>
+    /// <returns>loaded class, null if failed to load.</returns>
+    public async Task<UClass?> LoadAsync(int priority = AsyncLoadManager.DefaultPriority, CancellationToken cancellationToken = default)
+    {
+        if (!_softObjectPtr.IsBindingToUnreal)
+        {
+            return null;
+        }
+
+        var objects = await AsyncLoadManager.LoadAsync(new[] { _softObjectPtr.GetNativePtr() }, priority, cancellationToken);
+
+        return objects[0] as UClass;
+    }
+
     /// <summary>
     /// Returns true if ... is valid.
     /// </summary>
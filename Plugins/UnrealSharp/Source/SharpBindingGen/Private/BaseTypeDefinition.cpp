@@ -24,6 +24,7 @@
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
 #include "BaseTypeDefinition.h"
+#include "TypeDatabaseFile.h"
 #include "Misc/UnrealSharpUtils.h"
 #include <inttypes.h>
 
@@ -140,6 +141,18 @@ namespace UnrealSharp
         Meta.Read(InObject);
     }
 
+    void FBaseTypeDefinition::Serialize(FTypeDatabaseArchive& InArchive)
+    {
+        // only used by C# tool
+        int32 ExportFlags = 0;
+
+        InArchive << Type;
+        InArchive << Name << CppName << PathName << PackageName << ProjectName << Namespace << AssemblyName << CSharpFullName;
+        InArchive << Flags << CrcCode << ExportFlags << Guid << Size;
+
+        Meta.Serialize(InArchive);
+    }
+
     FString FBaseTypeDefinition::GetCppTypeName(const UField* InField)
     {
         return FUnrealSharpUtils::GetCppTypeName(InField);
@@ -24,6 +24,7 @@
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
 #include "ClassTypeDefinition.h"
+#include "TypeDatabaseFile.h"
 #include "Misc/UnrealSharpLog.h"
 
 namespace UnrealSharp
@@ -35,6 +36,11 @@ namespace UnrealSharp
     }
 
     FClassTypeDefinition::FClassTypeDefinition(UClass* InClass, FTypeValidation* InTypeValidation) :
+        FClassTypeDefinition(InClass, InTypeValidation, ExportDefaultValueTexts(InClass))
+    {
+    }
+
+    FClassTypeDefinition::FClassTypeDefinition(UClass* InClass, FTypeValidation* InTypeValidation, const FDefaultValueTextMap& InDefaultValueTexts) :
         Super(InClass, InTypeValidation)
     {
         Type = InClass->IsChildOf<UInterface>() ? static_cast<int>(EDefinitionType::Interface) : static_cast<int>(EDefinitionType::Class);
@@ -47,7 +53,7 @@ namespace UnrealSharp
         SuperName = InClass->GetSuperClass() ? GetCppTypeName(InClass->GetSuperClass()) : TEXT("UObject");
         Flags = InClass->ClassFlags;
 
-        LoadProperties(InClass, InClass->GetDefaultObject(), static_cast<EFieldIterationFlags>(EFieldIteratorFlags::ExcludeSuper), InTypeValidation, [US_LAMBDA_CAPTURE_THIS](FProperty* InProperty) {
+        LoadProperties(InClass, &InDefaultValueTexts, static_cast<EFieldIterationFlags>(EFieldIteratorFlags::ExcludeSuper), InTypeValidation, [US_LAMBDA_CAPTURE_THIS](FProperty* InProperty) {
             return IsSupportedProperty(InProperty, InTypeValidation);
             });
 
@@ -56,6 +62,11 @@ namespace UnrealSharp
         LoadInterfaces(InClass);
     }
 
+    FDefaultValueTextMap FClassTypeDefinition::ExportDefaultValueTexts(UClass* InClass)
+    {
+        return FStructTypeDefinition::ExportDefaultValueTexts(InClass, InClass->GetDefaultObject(), static_cast<EFieldIterationFlags>(EFieldIteratorFlags::ExcludeSuper));
+    }
+
     void FClassTypeDefinition::LoadFunctions(UClass* InClass, FTypeValidation* InTypeValidation)
     {
         for (TFieldIterator<UFunction> FunctionIterator(InClass, EFieldIteratorFlags::ExcludeSuper); FunctionIterator; ++FunctionIterator)
@@ -186,6 +197,37 @@ namespace UnrealSharp
         }
     }
 
+    void FClassTypeDefinition::Serialize(FTypeDatabaseArchive& InArchive)
+    {
+        Super::Serialize(InArchive);
+
+        InArchive << SuperName << ConfigName;
+
+        const int32 NumFunctions = InArchive.SerializeNum(Functions.Num());
+
+        if (InArchive.IsLoading())
+        {
+            Functions.SetNum(NumFunctions);
+        }
+
+        for (auto& Function : Functions)
+        {
+            Function.Serialize(InArchive);
+        }
+
+        const int32 NumInterfaces = InArchive.SerializeNum(Interfaces.Num());
+
+        if (InArchive.IsLoading())
+        {
+            Interfaces.SetNum(NumInterfaces);
+        }
+
+        for (auto& InterfaceName : Interfaces)
+        {
+            InArchive << InterfaceName;
+        }
+    }
+
     void FClassTypeDefinition::AddDependNamespace(const UFunction* InFunction)
     {
         for (TFieldIterator<FProperty> PropertyIter(InFunction); PropertyIter; ++PropertyIter)
@@ -24,6 +24,7 @@
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
 #include "EnumTypeDefinition.h"
+#include "TypeDatabaseFile.h"
 
 namespace UnrealSharp
 {
@@ -39,6 +40,11 @@ namespace UnrealSharp
         Value = InObject.GetNumberField(TEXT("Value"));
     }
 
+    void FEnumFieldDefinition::Serialize(FTypeDatabaseArchive& InArchive)
+    {
+        InArchive << Name << Value;
+    }
+
     FEnumTypeDefinition::FEnumTypeDefinition()
     {
         Type = static_cast<int>(EDefinitionType::Enum);
@@ -113,4 +119,21 @@ namespace UnrealSharp
             }
         }
     }
+
+    void FEnumTypeDefinition::Serialize(FTypeDatabaseArchive& InArchive)
+    {
+        Super::Serialize(InArchive);
+
+        const int32 NumFields = InArchive.SerializeNum(Fields.Num());
+
+        if (InArchive.IsLoading())
+        {
+            Fields.SetNum(NumFields);
+        }
+
+        for (auto& Field : Fields)
+        {
+            Field.Serialize(InArchive);
+        }
+    }
 }
@@ -24,6 +24,7 @@
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
 #include "FunctionTypeDefinition.h"
+#include "TypeDatabaseFile.h"
 #include "Misc/UnrealSharpUtils.h"
 #include "Misc/UnrealSharpLog.h"
 
@@ -67,6 +68,13 @@ namespace UnrealSharp
         InObject.TryGetStringField(TEXT("Signature"), Signature);
     }
 
+    void FFunctionTypeDefinition::Serialize(FTypeDatabaseArchive& InArchive)
+    {
+        Super::Serialize(InArchive);
+
+        InArchive << bIsOverrideFunction << Signature;
+    }
+
     bool FFunctionTypeDefinition::IsExportAsEvent() const
     {
         if ((Flags & FUNC_Event) != 0 ||
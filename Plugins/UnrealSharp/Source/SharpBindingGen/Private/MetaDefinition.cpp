@@ -24,6 +24,7 @@
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
 #include "MetaDefinition.h"
+#include "TypeDatabaseFile.h"
 
 namespace UnrealSharp
 {
@@ -63,6 +64,32 @@ namespace UnrealSharp
         }        
     }
 
+    void FMetaDefinition::Serialize(FTypeDatabaseArchive& InArchive)
+    {
+        const int32 Num = InArchive.SerializeNum(Metas.Num());
+
+        if (InArchive.IsLoading())
+        {
+            Metas.Empty(Num);
+
+            for (int32 i = 0; i < Num; ++i)
+            {
+                FString Key, Value;
+                InArchive << Key << Value;
+
+                Metas.Add(Key, Value);
+            }
+        }
+        else
+        {
+            for (auto& Pair : Metas)
+            {
+                FString Key = Pair.Key;
+                InArchive << Key << Pair.Value;
+            }
+        }
+    }
+
     void FMetaDefinition::Reset()
     {
         Metas.Empty();
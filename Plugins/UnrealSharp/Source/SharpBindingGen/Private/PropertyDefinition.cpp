@@ -26,6 +26,7 @@
 #include "PropertyDefinition.h"
 #include <inttypes.h>
 #include "FunctionTypeDefinition.h"
+#include "TypeDatabaseFile.h"
 #include "Misc/UnrealSharpUtils.h"
 
 namespace UnrealSharp
@@ -34,7 +35,8 @@ namespace UnrealSharp
     {
     }
 
-    FPropertyDefinition::FPropertyDefinition(UStruct* InStruct, const void* InDefaultObjectPtr, FProperty* InProperty, FTypeValidation* InTypeValidation)
+    FPropertyDefinition::FPropertyDefinition(UStruct* InStruct, const FString& InDefaultValue, FProperty* InProperty, FTypeValidation* InTypeValidation) :
+        DefaultValue(InDefaultValue)
     {
         TypeName = CppTypeName = InProperty->GetCPPType();         
         TypeClass = InProperty->GetClass()->GetName();
@@ -42,11 +44,6 @@ namespace UnrealSharp
         Offset = InProperty->GetOffset_ReplaceWith_ContainerPtrToValuePtr();
         PropertyFlags = static_cast<uint64>(InProperty->GetPropertyFlags());
         Size = InProperty->GetSize();
-
-        if (InDefaultObjectPtr != nullptr)
-        {
-            InProperty->ExportText_InContainer(0, DefaultValue, InDefaultObjectPtr, InDefaultObjectPtr, nullptr, PPF_None);
-        }
                         
         if (InProperty->IsA<FStructProperty>() ||
             InProperty->IsA<FObjectProperty>() ||
@@ -98,14 +95,14 @@ namespace UnrealSharp
             FProperty* Property = ArrayProperty->Inner;
             check(Property != nullptr);
 
-            InnerProperties.Add(MakeShared<FPropertyDefinition>(InStruct, nullptr, Property, InTypeValidation));
+            InnerProperties.Add(MakeShared<FPropertyDefinition>(InStruct, FString(), Property, InTypeValidation));
         }
         else if (const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty))
         {
             FProperty* Property = SetProperty->ElementProp;
             check(Property != nullptr);
 
-            InnerProperties.Add(MakeShared<FPropertyDefinition>(InStruct, nullptr, Property, InTypeValidation));
+            InnerProperties.Add(MakeShared<FPropertyDefinition>(InStruct, FString(), Property, InTypeValidation));
         }
         else if (const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty))
         {
@@ -114,8 +111,8 @@ namespace UnrealSharp
             check(KeyProperty != nullptr);
             check(ValueProperty != nullptr);
 
-            InnerProperties.Add(MakeShared<FPropertyDefinition>(InStruct, nullptr, KeyProperty, InTypeValidation));
-            InnerProperties.Add(MakeShared<FPropertyDefinition>(InStruct, nullptr, ValueProperty, InTypeValidation));
+            InnerProperties.Add(MakeShared<FPropertyDefinition>(InStruct, FString(), KeyProperty, InTypeValidation));
+            InnerProperties.Add(MakeShared<FPropertyDefinition>(InStruct, FString(), ValueProperty, InTypeValidation));
         }
         else if (FDelegateProperty* DelegateProperty = CastField<FDelegateProperty>(InProperty))
         {
@@ -235,6 +232,58 @@ namespace UnrealSharp
         
         Metas.Read(InObject);
 
+        ReadMetaFields();
+    }
+
+    void FPropertyDefinition::Serialize(FTypeDatabaseArchive& InArchive)
+    {
+        InArchive << CppTypeName << TypeName << TypeClass << Name << ClassPath << DefaultValue << MetaClass;
+        InArchive << Offset << PropertyFlags << Size << FieldMask;
+
+        int32 ReferenceTypeValue = static_cast<int32>(ReferenceType);
+        InArchive << ReferenceTypeValue << Guid;
+        ReferenceType = static_cast<EReferenceType>(ReferenceTypeValue);
+
+        Metas.Serialize(InArchive);
+
+        const int32 NumInnerProperties = InArchive.SerializeNum(InnerProperties.Num());
+
+        if (InArchive.IsLoading())
+        {
+            InnerProperties.Empty(NumInnerProperties);
+
+            for (int32 i = 0; i < NumInnerProperties; ++i)
+            {
+                InnerProperties.Add(MakeShared<FPropertyDefinition>());
+            }
+        }
+
+        for (const auto& Property : InnerProperties)
+        {
+            Property->Serialize(InArchive);
+        }
+
+        bool bHasSignatureFunction = SignatureFunction.IsValid();
+        InArchive << bHasSignatureFunction;
+
+        if (bHasSignatureFunction)
+        {
+            if (InArchive.IsLoading())
+            {
+                SignatureFunction = MakeShared<FFunctionTypeDefinition>();
+            }
+
+            SignatureFunction->Serialize(InArchive);
+        }
+
+        if (InArchive.IsLoading())
+        {
+            ReadMetaFields();
+        }
+    }
+
+    void FPropertyDefinition::ReadMetaFields()
+    {
         Metas.TryGetMeta(TEXT("IsActorComponent"), bIsActorComponent);
         Metas.TryGetMeta(TEXT("AttachToComponentName"), AttachToComponentName);
         Metas.TryGetMeta(TEXT("AttachToSocketName"), AttachToSocketName);
@@ -35,12 +35,24 @@ namespace UnrealSharp
     }
 
     FScriptStructTypeDefinition::FScriptStructTypeDefinition(UScriptStruct* InStruct, FTypeValidation* InTypeValidation) :
+        FScriptStructTypeDefinition(InStruct, InTypeValidation, ExportDefaultValueTexts(InStruct))
+    {
+    }
+
+    FScriptStructTypeDefinition::FScriptStructTypeDefinition(UScriptStruct* InStruct, FTypeValidation* InTypeValidation, const FDefaultValueTextMap& InDefaultValueTexts) :
         Super(InStruct, InTypeValidation)
     {
         Type = static_cast<int>(EDefinitionType::Struct);
         Flags = InStruct->StructFlags;
 
-        void* StructInstance = FMemory::Malloc(InStruct->GetStructureSize());
+        LoadProperties(InStruct, &InDefaultValueTexts, EFieldIterationFlags::IncludeSuper, InTypeValidation, [US_LAMBDA_CAPTURE_THIS](FProperty* InProperty) {
+            return IsSupportedProperty(InProperty, InTypeValidation);
+            });
+    }
+
+    FDefaultValueTextMap FScriptStructTypeDefinition::ExportDefaultValueTexts(UScriptStruct* InStruct)
+    {
+        void* StructInstance = FMemory::Malloc(InStruct->GetStructureSize(), InStruct->GetMinAlignment());
         InStruct->InitializeDefaultValue(static_cast<uint8*>(StructInstance));
 
         US_SCOPED_EXIT(
@@ -48,9 +60,7 @@ namespace UnrealSharp
             FMemory::Free(StructInstance);
         );
 
-        LoadProperties(InStruct, StructInstance, EFieldIterationFlags::IncludeSuper, InTypeValidation, [US_LAMBDA_CAPTURE_THIS](FProperty* InProperty) {
-            return IsSupportedProperty(InProperty, InTypeValidation);
-            });
+        return FStructTypeDefinition::ExportDefaultValueTexts(InStruct, StructInstance, EFieldIterationFlags::IncludeSuper);
     }
 
     void FScriptStructTypeDefinition::Write(FJsonObject& InObject)
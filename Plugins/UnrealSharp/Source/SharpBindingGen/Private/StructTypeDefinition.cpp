@@ -25,6 +25,7 @@
 */
 #include "StructTypeDefinition.h"
 #include "TypeValidation.h"
+#include "TypeDatabaseFile.h"
 #include "Misc/UnrealSharpUtils.h"
 
 namespace UnrealSharp
@@ -38,19 +39,36 @@ namespace UnrealSharp
     {
     }
 
-    void FStructTypeDefinition::LoadProperties(UStruct* InStruct, const void* InDefaultObjectPtr, const EFieldIterationFlags InFlags, FTypeValidation* InTypeValidation, const TFunction<bool(FProperty*)>& InAccessFunc)
+    void FStructTypeDefinition::LoadProperties(UStruct* InStruct, const FDefaultValueTextMap* InDefaultValueTexts, const EFieldIterationFlags InFlags, FTypeValidation* InTypeValidation, const TFunction<bool(FProperty*)>& InAccessFunc)
     {
         for (TFieldIterator<FProperty> PropertyIter(InStruct, InFlags); PropertyIter; ++PropertyIter)
         {
             if (InAccessFunc(*PropertyIter))
             {
-                Properties.Add(FPropertyDefinition(InStruct, InDefaultObjectPtr, *PropertyIter, InTypeValidation));
+                const FString* DefaultValue = InDefaultValueTexts != nullptr ? InDefaultValueTexts->Find(*PropertyIter) : nullptr;
+
+                Properties.Add(FPropertyDefinition(InStruct, DefaultValue != nullptr ? *DefaultValue : FString(), *PropertyIter, InTypeValidation));
 
                 AddDependNamespace(*PropertyIter);
             }
         }
     }
 
+    FDefaultValueTextMap FStructTypeDefinition::ExportDefaultValueTexts(UStruct* InStruct, const void* InDefaultObjectPtr, const EFieldIterationFlags InFlags)
+    {
+        check(IsInGameThread());
+
+        FDefaultValueTextMap Texts;
+
+        for (TFieldIterator<FProperty> PropertyIter(InStruct, InFlags); PropertyIter; ++PropertyIter)
+        {
+            FString& Text = Texts.Add(*PropertyIter);
+            PropertyIter->ExportText_InContainer(0, Text, InDefaultObjectPtr, InDefaultObjectPtr, nullptr, PPF_None);
+        }
+
+        return Texts;
+    }
+
     void FStructTypeDefinition::Write(FJsonObject& InObject)
     {
         Super::Write(InObject);
@@ -99,6 +117,46 @@ namespace UnrealSharp
         }        
     }
 
+    void FStructTypeDefinition::Serialize(FTypeDatabaseArchive& InArchive)
+    {
+        Super::Serialize(InArchive);
+
+        const int32 NumProperties = InArchive.SerializeNum(Properties.Num());
+
+        if (InArchive.IsLoading())
+        {
+            Properties.SetNum(NumProperties);
+        }
+
+        for (auto& Property : Properties)
+        {
+            Property.Serialize(InArchive);
+        }
+
+        const int32 NumNamespaces = InArchive.SerializeNum(DependNamespaces.Num());
+
+        if (InArchive.IsLoading())
+        {
+            DependNamespaces.Empty(NumNamespaces);
+
+            for (int32 i = 0; i < NumNamespaces; ++i)
+            {
+                FString Namespace;
+                InArchive << Namespace;
+
+                DependNamespaces.Add(Namespace, 0);
+            }
+        }
+        else
+        {
+            for (auto& Pair : DependNamespaces)
+            {
+                FString Namespace = Pair.Key;
+                InArchive << Namespace;
+            }
+        }
+    }
+
     bool FStructTypeDefinition::IsSupportedFunction(UFunction* InFunction, FTypeValidation* InTypeValidation)
     {
         // skip editor only functions...
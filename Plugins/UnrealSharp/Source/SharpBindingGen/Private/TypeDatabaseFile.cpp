@@ -0,0 +1,541 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "TypeDatabaseFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/UnrealSharpLog.h"
+
+namespace UnrealSharp
+{
+    static int32 CompareUtf8Strings(const ANSICHAR* InLeft, uint32 InLeftLength, const ANSICHAR* InRight, uint32 InRightLength)
+    {
+        if (const int32 Result = FMemory::Memcmp(InLeft, InRight, FMath::Min(InLeftLength, InRightLength)); Result != 0)
+        {
+            return Result;
+        }
+
+        return InLeftLength < InRightLength ? -1 : (InLeftLength > InRightLength ? 1 : 0);
+    }
+
+    // write records to memory, strings are added to the string table of the file writer
+    class FTypeDatabaseRecordWriter : public FTypeDatabaseArchive
+    {
+    public:
+        FTypeDatabaseRecordWriter(FTypeDatabaseFileWriter& InFileWriter, TArray<uint8>& InBytes) :
+            FileWriter(InFileWriter),
+            Bytes(InBytes)
+        {
+            bIsLoading = false;
+        }
+
+        virtual void Serialize(void* InData, int64 InLength) override
+        {
+            Bytes.Append(static_cast<const uint8*>(InData), static_cast<int32>(InLength));
+        }
+
+        virtual void SerializeString(FString& InValue) override
+        {
+            uint32 Index = FileWriter.AddString(InValue);
+
+            Serialize(&Index, sizeof(Index));
+        }
+
+    private:
+        FTypeDatabaseFileWriter&        FileWriter;
+        TArray<uint8>&                  Bytes;
+    };
+
+    // read one record of a mapped type database file, never read beyond this record
+    class FTypeDatabaseRecordReader : public FTypeDatabaseArchive
+    {
+    public:
+        FTypeDatabaseRecordReader(const FTypeDatabaseFile& InFile, const uint8* InData, int64 InSize) :
+            File(InFile),
+            Data(InData),
+            Size(InSize)
+        {
+            bIsLoading = true;
+        }
+
+        virtual void Serialize(void* InData, int64 InLength) override
+        {
+            if (bIsError || InLength > Size - Position)
+            {
+                bIsError = true;
+                FMemory::Memzero(InData, InLength);
+                return;
+            }
+
+            FMemory::Memcpy(InData, Data + Position, InLength);
+            Position += InLength;
+        }
+
+        virtual void SerializeString(FString& InValue) override
+        {
+            uint32 Index = FTypeDatabaseFile::NullStringIndex;
+            Serialize(&Index, sizeof(Index));
+
+            InValue = File.GetString(Index);
+        }
+
+        virtual int32 SerializeNum(int32 InNum) override
+        {
+            const int32 Num = FTypeDatabaseArchive::SerializeNum(InNum);
+
+            // every element takes one byte at least, so a bad count can't make us allocate huge arrays
+            if (Num > Size - Position)
+            {
+                bIsError = true;
+                return 0;
+            }
+
+            return Num;
+        }
+
+    private:
+        const FTypeDatabaseFile&        File;
+        const uint8*                    Data;
+        int64                           Size;
+        int64                           Position = 0;
+    };
+
+    int32 FTypeDatabaseArchive::SerializeNum(int32 InNum)
+    {
+        int32 Num = InNum;
+        *this << Num;
+
+        if (bIsError || Num < 0)
+        {
+            bIsError = true;
+            return 0;
+        }
+
+        return Num;
+    }
+
+    FTypeDatabaseArchive& FTypeDatabaseArchive::operator<<(bool& InValue)
+    {
+        uint8 Value = InValue ? 1 : 0;
+        *this << Value;
+
+        InValue = Value != 0;
+
+        return *this;
+    }
+
+    FTypeDatabaseArchive& FTypeDatabaseArchive::operator<<(FGuid& InValue)
+    {
+        // same as json document, C# tool use guid string
+        FString Text = !IsLoading() && InValue.IsValid() ? InValue.ToString(EGuidFormats::DigitsWithHyphensLower) : FString();
+        SerializeString(Text);
+
+        if (IsLoading())
+        {
+            InValue.Invalidate();
+
+            if (!Text.IsEmpty())
+            {
+                FGuid::Parse(Text, InValue);
+            }
+        }
+
+        return *this;
+    }
+
+    FTypeDatabaseFileWriter::FTypeDatabaseFileWriter(int32 InUnrealMajorVersion, int32 InUnrealMinorVersion, int32 InUnrealPatchVersion, int32 InDocumentAttributes)
+    {
+        FMemory::Memzero(Header);
+
+        Header.Magic = FTypeDatabaseFile::FileMagic;
+        Header.Version = FTypeDatabaseFile::FileVersion;
+        Header.UnrealMajorVersion = InUnrealMajorVersion;
+        Header.UnrealMinorVersion = InUnrealMinorVersion;
+        Header.UnrealPatchVersion = InUnrealPatchVersion;
+        Header.DocumentAttributes = InDocumentAttributes;
+    }
+
+    uint32 FTypeDatabaseFileWriter::AddString(const FString& InValue)
+    {
+        if (const uint32* Index = StringIndices.Find(InValue))
+        {
+            return *Index;
+        }
+
+        const FTCHARToUTF8 Converter(*InValue);
+
+        TArray<ANSICHAR>& Utf8String = Strings.AddDefaulted_GetRef();
+        Utf8String.Append(reinterpret_cast<const ANSICHAR*>(Converter.Get()), Converter.Length());
+
+        const uint32 Index = static_cast<uint32>(Strings.Num() - 1);
+        StringIndices.Add(InValue, Index);
+
+        return Index;
+    }
+
+    void FTypeDatabaseFileWriter::AddType(FBaseTypeDefinition& InDefinition)
+    {
+        FTypeDatabaseIndexEntry& Entry = IndexEntries.AddDefaulted_GetRef();
+        Entry.CppName = AddString(InDefinition.CppName);
+        Entry.Type = static_cast<int32>(InDefinition.GetDefinitionType());
+        Entry.RecordOffset = static_cast<uint32>(RecordData.Num());
+
+        FTypeDatabaseRecordWriter Writer(*this, RecordData);
+        InDefinition.Serialize(Writer);
+
+        Entry.RecordSize = static_cast<uint32>(RecordData.Num()) - Entry.RecordOffset;
+    }
+
+    void FTypeDatabaseFileWriter::SetStringList(ETypeDatabaseStringList InList, const TSet<FString>& InStrings)
+    {
+        TArray<uint32>& List = StringLists[static_cast<int>(InList)];
+        List.Reset(InStrings.Num());
+
+        for (const FString& String : InStrings)
+        {
+            List.Add(AddString(String));
+        }
+    }
+
+    bool FTypeDatabaseFileWriter::SaveToFile(const TCHAR* InFilePath) const
+    {
+        TArray<uint8> Bytes;
+        Bytes.Reserve(sizeof(FTypeDatabaseHeader) + IndexEntries.Num() * sizeof(FTypeDatabaseIndexEntry) + RecordData.Num());
+
+        auto Append = [&Bytes](const void* InData, int64 InLength) {
+            Bytes.Append(static_cast<const uint8*>(InData), static_cast<int32>(InLength));
+        };
+
+        auto PadToAlignment = [&Bytes]() {
+            Bytes.AddZeroed(Align(Bytes.Num(), 4) - Bytes.Num());
+        };
+
+        FTypeDatabaseHeader FileHeader = Header;
+        Bytes.AddZeroed(sizeof(FTypeDatabaseHeader));
+
+        // sort by utf8 bytes, it is the same order as C# tool
+        TArray<FTypeDatabaseIndexEntry> SortedEntries = IndexEntries;
+        SortedEntries.Sort([this](const FTypeDatabaseIndexEntry& InLeft, const FTypeDatabaseIndexEntry& InRight) {
+            const TArray<ANSICHAR>& Left = Strings[InLeft.CppName];
+            const TArray<ANSICHAR>& Right = Strings[InRight.CppName];
+
+            return CompareUtf8Strings(Left.GetData(), Left.Num(), Right.GetData(), Right.Num()) < 0;
+        });
+
+        const uint32 TypeIndexSize = static_cast<uint32>(SortedEntries.Num() * sizeof(FTypeDatabaseIndexEntry));
+        uint32 StringListSize = 0;
+
+        for (const TArray<uint32>& List : StringLists)
+        {
+            StringListSize += static_cast<uint32>(sizeof(uint32) + List.Num() * sizeof(uint32));
+        }
+
+        FileHeader.TypeCount = static_cast<uint32>(SortedEntries.Num());
+        FileHeader.TypeIndexOffset = static_cast<uint32>(Bytes.Num());
+        FileHeader.StringListOffset = FileHeader.TypeIndexOffset + TypeIndexSize;
+
+        const uint32 RecordOffset = FileHeader.StringListOffset + StringListSize;
+
+        for (FTypeDatabaseIndexEntry Entry : SortedEntries)
+        {
+            Entry.RecordOffset += RecordOffset;
+            Append(&Entry, sizeof(Entry));
+        }
+
+        for (const TArray<uint32>& List : StringLists)
+        {
+            const uint32 Num = List.Num();
+            Append(&Num, sizeof(Num));
+            Append(List.GetData(), List.Num() * sizeof(uint32));
+        }
+
+        check(static_cast<uint32>(Bytes.Num()) == RecordOffset);
+        Append(RecordData.GetData(), RecordData.Num());
+        PadToAlignment();
+
+        FileHeader.StringCount = static_cast<uint32>(Strings.Num());
+        FileHeader.StringTableOffset = static_cast<uint32>(Bytes.Num());
+
+        uint32 StringDataOffset = FileHeader.StringTableOffset + static_cast<uint32>(Strings.Num() * sizeof(FTypeDatabaseStringEntry));
+
+        for (const TArray<ANSICHAR>& String : Strings)
+        {
+            const FTypeDatabaseStringEntry Entry = { StringDataOffset, static_cast<uint32>(String.Num()) };
+            Append(&Entry, sizeof(Entry));
+
+            StringDataOffset += String.Num() + 1;
+        }
+
+        for (const TArray<ANSICHAR>& String : Strings)
+        {
+            Append(String.GetData(), String.Num());
+            Bytes.Add(0);
+        }
+
+        FMemory::Memcpy(Bytes.GetData(), &FileHeader, sizeof(FileHeader));
+
+        return FFileHelper::SaveArrayToFile(Bytes, InFilePath);
+    }
+
+    FTypeDatabaseFile::FTypeDatabaseFile()
+    {
+    }
+
+    FTypeDatabaseFile::~FTypeDatabaseFile()
+    {
+        Close();
+    }
+
+    bool FTypeDatabaseFile::IsTypeDatabaseFile(const TCHAR* InFilePath)
+    {
+        const TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(InFilePath));
+
+        uint32 Magic = 0;
+
+        return FileHandle && FileHandle->Read(reinterpret_cast<uint8*>(&Magic), sizeof(Magic)) && Magic == FileMagic;
+    }
+
+    bool FTypeDatabaseFile::Open(const TCHAR* InFilePath)
+    {
+        Close();
+
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+        MappedHandle.Reset(PlatformFile.OpenMapped(InFilePath));
+
+        if (MappedHandle && MappedHandle->GetFileSize() > 0)
+        {
+            MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+        }
+
+        if (MappedRegion)
+        {
+            Data = MappedRegion->GetMappedPtr();
+            DataSize = MappedRegion->GetMappedSize();
+        }
+        else
+        {
+            MappedHandle.Reset();
+
+            if (!FFileHelper::LoadFileToArray(FileData, InFilePath))
+            {
+                return false;
+            }
+
+            Data = FileData.GetData();
+            DataSize = FileData.Num();
+        }
+
+        if (!ValidateHeader())
+        {
+            US_LOG_ERROR(TEXT("%s is not a valid type database file or the version is not supported."), InFilePath);
+
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void FTypeDatabaseFile::Close()
+    {
+        MappedRegion.Reset();
+        MappedHandle.Reset();
+        FileData.Empty();
+
+        Data = nullptr;
+        DataSize = 0;
+    }
+
+    bool FTypeDatabaseFile::ValidateHeader() const
+    {
+        if (Data == nullptr || DataSize < static_cast<int64>(sizeof(FTypeDatabaseHeader)))
+        {
+            return false;
+        }
+
+        const FTypeDatabaseHeader& Header = *reinterpret_cast<const FTypeDatabaseHeader*>(Data);
+
+        if (Header.Magic != FileMagic || Header.Version != FileVersion)
+        {
+            return false;
+        }
+
+        auto IsValidSection = [this](uint32 InOffset, uint64 InLength) {
+            return InOffset % 4 == 0 && InOffset + InLength <= static_cast<uint64>(DataSize);
+        };
+
+        return IsValidSection(Header.TypeIndexOffset, static_cast<uint64>(Header.TypeCount) * sizeof(FTypeDatabaseIndexEntry)) &&
+            IsValidSection(Header.StringListOffset, 0) &&
+            IsValidSection(Header.StringTableOffset, static_cast<uint64>(Header.StringCount) * sizeof(FTypeDatabaseStringEntry));
+    }
+
+    const FTypeDatabaseIndexEntry* FTypeDatabaseFile::GetIndexEntry(int32 InIndex) const
+    {
+        if (InIndex < 0 || InIndex >= GetTypeCount())
+        {
+            return nullptr;
+        }
+
+        return reinterpret_cast<const FTypeDatabaseIndexEntry*>(Data + GetHeader().TypeIndexOffset) + InIndex;
+    }
+
+    bool FTypeDatabaseFile::GetUtf8String(uint32 InIndex, const ANSICHAR*& OutString, uint32& OutLength) const
+    {
+        if (!IsOpen() || InIndex >= GetHeader().StringCount)
+        {
+            return false;
+        }
+
+        const FTypeDatabaseStringEntry& Entry = *(reinterpret_cast<const FTypeDatabaseStringEntry*>(Data + GetHeader().StringTableOffset) + InIndex);
+
+        // the zero terminator is a part of the string data
+        if (static_cast<uint64>(Entry.Offset) + Entry.Length >= static_cast<uint64>(DataSize) || Data[Entry.Offset + Entry.Length] != 0)
+        {
+            return false;
+        }
+
+        OutString = reinterpret_cast<const ANSICHAR*>(Data + Entry.Offset);
+        OutLength = Entry.Length;
+
+        return true;
+    }
+
+    FString FTypeDatabaseFile::GetString(uint32 InIndex) const
+    {
+        const ANSICHAR* String = nullptr;
+        uint32 Length = 0;
+
+        if (InIndex == NullStringIndex || !GetUtf8String(InIndex, String, Length))
+        {
+            return FString();
+        }
+
+        return UTF8_TO_TCHAR(String);
+    }
+
+    FString FTypeDatabaseFile::GetTypeName(int32 InIndex) const
+    {
+        const FTypeDatabaseIndexEntry* Entry = GetIndexEntry(InIndex);
+
+        return Entry != nullptr ? GetString(Entry->CppName) : FString();
+    }
+
+    EDefinitionType FTypeDatabaseFile::GetDefinitionType(int32 InIndex) const
+    {
+        const FTypeDatabaseIndexEntry* Entry = GetIndexEntry(InIndex);
+
+        return Entry != nullptr ? static_cast<EDefinitionType>(Entry->Type) : EDefinitionType::None;
+    }
+
+    int32 FTypeDatabaseFile::FindTypeIndex(const FString& InCppName) const
+    {
+        const FTCHARToUTF8 Name(*InCppName);
+
+        int32 Low = 0;
+        int32 High = GetTypeCount() - 1;
+
+        while (Low <= High)
+        {
+            const int32 Middle = Low + (High - Low) / 2;
+
+            const ANSICHAR* MiddleName = nullptr;
+            uint32 MiddleLength = 0;
+
+            if (!GetUtf8String(GetIndexEntry(Middle)->CppName, MiddleName, MiddleLength))
+            {
+                return INDEX_NONE;
+            }
+
+            const int32 Result = CompareUtf8Strings(MiddleName, MiddleLength, reinterpret_cast<const ANSICHAR*>(Name.Get()), Name.Length());
+
+            if (Result == 0)
+            {
+                return Middle;
+            }
+
+            if (Result < 0)
+            {
+                Low = Middle + 1;
+            }
+            else
+            {
+                High = Middle - 1;
+            }
+        }
+
+        return INDEX_NONE;
+    }
+
+    bool FTypeDatabaseFile::LoadType(int32 InIndex, FBaseTypeDefinition& OutDefinition) const
+    {
+        const FTypeDatabaseIndexEntry* Entry = GetIndexEntry(InIndex);
+
+        if (Entry == nullptr || static_cast<uint64>(Entry->RecordOffset) + Entry->RecordSize > static_cast<uint64>(DataSize))
+        {
+            return false;
+        }
+
+        FTypeDatabaseRecordReader Reader(*this, Data + Entry->RecordOffset, Entry->RecordSize);
+        OutDefinition.Serialize(Reader);
+
+        return !Reader.IsError();
+    }
+
+    void FTypeDatabaseFile::LoadStringList(ETypeDatabaseStringList InList, TSet<FString>& OutStrings) const
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        uint64 Offset = GetHeader().StringListOffset;
+
+        for (int i = 0; i <= static_cast<int>(InList); ++i)
+        {
+            if (Offset + sizeof(uint32) > static_cast<uint64>(DataSize))
+            {
+                return;
+            }
+
+            const uint32 Num = *reinterpret_cast<const uint32*>(Data + Offset);
+            const uint32* Indices = reinterpret_cast<const uint32*>(Data + Offset + sizeof(uint32));
+
+            Offset += sizeof(uint32) + static_cast<uint64>(Num) * sizeof(uint32);
+
+            if (Offset > static_cast<uint64>(DataSize))
+            {
+                return;
+            }
+
+            if (i == static_cast<int>(InList))
+            {
+                for (uint32 j = 0; j < Num; ++j)
+                {
+                    OutStrings.Add(GetString(Indices[j]));
+                }
+            }
+        }
+    }
+}
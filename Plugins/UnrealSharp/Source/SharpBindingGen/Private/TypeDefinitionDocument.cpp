@@ -29,7 +29,10 @@
 #include "ScriptStructTypeDefinition.h"
 #include "ClassTypeDefinition.h"
 #include "TypeValidation.h"
+#include "TypeDatabaseFile.h"
+#include "Misc/UnrealSharpLog.h"
 #include "Misc/UnrealSharpUtils.h"
+#include "Async/ParallelFor.h"
 
 namespace UnrealSharp
 {
@@ -61,6 +64,9 @@ namespace UnrealSharp
 
 		const auto Settings = GetDefault<USharpBindingGenSettings>();
 
+		// sort by path name, so the result will not depend on the order of objects in memory
+		TArray<TPair<FString, UField*>> ExportFields;
+
 		for (UField* Field : InTypeValidation->GetSupportedFields())
 		{
 			if (!InTypeValidation->IsNeedExport(Field))
@@ -77,10 +83,50 @@ namespace UnrealSharp
 			)
 			// ReSharper restore CppRedundantParentheses
 			{
-				if (auto TypeDefinition = CreateTypeDefinition(Field, InTypeValidation); TypeDefinition != nullptr)
-				{
-					Types.Add(TypeDefinition->CppName, TypeDefinition);
-				}
+				ExportFields.Emplace(Field->GetPathName(), Field);
+			}
+		}
+
+		ExportFields.Sort([](const TPair<FString, UField*>& InLeft, const TPair<FString, UField*>& InRight)
+		{
+			return InLeft.Key < InRight.Key;
+		});
+
+		// default values run native struct constructors and read class default objects, package meta data is created on demand,
+		// so they are prepared on game thread before reading reflection data in parallel
+		TArray<FDefaultValueTextMap> DefaultValueTexts;
+		DefaultValueTexts.SetNum(ExportFields.Num());
+
+		for (int32 Index = 0; Index < ExportFields.Num(); ++Index)
+		{
+			UField* Field = ExportFields[Index].Value;
+
+			if (UClass* Class = Cast<UClass>(Field))
+			{
+				DefaultValueTexts[Index] = FClassTypeDefinition::ExportDefaultValueTexts(Class);
+			}
+			else if (UScriptStruct* Struct = Cast<UScriptStruct>(Field))
+			{
+				DefaultValueTexts[Index] = FScriptStructTypeDefinition::ExportDefaultValueTexts(Struct);
+			}
+
+			Field->GetOutermost()->GetMetaData();
+		}
+
+		TArray<FTypeDefinitionPtr> Definitions;
+		Definitions.SetNum(ExportFields.Num());
+
+		// definitions only read reflection data, every task writes its own slot
+		ParallelFor(ExportFields.Num(), [&](const int32 Index)
+		{
+			Definitions[Index] = CreateTypeDefinition(ExportFields[Index].Value, InTypeValidation, DefaultValueTexts[Index]);
+		}, Settings->bParallelTypeExport ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+
+		for (const FTypeDefinitionPtr& TypeDefinition : Definitions)
+		{
+			if (TypeDefinition != nullptr)
+			{
+				Types.Add(TypeDefinition->CppName, TypeDefinition);
 			}
 		}
 
@@ -98,7 +144,7 @@ namespace UnrealSharp
 	}
 
 	FTypeDefinitionDocument::FTypeDefinitionPtr FTypeDefinitionDocument::CreateTypeDefinition(
-		UField* InField, FTypeValidation* InTypeValidation) const
+		UField* InField, FTypeValidation* InTypeValidation, const FDefaultValueTextMap& InDefaultValueTexts) const
 	{
 		if (UEnum* Enum = Cast<UEnum>(InField))
 		{
@@ -107,12 +153,12 @@ namespace UnrealSharp
 
 		if (UScriptStruct* Struct = Cast<UScriptStruct>(InField))
 		{
-			return MakeShared<FScriptStructTypeDefinition>(Struct, InTypeValidation);
+			return MakeShared<FScriptStructTypeDefinition>(Struct, InTypeValidation, InDefaultValueTexts);
 		}
 
 		if (UClass* Class = Cast<UClass>(InField))
 		{
-			return MakeShared<FClassTypeDefinition>(Class, InTypeValidation);
+			return MakeShared<FClassTypeDefinition>(Class, InTypeValidation, InDefaultValueTexts);
 		}
 
 		return FTypeDefinitionPtr();
@@ -153,6 +199,74 @@ namespace UnrealSharp
 	}
 
 	bool FTypeDefinitionDocument::LoadFromFile(const TCHAR* InFilePath)
+	{
+		if (FTypeDatabaseFile::IsTypeDatabaseFile(InFilePath))
+		{
+			return LoadFromBinaryFile(InFilePath);
+		}
+
+		return LoadFromJsonFile(InFilePath);
+	}
+
+	bool FTypeDefinitionDocument::LoadFromBinaryFile(const TCHAR* InFilePath)
+	{
+		Reset();
+
+		FTypeDatabaseFile File;
+
+		if (!File.Open(InFilePath))
+		{
+			return false;
+		}
+
+		const FTypeDatabaseHeader& Header = File.GetHeader();
+
+		UnrealMajorVersion = Header.UnrealMajorVersion;
+		UnrealMinorVersion = Header.UnrealMinorVersion;
+		UnrealPatchVersion = Header.UnrealPatchVersion;
+		DocumentAttributes = Header.DocumentAttributes;
+
+		Types.Reserve(File.GetTypeCount());
+
+		for (int32 i = 0; i < File.GetTypeCount(); ++i)
+		{
+			if (auto TypeDefinition = CreateTypeDefinition(File.GetDefinitionType(i)))
+			{
+				if (!File.LoadType(i, *TypeDefinition))
+				{
+					US_LOG_ERROR(TEXT("Failed load type %s from %s, the file is broken."), *File.GetTypeName(i), InFilePath);
+
+					Reset();
+					return false;
+				}
+
+				Types.Add(TypeDefinition->CppName, TypeDefinition);
+			}
+		}
+
+		File.LoadStringList(ETypeDatabaseStringList::FastAccessStructTypes, FastAccessStructTypes);
+		File.LoadStringList(ETypeDatabaseStringList::FastFunctionInvokeModuleNames, FastFunctionInvokeModuleNames);
+		File.LoadStringList(ETypeDatabaseStringList::FastFunctionInvokeIgnoreClassNames, FastFunctionInvokeIgnoreClassNames);
+		File.LoadStringList(ETypeDatabaseStringList::FastFunctionInvokeIgnoreNames, FastFunctionInvokeIgnoreNames);
+
+		return true;
+	}
+
+	FTypeDefinitionDocument::FTypeDefinitionPtr FTypeDefinitionDocument::LoadType(const FTypeDatabaseFile& InFile, const FString& InCppName) const
+	{
+		const int32 Index = InFile.FindTypeIndex(InCppName);
+
+		if (Index == INDEX_NONE)
+		{
+			return FTypeDefinitionPtr();
+		}
+
+		FTypeDefinitionPtr TypeDefinition = CreateTypeDefinition(InFile.GetDefinitionType(Index));
+
+		return TypeDefinition && InFile.LoadType(Index, *TypeDefinition) ? TypeDefinition : FTypeDefinitionPtr();
+	}
+
+	bool FTypeDefinitionDocument::LoadFromJsonFile(const TCHAR* InFilePath)
 	{
 		Reset();
 
@@ -236,6 +350,33 @@ namespace UnrealSharp
 	}
 
 	bool FTypeDefinitionDocument::SaveToFile(const TCHAR* InFilePath)
+	{
+		if (FPaths::GetExtension(InFilePath).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+		{
+			return SaveToJsonFile(InFilePath);
+		}
+
+		return SaveToBinaryFile(InFilePath);
+	}
+
+	bool FTypeDefinitionDocument::SaveToBinaryFile(const TCHAR* InFilePath)
+	{
+		FTypeDatabaseFileWriter Writer(UnrealMajorVersion, UnrealMinorVersion, UnrealPatchVersion, DocumentAttributes);
+
+		for (const auto& Pair : Types)
+		{
+			Writer.AddType(*Pair.Value);
+		}
+
+		Writer.SetStringList(ETypeDatabaseStringList::FastAccessStructTypes, FastAccessStructTypes);
+		Writer.SetStringList(ETypeDatabaseStringList::FastFunctionInvokeModuleNames, FastFunctionInvokeModuleNames);
+		Writer.SetStringList(ETypeDatabaseStringList::FastFunctionInvokeIgnoreClassNames, FastFunctionInvokeIgnoreClassNames);
+		Writer.SetStringList(ETypeDatabaseStringList::FastFunctionInvokeIgnoreNames, FastFunctionInvokeIgnoreNames);
+
+		return Writer.SaveToFile(InFilePath);
+	}
+
+	bool FTypeDefinitionDocument::SaveToJsonFile(const TCHAR* InFilePath)
 	{
 		TSharedPtr<FJsonObject> Doc = MakeShared<FJsonObject>();
 
@@ -27,6 +27,7 @@
 #include "SharpBindingGenSettings.h"
 #include "Misc/UnrealSharpUtils.h"
 #include "Misc/UnrealSharpLog.h"
+#include "Async/ParallelFor.h"
 
 namespace UnrealSharp
 {
@@ -67,71 +68,132 @@ namespace UnrealSharp
         SupportedFields.Empty();
         DeprecatedFields.Empty();
         CSharpFields.Empty();
+        PreCheckResults.Empty();
 
         if (!bAutoCheck)
         {
             return;
         }
 
+        TArray<UField*> Fields;
+        TSet<UPackage*> Packages;
+
         for (TObjectIterator<UField> Iter; Iter; ++Iter)
         {
-            if (const UField* Field = *Iter; Field->IsA<UClass>() || Field->IsA<UScriptStruct>() || Field->IsA<UEnum>())
+            if (UField* Field = *Iter; Field->IsA<UClass>() || Field->IsA<UScriptStruct>() || Field->IsA<UEnum>())
             {
-                ValidateField(*Iter);
+                Fields.Add(Field);
+                Packages.Add(Field->GetOutermost());
             }            
         }
-    }
 
-    bool FTypeValidation::ValidateField(UField* InField)
-    {
-        if (const ECheckResult CachedResult = GetCheckResult(InField); CachedResult == ECheckResult::Failure)
+        // package meta data is created on demand, create it on game thread before reading meta data in parallel
+        for (UPackage* Package : Packages)
         {
-            return false;
+            Package->GetMetaData();
         }
-        else if (CachedResult == ECheckResult::Success)
+
+        TArray<EPreCheckResult> Results;
+        Results.SetNumUninitialized(Fields.Num());
+
+        ParallelFor(Fields.Num(), [&](const int32 Index)
         {
-            return true;
+            Results[Index] = PreCheckField(Fields[Index]);
+        }, GenSettings->bParallelTypeExport ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+        PreCheckResults.Reserve(Fields.Num());
+
+        for (int32 Index = 0; Index < Fields.Num(); ++Index)
+        {
+            PreCheckResults.Add(Fields[Index], Results[Index]);
         }
 
+        for (UField* Field : Fields)
+        {
+            ValidateField(Field);
+        }
+
+        PreCheckResults.Empty();
+    }
+
+    FTypeValidation::EPreCheckResult FTypeValidation::PreCheckField(const UField* InField) const
+    {
         const UPackage* Package = InField->GetOutermost();
 
         check(Package != nullptr);
 
         if (!AllowPackage(Package))
         {
-            UnSupportedFields.Add(InField);
-            return false;
+            return EPreCheckResult::UnSupported;
         }
 
         // if this type is deprecated in unreal engine 4
         // skip this type
         if (const FString& DeprecatedFlag = InField->GetMetaData("Deprecated"); !DeprecatedFlag.IsEmpty() && DeprecatedFlag.StartsWith("4"))
         {
-            DeprecatedFields.Add(InField);
-            return false;
+            return EPreCheckResult::Deprecated;
         }
 
         if (FUnrealSharpUtils::IsCSharpField(InField))
         {
-            CSharpFields.Add(InField);
-            return false;
+            return EPreCheckResult::CSharp;
         }
 
-        if (UClass* Class = Cast<UClass>(InField))
-        {   
-            if (FUnrealSharpUtils::IsSpecialClass(Class))
+        if (const UClass* Class = Cast<UClass>(InField))
+        {
+            if (FUnrealSharpUtils::IsSpecialClass(Class) || !GenSettings->IsSupportedType(FUnrealSharpUtils::GetCppTypeName(Class)))
             {
-                UnSupportedFields.Add(InField);
-                return false;
+                return EPreCheckResult::UnSupported;
             }
-
-            if (const FString ClassName = FUnrealSharpUtils::GetCppTypeName(Class); !GenSettings->IsSupportedType(ClassName))
+        }
+        else if (const UScriptStruct* Struct = Cast<UScriptStruct>(InField))
+        {
+            if (!GenSettings->IsSupportedType(Struct->GetStructCPPName()))
             {
-                UnSupportedFields.Add(InField);
-
-                return false;
+                return EPreCheckResult::UnSupported;
             }
+        }
+        else if (const UEnum* Enum = Cast<UEnum>(InField))
+        {
+            if (!GenSettings->IsSupportedType(Enum->GetName()))
+            {
+                return EPreCheckResult::UnSupported;
+            }
+        }
+
+        return EPreCheckResult::Passed;
+    }
+
+    bool FTypeValidation::ValidateField(UField* InField)
+    {
+        if (const ECheckResult CachedResult = GetCheckResult(InField); CachedResult == ECheckResult::Failure)
+        {
+            return false;
+        }
+        else if (CachedResult == ECheckResult::Success)
+        {
+            return true;
+        }
+
+        const EPreCheckResult* CachedPreCheckResult = PreCheckResults.Find(InField);
+
+        switch (CachedPreCheckResult != nullptr ? *CachedPreCheckResult : PreCheckField(InField))
+        {
+        case EPreCheckResult::UnSupported:
+            UnSupportedFields.Add(InField);
+            return false;
+        case EPreCheckResult::Deprecated:
+            DeprecatedFields.Add(InField);
+            return false;
+        case EPreCheckResult::CSharp:
+            CSharpFields.Add(InField);
+            return false;
+        default:
+            break;
+        }
 
+        if (UClass* Class = Cast<UClass>(InField))
+        {   
             if (UClass* SuperClass = Class->GetSuperClass())
             {
                 if (SuperClass != UObject::StaticClass())
@@ -152,13 +214,6 @@ namespace UnrealSharp
         }
         else if (UScriptStruct* Struct = Cast<UScriptStruct>(InField))
         {
-            // ignore this struct ???
-            if (!GenSettings->IsSupportedType(Struct->GetStructCPPName()))
-            {
-                UnSupportedFields.Add(Struct);
-                return false;
-            }
-
             if (!GenSettings->ForceExportEmptyStructNames.Contains(Struct->GetStructCPPName()))
             {
                 // ignore if this struct has no valid properties
@@ -184,15 +239,6 @@ namespace UnrealSharp
                 }
             }
         }
-        else if (UEnum* Enum = Cast<UEnum>(InField))
-        {            
-            if (!GenSettings->IsSupportedType(Enum->GetName()))
-            {
-                UnSupportedFields.Add(Enum);
-                return false;
-            }
-        }
-
         SupportedFields.Add(InField);
         return true;
     }
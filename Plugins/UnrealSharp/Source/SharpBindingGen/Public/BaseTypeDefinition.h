@@ -41,6 +41,7 @@ namespace UnrealSharp
     };
 
     class FTypeValidation;
+    class FTypeDatabaseArchive;
 
     // Base class for exported type data. Most exported types are derived from this class.
     class SHARPBINDINGGEN_API FBaseTypeDefinition
@@ -57,6 +58,9 @@ namespace UnrealSharp
         // Write this type to JsonDoc
         virtual void                    Write(FJsonObject& InObject);
 
+        // Read or write this type with binary type database
+        virtual void                    Serialize(FTypeDatabaseArchive& InArchive);
+
         static FString                  GetCppTypeName(const UField* InField);
         static FString                  GetBlueprintFieldPackageName(const FString& InPath);
 
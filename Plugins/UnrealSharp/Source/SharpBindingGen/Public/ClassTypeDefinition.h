@@ -39,8 +39,15 @@ namespace UnrealSharp
         FClassTypeDefinition();
         FClassTypeDefinition(UClass* InClass, FTypeValidation* InTypeValidation);
 
+        // InDefaultValueTexts is created by ExportDefaultValueTexts on game thread, so it can be constructed on any thread
+        FClassTypeDefinition(UClass* InClass, FTypeValidation* InTypeValidation, const FDefaultValueTextMap& InDefaultValueTexts);
+
+        // export default values of properties in class default object
+        static FDefaultValueTextMap         ExportDefaultValueTexts(UClass* InClass);
+
         virtual void                        Read(FJsonObject& InObject) override;
         virtual void                        Write(FJsonObject& InObject) override;
+        virtual void                        Serialize(FTypeDatabaseArchive& InArchive) override;
 
     private:
         void                                LoadInterfaces(UClass* InClass);
@@ -36,6 +36,7 @@ namespace UnrealSharp
     public:
         void                            Read(const FJsonObject& InObject);
         void                            Write(FJsonObject& InObject) const;
+        void                            Serialize(FTypeDatabaseArchive& InArchive);
 
     public:
         FString                         Name;
@@ -52,6 +53,7 @@ namespace UnrealSharp
 
         virtual void                    Read(FJsonObject& InObject) override;
         virtual void                    Write(FJsonObject& InObject) override;
+        virtual void                    Serialize(FTypeDatabaseArchive& InArchive) override;
         
     protected:
         void                            LoadFields(const UEnum* InEnum);
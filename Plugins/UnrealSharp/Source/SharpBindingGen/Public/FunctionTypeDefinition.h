@@ -40,6 +40,7 @@ namespace UnrealSharp
 
         virtual void                        Write(FJsonObject& InObject) override;
         virtual void                        Read(FJsonObject& InObject) override;
+        virtual void                        Serialize(FTypeDatabaseArchive& InArchive) override;
 
     public:
         bool                                IsExportAsEvent() const;
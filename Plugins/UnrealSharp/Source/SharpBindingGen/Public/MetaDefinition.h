@@ -30,12 +30,15 @@
 
 namespace UnrealSharp
 {
+    class FTypeDatabaseArchive;
+
     // save meta definition for all types or properties
     class SHARPBINDINGGEN_API FMetaDefinition
     {
     public:
         void                            Read(const FJsonObject& InObject);
         void                            Write(FJsonObject& InObject);
+        void                            Serialize(FTypeDatabaseArchive& InArchive);
 
         void                            Reset();
         void                            Load(UField* InField);
@@ -39,6 +39,7 @@ namespace UnrealSharp
     };
 
     class FTypeValidation;
+    class FTypeDatabaseArchive;
     class FFunctionTypeDefinition;
 
     // Property Definition
@@ -49,10 +50,11 @@ namespace UnrealSharp
         typedef TSharedPtr<FPropertyDefinition> FPropertyDefinitionPtr;
         
         FPropertyDefinition();
-        FPropertyDefinition(UStruct* InStruct, const void* InDefaultObjectPtr, FProperty* InProperty, FTypeValidation* InTypeValidation);
+        FPropertyDefinition(UStruct* InStruct, const FString& InDefaultValue, FProperty* InProperty, FTypeValidation* InTypeValidation);
 
         void                                    Write(FJsonObject& InObject);
         void                                    Read(const FJsonObject& InObject);
+        void                                    Serialize(FTypeDatabaseArchive& InArchive);
 
         bool                                    IsReference() const;
         bool                                    IsOut() const;
@@ -97,6 +99,9 @@ namespace UnrealSharp
 
         bool                                    IsAttachToActorProperty() const{ return bIsActorComponent; }
 
+    private:
+        void                                    ReadMetaFields();
+
     public:
         FString                                 CppTypeName;
         FString                                 TypeName;
@@ -38,6 +38,12 @@ namespace UnrealSharp
         FScriptStructTypeDefinition();
         FScriptStructTypeDefinition(UScriptStruct* InStruct, FTypeValidation* InTypeValidation);
 
+        // InDefaultValueTexts is created by ExportDefaultValueTexts on game thread, so it can be constructed on any thread
+        FScriptStructTypeDefinition(UScriptStruct* InStruct, FTypeValidation* InTypeValidation, const FDefaultValueTextMap& InDefaultValueTexts);
+
+        // export default values of properties in a default constructed instance, it runs the native constructor of the struct
+        static FDefaultValueTextMap     ExportDefaultValueTexts(UScriptStruct* InStruct);
+
     public:
         virtual void                    Write(FJsonObject& InObject) override;
     };
@@ -82,6 +82,16 @@ public:
     UPROPERTY(EditAnywhere, Config, Category = "Binding Export")
     bool bShowIgnoreEmptyStructWarning = true;
 
+    // Type database files are saved in binary format, 
+    // turn on this switch to save a json copy beside them(*.tdb.json) for debugging.
+    UPROPERTY(EditAnywhere, Config, Category = "Binding Export")
+    bool bExportJsonTypeDatabase = false;
+
+    // Validate and export types on multiple threads, the output is always sorted, so it is the same as single thread export.
+    // Default values of structures and class default objects are always exported on the game thread.
+    UPROPERTY(EditAnywhere, Config, Category = "Binding Export")
+    bool bParallelTypeExport = true;
+
 public:
     // Enable this feature only for the modules specified here
     UPROPERTY(EditAnywhere, config, Category = "Binding Export|Fast Invoke")
@@ -30,6 +30,9 @@
 
 namespace UnrealSharp
 {
+    // exported default values of properties, keyed by property
+    typedef TMap<const FProperty*, FString> FDefaultValueTextMap;
+
     // definition of UStruct(not UScriptStruct)
     class SHARPBINDINGGEN_API FStructTypeDefinition : public FBaseTypeDefinition
     {
@@ -41,6 +44,7 @@ namespace UnrealSharp
 
         virtual void                            Read(FJsonObject& InObject) override;
         virtual void                            Write(FJsonObject& InObject) override;
+        virtual void                            Serialize(FTypeDatabaseArchive& InArchive) override;
 
         virtual bool                            IsSupportedProperty(FProperty* InProperty, FTypeValidation* InTypeValidation);
         virtual bool                            IsSupportedElementProperty(FProperty* InProperty, FTypeValidation* InTypeValidation);
@@ -53,7 +57,10 @@ namespace UnrealSharp
         void                                    AddDependNamespace(const UField* InField);
 
     protected:
-        void                                    LoadProperties(UStruct* InStruct, const void* InDefaultObjectPtr, const EFieldIterationFlags InFlags, FTypeValidation* InTypeValidation, const TFunction<bool(FProperty*)>& InAccessFunc);
+        void                                    LoadProperties(UStruct* InStruct, const FDefaultValueTextMap* InDefaultValueTexts, const EFieldIterationFlags InFlags, FTypeValidation* InTypeValidation, const TFunction<bool(FProperty*)>& InAccessFunc);
+
+        // export texts of property values in InDefaultObjectPtr, must be called on game thread
+        static FDefaultValueTextMap             ExportDefaultValueTexts(UStruct* InStruct, const void* InDefaultObjectPtr, const EFieldIterationFlags InFlags);
 
     public:
         TArray<FPropertyDefinition>             Properties;
@@ -0,0 +1,194 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#include "BaseTypeDefinition.h"
+#include "Async/MappedFileHandle.h"
+
+namespace UnrealSharp
+{
+    /*
+    * Binary type database(.tdb) layout, values are little endian and offsets are relative to the beginning of the file:
+    *   FTypeDatabaseHeader
+    *   FTypeDatabaseIndexEntry[TypeCount]      sorted by utf8 bytes of the C++ name, a type can be found by binary search
+    *   string lists                            count + string indices for each ETypeDatabaseStringList
+    *   type records                            one flat record per type, strings are indices of the string table
+    *   FTypeDatabaseStringEntry[StringCount]
+    *   utf8 string data                        zero terminated
+    * UnrealSharpTool reads and writes the same layout in TypeDefinitionBinarySerializer.cs, 
+    * change both of them and increase the version together.
+    */
+    struct FTypeDatabaseHeader
+    {
+        uint32                          Magic;
+        uint32                          Version;
+        int32                           UnrealMajorVersion;
+        int32                           UnrealMinorVersion;
+        int32                           UnrealPatchVersion;
+        int32                           DocumentAttributes;
+        uint32                          TypeCount;
+        uint32                          TypeIndexOffset;
+        uint32                          StringListOffset;
+        uint32                          StringCount;
+        uint32                          StringTableOffset;
+    };
+
+    struct FTypeDatabaseIndexEntry
+    {
+        uint32                          CppName;
+        int32                           Type;
+        uint32                          RecordOffset;
+        uint32                          RecordSize;
+    };
+
+    struct FTypeDatabaseStringEntry
+    {
+        uint32                          Offset;
+        uint32                          Length;
+    };
+
+    enum class ETypeDatabaseStringList
+    {
+        FastAccessStructTypes,
+        FastFunctionInvokeModuleNames,
+        FastFunctionInvokeIgnoreClassNames,
+        FastFunctionInvokeIgnoreNames,
+
+        Count
+    };
+
+    /*
+    * Serialize type definitions from or to binary type database records.
+    * Like FArchive, every definition has only one Serialize function for both directions.
+    */
+    class SHARPBINDINGGEN_API FTypeDatabaseArchive
+    {
+    public:
+        virtual ~FTypeDatabaseArchive() = default;
+
+        bool                            IsLoading() const { return bIsLoading; }
+        bool                            IsError() const { return bIsError; }
+
+        virtual void                    Serialize(void* InData, int64 InLength) = 0;
+        virtual void                    SerializeString(FString& InValue) = 0;
+
+        // write InNum or read the element count of an array, always return 0 after any error
+        virtual int32                   SerializeNum(int32 InNum);
+
+        FTypeDatabaseArchive&           operator << (uint8& InValue) { Serialize(&InValue, sizeof(InValue)); return *this; }
+        FTypeDatabaseArchive&           operator << (int32& InValue) { Serialize(&InValue, sizeof(InValue)); return *this; }
+        FTypeDatabaseArchive&           operator << (int64& InValue) { Serialize(&InValue, sizeof(InValue)); return *this; }
+        FTypeDatabaseArchive&           operator << (uint64& InValue) { Serialize(&InValue, sizeof(InValue)); return *this; }
+        FTypeDatabaseArchive&           operator << (FString& InValue) { SerializeString(InValue); return *this; }
+        FTypeDatabaseArchive&           operator << (bool& InValue);
+        FTypeDatabaseArchive&           operator << (FGuid& InValue);
+
+    protected:
+        bool                            bIsLoading = false;
+        bool                            bIsError = false;
+    };
+
+    // Build a binary type database file
+    class SHARPBINDINGGEN_API FTypeDatabaseFileWriter
+    {
+    public:
+        FTypeDatabaseFileWriter(int32 InUnrealMajorVersion, int32 InUnrealMinorVersion, int32 InUnrealPatchVersion, int32 InDocumentAttributes);
+
+        void                            AddType(FBaseTypeDefinition& InDefinition);
+        void                            SetStringList(ETypeDatabaseStringList InList, const TSet<FString>& InStrings);
+        uint32                          AddString(const FString& InValue);
+
+        bool                            SaveToFile(const TCHAR* InFilePath) const;
+
+    private:
+        struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, false>
+        {
+            static const FString&       GetSetKey(const TPair<FString, uint32>& InElement) { return InElement.Key; }
+            static bool                 Matches(const FString& InLeft, const FString& InRight) { return InLeft.Equals(InRight, ESearchCase::CaseSensitive); }
+            static uint32               GetKeyHash(const FString& InKey) { return FCrc::StrCrc32(*InKey); }
+        };
+
+        FTypeDatabaseHeader                                                         Header;
+        TArray<FTypeDatabaseIndexEntry>                                             IndexEntries;
+        TArray<uint8>                                                               RecordData;
+        TArray<uint32>                                                              StringLists[static_cast<int>(ETypeDatabaseStringList::Count)];
+        TArray<TArray<ANSICHAR>>                                                    Strings;
+        TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs>         StringIndices;
+    };
+
+    /*
+    * Read only view of a binary type database file.
+    * The file is memory mapped, only the header is validated when it is opened, 
+    * types can be found by C++ name and loaded one by one without parsing the others.
+    */
+    class SHARPBINDINGGEN_API FTypeDatabaseFile
+    {
+    public:
+        // "UTDB"
+        static constexpr uint32         FileMagic = 0x42445455;
+        static constexpr uint32         FileVersion = 1;
+        static constexpr uint32         NullStringIndex = MAX_uint32;
+
+        FTypeDatabaseFile();
+        ~FTypeDatabaseFile();
+
+        FTypeDatabaseFile(const FTypeDatabaseFile&) = delete;
+        FTypeDatabaseFile&              operator = (const FTypeDatabaseFile&) = delete;
+
+        static bool                     IsTypeDatabaseFile(const TCHAR* InFilePath);
+
+        bool                            Open(const TCHAR* InFilePath);
+        void                            Close();
+        bool                            IsOpen() const { return Data != nullptr; }
+
+        const FTypeDatabaseHeader&      GetHeader() const { check(IsOpen()); return *reinterpret_cast<const FTypeDatabaseHeader*>(Data); }
+        int32                           GetTypeCount() const { return IsOpen() ? static_cast<int32>(GetHeader().TypeCount) : 0; }
+        FString                         GetTypeName(int32 InIndex) const;
+        EDefinitionType                 GetDefinitionType(int32 InIndex) const;
+
+        // binary search in the sorted index, return INDEX_NONE if not found
+        int32                           FindTypeIndex(const FString& InCppName) const;
+        bool                            LoadType(int32 InIndex, FBaseTypeDefinition& OutDefinition) const;
+
+        void                            LoadStringList(ETypeDatabaseStringList InList, TSet<FString>& OutStrings) const;
+        FString                         GetString(uint32 InIndex) const;
+
+    private:
+        bool                            ValidateHeader() const;
+        const FTypeDatabaseIndexEntry*  GetIndexEntry(int32 InIndex) const;
+        bool                            GetUtf8String(uint32 InIndex, const ANSICHAR*& OutString, uint32& OutLength) const;
+
+    private:
+        TUniquePtr<IMappedFileHandle>   MappedHandle;
+        TUniquePtr<IMappedFileRegion>   MappedRegion;
+
+        // used when the platform doesn't support memory mapped files
+        TArray<uint8>                   FileData;
+
+        const uint8*                    Data = nullptr;
+        int64                           DataSize = 0;
+    };
+}
@@ -26,10 +26,12 @@
 #pragma once
 
 #include "BaseTypeDefinition.h"
+#include "StructTypeDefinition.h"
 
 namespace UnrealSharp
 {
     class FTypeValidation;
+    class FTypeDatabaseFile;
     enum class ETypeValidationFlags;
 
     enum class ETypeDefinitionDocumentAttributes 
@@ -53,12 +55,22 @@ namespace UnrealSharp
         virtual ~FTypeDefinitionDocument();
 
     public:
+        // load binary or json type database, the format is detected by file header
         virtual bool                                    LoadFromFile(const TCHAR* InFilePath);
         virtual bool                                    LoadFromEngine(const ETypeValidationFlags InFlags);
         virtual bool                                    LoadFromEngine(FTypeValidation* InTypeValidation, const ETypeValidationFlags InFlags);
 
+        // save as json if the extension is .json, otherwise save as binary type database
         virtual bool                                    SaveToFile(const TCHAR* InFilePath);
 
+        bool                                            LoadFromJsonFile(const TCHAR* InFilePath);
+        bool                                            LoadFromBinaryFile(const TCHAR* InFilePath);
+        bool                                            SaveToJsonFile(const TCHAR* InFilePath);
+        bool                                            SaveToBinaryFile(const TCHAR* InFilePath);
+
+        // load only one type from an opened binary type database
+        FTypeDefinitionPtr                              LoadType(const FTypeDatabaseFile& InFile, const FString& InCppName) const;
+
         virtual void                                    Reset();
 
         void                                            Merge(const FTypeDefinitionDocument& InDocument);
@@ -67,7 +79,8 @@ namespace UnrealSharp
         FTypeDefinitionPtr                               GetType(const FString& InCppName);
         
     protected:
-        virtual FTypeDefinitionPtr                       CreateTypeDefinition(UField* InField, FTypeValidation* InTypeValidation) const;
+        // called on worker threads when bParallelTypeExport is on, InDefaultValueTexts are exported on game thread before
+        virtual FTypeDefinitionPtr                       CreateTypeDefinition(UField* InField, FTypeValidation* InTypeValidation, const FDefaultValueTextMap& InDefaultValueTexts) const;
         virtual FTypeDefinitionPtr                       CreateTypeDefinition(const EDefinitionType InType) const;  
 
     private:
@@ -60,6 +60,8 @@ namespace UnrealSharp
         bool                                IsNeedExport(const UField* InField) const;
         static FString                      GetFieldCheckedName(const UField* InField);
 
+        // validate all classes, structures and enumerations in memory
+        // independent checks run in parallel, dependent checks(super class, struct properties) run serially
         void                                Reset(const bool bAutoCheck = false);
 
         const TSet<UField*>&                GetSupportedFields() const { return SupportedFields; }
@@ -75,7 +77,17 @@ namespace UnrealSharp
             Failure
         };
 
+        // result of the checks which only depend on the field itself, they are thread safe
+        enum class EPreCheckResult : uint8
+        {
+            Passed,
+            UnSupported,
+            Deprecated,
+            CSharp
+        };
+
         ECheckResult                        GetCheckResult(const UField* InField) const;
+        EPreCheckResult                     PreCheckField(const UField* InField) const;
         bool                                AllowPackage(const UPackage* InPackage) const;
 
     private:
@@ -84,5 +96,6 @@ namespace UnrealSharp
         TSet<UField*>                       SupportedFields;
         TSet<UField*>                       DeprecatedFields;
         TSet<UField*>                       CSharpFields;
+        TMap<const UField*, EPreCheckResult> PreCheckResults;
     };
 }
@@ -30,6 +30,7 @@
 #include "CSharpStructFactory.h"
 #include "Misc/StackMemory.h"
 #include "Misc/ScopedCSharpMethodInvocation.h"
+#include "Misc/CSharpStartupProfile.h"
 
 namespace UnrealSharp
 {
@@ -98,6 +99,8 @@ namespace UnrealSharp
 
             const TSharedPtr<FCSharpStructFactory> FactoryPtr = MakeShared<FCSharpStructFactory>(Runtime, AssemblyName, ClassPath);
             Factory = &StructFactories.Add(Struct, FactoryPtr);
+
+            FCSharpStartupProfile::Record(FCSharpStartupProfile::EEntryKind::StructFactory, FString(), Struct->GetPathName());
         }
 
         return *Factory;
@@ -57,7 +57,7 @@ namespace UnrealSharp
         virtual void*                                               CreateCSharpSoftClassPtr(void* InAddressOfSoftClassPtr, FSoftClassProperty* InSoftClassProperty) override;
         virtual void                                                CopySoftClassPtr(void* InDestinationAddress, const void* InSourceObjectInterface) override;
 
-    protected:
+        // find or create the factory
         TSharedPtr<FCSharpStructFactory>                            QueryStructFactory(const UScriptStruct* InStruct);
 
     protected:
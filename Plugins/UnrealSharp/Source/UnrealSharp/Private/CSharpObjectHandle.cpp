@@ -60,6 +60,11 @@ namespace UnrealSharp
         return Handle ? Handle->GetObject() : nullptr;
     }
 
+    void* FCSharpObjectHandle::GetHandleValue() const
+    {
+        return Handle ? Handle->GetHandleValue() : nullptr;
+    }
+
     void FCSharpObjectHandle::Reset()
     {
         State = ECSharpObjectHandleState::Reset;
@@ -61,6 +61,7 @@ namespace UnrealSharp
 
         bool                            IsValid() const;
         void*                           GetObject() const;
+        void*                           GetHandleValue() const;
         void                            Reset();
 
         void                            SetState(ECSharpObjectHandleState InState);
@@ -33,6 +33,8 @@
 #include "Misc/ScopedCSharpMethodInvocation.h"
 #include "Classes/UnrealSharpSettings.h"
 #include "Misc/UnrealSharpLog.h"
+#include "Misc/UnrealSharpTrace.h"
+#include "Misc/UnrealSharpStats.h"
 
 namespace UnrealSharp
 {
@@ -63,6 +65,7 @@ namespace UnrealSharp
     {
         const UUnrealSharpSettings* Settings = GetDefault<UUnrealSharpSettings>();
         bSupportBlueprintBinding = Settings->bSupportBlueprintBinding;
+        InitializeHandleSlotTable();
         RegisterDelegates();
     }
 
@@ -71,6 +74,77 @@ namespace UnrealSharp
         CSharpObjectMapping.Empty();
 
         UnRegisterDelegates();
+        FreeHandleSlotTable();
+    }
+
+    void FCSharpObjectTable::InitializeHandleSlotTable()
+    {
+        HandleSlotTable = FCSharpObjectHandleSlotTable();
+
+        const int32 ChunkSize = 1 << HandleSlotTable.ChunkShift;
+        HandleSlotTable.NumChunks = (GUObjectArray.GetObjectArrayCapacity() + ChunkSize - 1) / ChunkSize;
+        HandleSlotTable.Chunks = (void***)FMemory::MallocZeroed(sizeof(void**) * HandleSlotTable.NumChunks); // NOLINT
+
+        // UObjectBase starts with the virtual table and ObjectFlags, followed by InternalIndex.
+        // It is private, so verify the layout with some objects before C# is allowed to read it.
+        constexpr int32 InternalIndexOffset = sizeof(void*) + sizeof(EObjectFlags);
+
+        const UObject* ProbeObjects[] = { UObject::StaticClass(), GetTransientPackage() };
+
+        bool bLayoutMatched = true;
+        for (const UObject* Object : ProbeObjects)
+        {
+            bLayoutMatched &= *(const int32*)((const uint8*)Object + InternalIndexOffset) == GUObjectArray.ObjectToIndex(Object); // NOLINT
+        }
+
+        HandleSlotTable.InternalIndexOffset = bLayoutMatched ? InternalIndexOffset : -1;
+
+        if (!bLayoutMatched)
+        {
+            US_LOG_WARN(TEXT("Unexpected UObject layout, C# proxy objects are always found by interop calls."));
+        }
+    }
+
+    void FCSharpObjectTable::FreeHandleSlotTable()
+    {
+        for (int32 i = 0; i < HandleSlotTable.NumChunks; ++i)
+        {
+            FMemory::Free(HandleSlotTable.Chunks[i]);
+        }
+
+        FMemory::Free(HandleSlotTable.Chunks);
+
+        HandleSlotTable = FCSharpObjectHandleSlotTable();
+    }
+
+    void FCSharpObjectTable::SetHandleSlot(const UObject* InObject, void* InHandleValue)
+    {
+        const int32 Index = GUObjectArray.ObjectToIndex(InObject);
+        const int32 ChunkIndex = Index >> HandleSlotTable.ChunkShift;
+
+        if (Index < 0 || ChunkIndex >= HandleSlotTable.NumChunks)
+        {
+            return;
+        }
+
+        void**& Chunk = HandleSlotTable.Chunks[ChunkIndex];
+
+        if (Chunk == nullptr)
+        {
+            if (InHandleValue == nullptr)
+            {
+                return;
+            }
+
+            Chunk = (void**)FMemory::MallocZeroed(sizeof(void*) << HandleSlotTable.ChunkShift); // NOLINT
+        }
+
+        Chunk[Index & ((1 << HandleSlotTable.ChunkShift) - 1)] = InHandleValue;
+    }
+
+    const FCSharpObjectHandleSlotTable* FCSharpObjectTable::GetHandleSlotTable() const
+    {
+        return &HandleSlotTable;
     }
 
     void FCSharpObjectTable::RegisterDelegates()
@@ -95,6 +169,10 @@ namespace UnrealSharp
 
             if (CSharpObject != nullptr)
             {
+                US_TRACE_EVENT(Verbose, ObjectConnectionBreak, CSharpObject, nullptr);
+                INC_DWORD_STAT(STAT_UnrealSharp_ProxyDestroyCount);
+                DEC_DWORD_STAT(STAT_UnrealSharp_ProxyAliveCount);
+
                 const auto FastAccessor = Runtime->GetCSharpLibraryAccessor();
                 check(FastAccessor);
 
@@ -116,6 +194,8 @@ namespace UnrealSharp
 
                 if (!IsValid(ReferencedObject) || ReferencedObject->IsUnreachable())
                 {
+                    // the index is reused by new objects after this GC
+                    SetHandleSlot(ReferencedObject, nullptr);
                     BreakCSharpObjectConnection(Handle);
 
                     It.RemoveCurrent();
@@ -130,10 +210,8 @@ namespace UnrealSharp
             }            
         }
 
-        if (TraceExternalRootsTime > 0.0)
-        {
-            US_LOG(TEXT("FCSharpObjectTable::OnPostReachabilityAnalysis %g ms"), TraceExternalRootsTime * 1000.0);
-        }
+        US_TRACE_EVENT(Basic, GarbageCollect, nullptr, nullptr, static_cast<int64>(TraceExternalRootsTime * 1000000.0));
+        US_TRACE_LOG(Basic, TEXT("FCSharpObjectTable::OnPostReachabilityAnalysis %g ms"), TraceExternalRootsTime * 1000.0);
     }
 
     void FCSharpObjectTable::OnPostGarbageCollect() // NOLINT
@@ -151,6 +229,7 @@ namespace UnrealSharp
             if (const UObject* Object = It.Key(); Object->IsIn(Outermost))
             {
                 auto& Handle = It.Value();
+                SetHandleSlot(Object, nullptr);
                 BreakCSharpObjectConnection(Handle);
 
                 It.RemoveCurrent();
@@ -175,11 +254,39 @@ namespace UnrealSharp
 
         void* ObjectPtr = Handle.GetObject();
 
+        SetHandleSlot(InObject, Handle.GetHandleValue());
+
         CSharpObjectMapping.Add(InObject, MoveTemp(Handle));
 
         return ObjectPtr;
     }
 
+    void FCSharpObjectTable::Reset()
+    {
+        for (const auto& Pair : CSharpObjectMapping)
+        {
+            SetHandleSlot(Pair.Key, nullptr);
+            BreakCSharpObjectConnection(Pair.Value);
+        }
+
+        CSharpObjectMapping.Empty();
+
+        // classes of blueprints and C# may be recreated at the same address in the next session, 
+        // only factories of native classes are safe to keep
+        for (auto It = CSharpObjectFactoryMapping.CreateIterator(); It; ++It)
+        {
+            if (!FUnrealSharpUtils::IsNativeClass(It.Key()))
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    void FCSharpObjectTable::GetObjects(TArray<UObject*>& OutObjects) const
+    {
+        CSharpObjectMapping.GenerateKeyArray(OutObjects);
+    }
+
     UObject* FCSharpObjectTable::GetUnrealObject(void* InCSharpObject)
     {
         return Runtime->GetCSharpLibraryAccessor()->GetUnrealObject(InCSharpObject);
@@ -189,6 +296,8 @@ namespace UnrealSharp
     {
         checkSlow(InObject);
 
+        US_INTEROP_SCOPE(STAT_UnrealSharp_ProxyCreate);
+
         // find the first CSharpClass or native class
         UClass* ObjectClass = InObject->GetClass();
         while (ObjectClass != nullptr)
@@ -212,6 +321,10 @@ namespace UnrealSharp
         void* ObjectPtr = CreateCSharpObject(ObjectClass, InObject);
         checkf(ObjectPtr != nullptr, TEXT("Failed create C# proxy object for unreal class:%s"), *ObjectClass->GetPathName());
 
+        US_TRACE_EVENT(Verbose, ObjectProxyCreate, InObject, ObjectPtr);
+        INC_DWORD_STAT(STAT_UnrealSharp_ProxyCreateCount);
+        INC_DWORD_STAT(STAT_UnrealSharp_ProxyAliveCount);
+
         FCSharpObjectHandle Handle(Runtime, ObjectPtr, false);
         return Handle;
     }
@@ -228,9 +341,7 @@ namespace UnrealSharp
         const FString AssemblyName = FUnrealSharpUtils::GetAssemblyName(InClass);
         const FString ClassFullPath = FUnrealSharpUtils::GetCSharpFullPath(InClass);
 
-#if UE_BUILD_DEBUG
-        // US_LOG(TEXT("Get CSharpObject:%s, ClassPathName:%s"), *InObject->GetName(), *InClass->GetPathName());
-#endif
+        US_TRACE_LOG(Verbose, TEXT("Create C# proxy factory for %s, first object:%s"), *InClass->GetPathName(), *InObject->GetName());
 
         TSharedPtr<ICSharpType> ClassType = Runtime->LookupType(AssemblyName, ClassFullPath);
         checkf(ClassType, TEXT("Failed find C# class %s in %s"), *ClassFullPath, *AssemblyName);
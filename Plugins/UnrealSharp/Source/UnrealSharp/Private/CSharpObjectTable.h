@@ -27,6 +27,7 @@
 
 #include "CSharpObjectHandle.h"
 #include "ICSharpObjectTable.h"
+#include "Misc/CSharpStructures.h"
 
 namespace UnrealSharp
 {
@@ -63,6 +64,9 @@ namespace UnrealSharp
 
         virtual void*                                       GetCSharpObject(UObject* InObject) override;
         virtual UObject*                                    GetUnrealObject(void* InCSharpObject) override;
+        virtual void                                        Reset() override;
+        virtual void                                        GetObjects(TArray<UObject*>& OutObjects) const override;
+        virtual const FCSharpObjectHandleSlotTable*         GetHandleSlotTable() const override;
 
     protected:
         // if UObject is garbage, break C# UObject connections
@@ -78,6 +82,10 @@ namespace UnrealSharp
         void                                                BreakCSharpObjectConnection(const FCSharpObjectHandle& InHandle) const;
 
         FCSharpObjectHandle                                 CreateCSharpObjectHandle(UObject* InObject);
+
+        void                                                InitializeHandleSlotTable();
+        void                                                FreeHandleSlotTable();
+        void                                                SetHandleSlot(const UObject* InObject, void* InHandleValue);
         void*                                               CreateCSharpObject(UClass* InClass, UObject* InObject);
 
     protected:
@@ -89,6 +97,7 @@ namespace UnrealSharp
         FDelegateHandle                                     PostGarbageCollectHandle;
 
         TMap<UClass*, FCSharpObjectFactory>                 CSharpObjectFactoryMapping;
+        FCSharpObjectHandleSlotTable                        HandleSlotTable;
         bool                                                bSupportBlueprintBinding = true;
     };
 }
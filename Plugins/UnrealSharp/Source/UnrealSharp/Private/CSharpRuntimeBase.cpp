@@ -31,11 +31,21 @@
 #include "Misc/ScopedCSharpMethodInvocation.h"
 #include "Misc/UnrealSharpPaths.h"
 #include "Misc/UnrealInteropFunctions.h"
+#include "Misc/CSharpFunctionRedirectionUtils.h"
+#include "Misc/UnrealSharpLog.h"
+#include "Misc/CSharpStartupProfile.h"
+#include "Classes/CSharpClass.h"
+#include "Classes/UnrealSharpSettings.h"
 
 namespace UnrealSharp
 {
     bool FCSharpRuntimeBase::Initialize()
     {
+        if (GetDefault<UUnrealSharpSettings>()->bRecordStartupProfile)
+        {
+            FCSharpStartupProfile::StartRecording();
+        }
+
         if (!InitializeInternal())
         {
             return false;
@@ -45,11 +55,23 @@ namespace UnrealSharp
 
         InvokeMain();
 
+        FCSharpFunctionRedirectionUtils::RedirectAllCSharpFunctions();
+
+        US_LOG(TEXT("Redirect C# functions Success."));
+
+        PostMainInvoked();
+
         return true;
     }
 
     void FCSharpRuntimeBase::Shutdown()
     {
+        if (FCSharpStartupProfile::IsRecording())
+        {
+            FCSharpStartupProfile::StopRecording();
+            FCSharpStartupProfile::Save(FUnrealSharpPaths::GetStartupProfilePath());
+        }
+
         BeforeShutdown();
 
         ShutdownInternal();
@@ -59,10 +81,12 @@ namespace UnrealSharp
     {
         CSharpLibraryAccessorPtr = CreateCSharpLibraryAccessor();
         ObjectTablePtr = CreateCSharpObjectTable();
+        AsyncLoadManagerPtr = MakeUnique<FCSharpAsyncLoadManager>(this);
     }
 
     void FCSharpRuntimeBase::BeforeShutdown()
     {
+        AsyncLoadManagerPtr.Reset();
         CSharpLibraryAccessorPtr.Reset();
         ObjectTablePtr.Reset();
     }
@@ -87,6 +111,147 @@ namespace UnrealSharp
         return ObjectTablePtr.Get();
     }
 
+    FCSharpAsyncLoadManager* FCSharpRuntimeBase::GetAsyncLoadManager()
+    {
+        return AsyncLoadManagerPtr.Get();
+    }
+
+    void FCSharpRuntimeBase::ResetSession()
+    {
+        // continuations of the ended session must not run in the next one
+        if (AsyncLoadManagerPtr)
+        {
+            AsyncLoadManagerPtr->CancelAll();
+        }
+
+        if (ObjectTablePtr)
+        {
+            ObjectTablePtr->Reset();
+        }
+
+        // the struct factories are bound to native structs or C# types, they are still valid
+        ExecuteGarbageCollect(true);
+    }
+
+    bool FCSharpRuntimeBase::HotReload(FCSharpHotReloadReport& OutReport)
+    {
+        check(IsInGameThread());
+
+        OutReport = FCSharpHotReloadReport();
+
+        if (!CanReload())
+        {
+            US_LOG_ERROR(TEXT("C# runtime %s can't be reloaded in this build."), *GetRuntimeType().ToString());
+            return false;
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+
+        TArray<UObject*> Objects;
+        ObjectTablePtr->GetObjects(Objects);
+
+        // redirectors, proxy factories and struct factories of library accessor hold types and methods of old assemblies
+        FCSharpFunctionRedirectionUtils::RestoreAllCSharpFunctions();
+        ObjectTablePtr->Reset();
+        StructFactories.Empty();
+
+        // recreate library accessor and object table
+        BeforeShutdown();
+
+        if (!ReloadInternal())
+        {
+            US_LOG_ERROR(TEXT("Failed reload C# runtime."));
+
+            OutReport.bIsRuntimeLost = true;
+            return false;
+        }
+
+        PostInitialized();
+        InvokeMain();
+
+        FCSharpFunctionRedirectionUtils::RedirectAllCSharpFunctions();
+
+        PostMainInvoked();
+
+        for (UObject* Object : Objects)
+        {
+            // objects are not collected during reload, but they may be marked as garbage
+            if (IsValid(Object) && !Object->IsUnreachable() && ObjectTablePtr->GetCSharpObject(Object) != nullptr)
+            {
+                ++OutReport.ReboundObjectCount;
+            }
+            else
+            {
+                ++OutReport.LostObjectCount;
+            }
+        }
+
+        OutReport.Seconds = FPlatformTime::Seconds() - StartTime;
+
+        US_LOG(TEXT("C# hot reload finished in %.2f ms, %d objects rebound, %d objects lost."), OutReport.Seconds * 1000.0, OutReport.ReboundObjectCount, OutReport.LostObjectCount);
+
+        return true;
+    }
+
+    void FCSharpRuntimeBase::PostMainInvoked()
+    {
+        const EUnrealSharpJitPrewarmMode Mode = GetDefault<UUnrealSharpSettings>()->JitPrewarmMode;
+
+        TArray<FCSharpStartupProfile::FEntry> Entries;
+
+        if (Mode == EUnrealSharpJitPrewarmMode::UFunctions)
+        {
+            for (TObjectIterator<UCSharpClass> It; It; ++It)
+            {
+                for (const auto& [Name, FunctionData] : It->GetCSharpFunctions())
+                {
+                    Entries.Add({ FCSharpStartupProfile::EEntryKind::Method, It->GetAssemblyName(), FunctionData.FunctionSignature });
+                }
+            }
+        }
+        else if (Mode == EUnrealSharpJitPrewarmMode::Profile)
+        {
+            TArray<FCSharpStartupProfile::FEntry> ProfileEntries;
+            FCSharpStartupProfile::Load(FUnrealSharpPaths::GetStartupProfilePath(), ProfileEntries);
+
+            int32 BoundCount = 0;
+
+            // native objects can only be bound on game thread, they are cheap compared with JIT
+            for (FCSharpStartupProfile::FEntry& Entry : ProfileEntries)
+            {
+                if (Entry.Kind == FCSharpStartupProfile::EEntryKind::StructFactory)
+                {
+                    if (const UScriptStruct* Struct = FindObject<UScriptStruct>(nullptr, *Entry.Name); Struct != nullptr && CSharpLibraryAccessorPtr)
+                    {
+                        static_cast<FCSharpLibraryAccessor*>(CSharpLibraryAccessorPtr.Get())->QueryStructFactory(Struct);
+                        ++BoundCount;
+                    }
+                }
+                else if (Entry.Kind == FCSharpStartupProfile::EEntryKind::Redirector)
+                {
+                    if (const UFunction* Function = FindObject<UFunction>(nullptr, *Entry.Name); Function != nullptr)
+                    {
+                        if (UCSharpClass* Class = Cast<UCSharpClass>(Function->GetOuter()); Class != nullptr && Class->BindCSharpFunction(Function))
+                        {
+                            ++BoundCount;
+                        }
+                    }
+                }
+                else
+                {
+                    Entries.Add(MoveTemp(Entry));
+                }
+            }
+
+            US_LOG(TEXT("Replay C# startup profile: %d native bindings created, %d methods and types to prewarm."), BoundCount, Entries.Num());
+        }
+
+        if (!Entries.IsEmpty())
+        {
+            PrewarmAsync(MoveTemp(Entries));
+        }
+    }
+
     TSharedPtr<ICSharpType> FCSharpRuntimeBase::LookupType(const FString& InAssemblyName, const FString& InFullName)
     {
         int Index = 0;
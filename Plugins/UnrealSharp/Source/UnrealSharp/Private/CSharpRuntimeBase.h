@@ -26,6 +26,8 @@
 #pragma once
 
 #include "ICSharpRuntime.h"
+#include "Misc/CSharpStartupProfile.h"
+#include "Misc/CSharpAsyncLoadManager.h"
 
 namespace UnrealSharp
 {
@@ -54,10 +56,17 @@ namespace UnrealSharp
 
         virtual ICSharpLibraryAccessor*                         GetCSharpLibraryAccessor() override;
         virtual ICSharpObjectTable*                             GetObjectTable() override;        
+        virtual FCSharpAsyncLoadManager*                        GetAsyncLoadManager() override;
+        virtual void                                            ResetSession() override;
+        virtual bool                                            HotReload(FCSharpHotReloadReport& OutReport) override final;
     protected:
         virtual bool                                            InitializeInternal() = 0;
         virtual void                                            ShutdownInternal() = 0;
 
+        // shutdown and initialize the backend again for hot reload
+        virtual bool                                            CanReload() const { return false; }
+        virtual bool                                            ReloadInternal() { return false; }
+
         virtual void                                            PostInitialized();
         virtual void                                            BeforeShutdown();        
 
@@ -65,9 +74,16 @@ namespace UnrealSharp
         virtual TSharedPtr< ICSharpObjectTable>                 CreateCSharpObjectTable();
         void                                                    InvokeMain();
 
+        // called after C# main is invoked and C# functions are redirected, bind and prewarm codes by JitPrewarmMode
+        virtual void                                            PostMainInvoked();
+
+        // resolve and compile methods and types on background threads
+        virtual void                                            PrewarmAsync(TArray<FCSharpStartupProfile::FEntry>&& InEntries) {}
+
     protected:
         TSharedPtr<ICSharpLibraryAccessor>                      CSharpLibraryAccessorPtr;
         TSharedPtr<ICSharpObjectTable>                          ObjectTablePtr;
+        TUniquePtr<FCSharpAsyncLoadManager>                     AsyncLoadManagerPtr;
         TMap<const UStruct*, TSharedPtr<FCSharpStructFactory>>  StructFactories;
 
         TMap<const UField*, FString>                            CSharpFullPathDict;
@@ -27,12 +27,68 @@
 #include "MonoRuntime/MonoRuntime.h"
 #include "Misc/CSharpFunctionRedirectionUtils.h"
 #include "Misc/UnrealSharpLog.h"
+#include "Classes/UnrealSharpSettings.h"
+#include "HAL/IConsoleManager.h"
 
 namespace UnrealSharp
 {
     TRefCountPtr<ICSharpRuntime> Z_GlobalCSharpRuntime;
+
+    // the runtime is only referenced by Z_GlobalCSharpRuntime, waiting for next PIE session
+    static bool Z_bIsCSharpRuntimeKeptAlive = false;
+
+    static FAutoConsoleCommand HotReloadCSharpRuntimeCommand(
+        TEXT("UnrealSharp.HotReload"),
+        TEXT("Reload rebuilt C# assemblies and rebind C# proxy objects of live UObjects, only available in editor."),
+        FConsoleCommandDelegate::CreateLambda([]() { FCSharpRuntimeFactory::HotReloadCSharpRuntime(); })
+    );
+
+    static bool ShouldKeepCSharpRuntimeAlive()
+    {
+#if WITH_EDITOR
+        return GIsEditor && !IsEngineExitRequested() && GetDefault<UUnrealSharpSettings>()->bKeepRuntimeAliveBetweenPIESessions;
+#else
+        return false;
+#endif
+    }
+
+    static void ShutdownGlobalCSharpRuntime()
+    {
+        check(Z_GlobalCSharpRuntime && Z_GlobalCSharpRuntime->GetRefCount() == 1);
+
+        Z_GlobalCSharpRuntime->Shutdown();
+
+        US_LOG(TEXT("Shutdown C# runtime success."));
+
+        Z_GlobalCSharpRuntime.SafeRelease();
+
+        check(!Z_GlobalCSharpRuntime.IsValid());
+
+        FCSharpFunctionRedirectionUtils::RestoreAllCSharpFunctions();
+
+        US_LOG(TEXT("restore all C# functions success."));
+    }
+
     TRefCountPtr<ICSharpRuntime> FCSharpRuntimeFactory::RetainCSharpRuntime()
     {
+        if (Z_GlobalCSharpRuntime && Z_bIsCSharpRuntimeKeptAlive)
+        {
+            Z_bIsCSharpRuntimeKeptAlive = false;
+
+            if (Z_GlobalCSharpRuntime->IsAssemblyChanged())
+            {
+                US_LOG(TEXT("UnrealSharp assemblies are changed, restart C# runtime."));
+
+                ShutdownGlobalCSharpRuntime();
+            }
+            else
+            {
+                FCSharpFunctionRedirectionUtils::RedirectAllCSharpFunctions();
+
+                US_LOG(TEXT("Reuse C# runtime kept alive from last session."));
+            }
+        }
+
         if (Z_GlobalCSharpRuntime)
         {
             return Z_GlobalCSharpRuntime;
@@ -54,34 +110,86 @@ namespace UnrealSharp
 
         US_LOG(TEXT("Initialize C# runtime Success."));
 
-        FCSharpFunctionRedirectionUtils::RedirectAllCSharpFunctions();
-
-        US_LOG(TEXT("Redirect C# functions Success."));
-
         return Z_GlobalCSharpRuntime;
     }
 
     void FCSharpRuntimeFactory::ReleaseCSharpRuntime(TRefCountPtr<ICSharpRuntime>&& InRuntime)
     {
+        const bool bIsGlobalRuntime = InRuntime.GetReference() == Z_GlobalCSharpRuntime.GetReference();
+
         InRuntime.SafeRelease();
 
+        if (!bIsGlobalRuntime)
+        {
+            // detached by a failed hot reload, it is destroyed with the last reference
+            return;
+        }
+
         if (Z_GlobalCSharpRuntime->GetRefCount() == 1)
         {
+            if (ShouldKeepCSharpRuntimeAlive())
+            {
+                // editor may call these functions on CDOs between sessions, so don't redirect them to C# 
+                Z_GlobalCSharpRuntime->ResetSession();
+                FCSharpFunctionRedirectionUtils::RestoreAllCSharpFunctions();
+
+                Z_bIsCSharpRuntimeKeptAlive = true;
+
+                US_LOG(TEXT("This is Last C# Runtime reference, keep it alive for next session."));
+                return;
+            }
+
             US_LOG(TEXT("This is Last C# Runtime, release it."));
 
             // this is the last one
-            Z_GlobalCSharpRuntime->Shutdown();
+            ShutdownGlobalCSharpRuntime();
+        }
+    }
+
+    void FCSharpRuntimeFactory::ShutdownKeptAliveCSharpRuntime()
+    {
+        if (Z_GlobalCSharpRuntime && Z_bIsCSharpRuntimeKeptAlive)
+        {
+            Z_bIsCSharpRuntimeKeptAlive = false;
 
-            US_LOG(TEXT("Shutdown C# runtime success."));
+            US_LOG(TEXT("Release C# runtime kept alive."));
 
-            Z_GlobalCSharpRuntime.SafeRelease();
+            ShutdownGlobalCSharpRuntime();
+        }
+    }
+
+    bool FCSharpRuntimeFactory::HotReloadCSharpRuntime()
+    {
+        if (!Z_GlobalCSharpRuntime)
+        {
+            US_LOG_WARN(TEXT("There is no C# runtime to reload."));
+            return false;
+        }
 
-            check(!Z_GlobalCSharpRuntime.IsValid());
+        if (Z_bIsCSharpRuntimeKeptAlive)
+        {
+            // nothing is running, just start a new one in next session
+            ShutdownKeptAliveCSharpRuntime();
+            return true;
+        }
+
+        FCSharpHotReloadReport Report;
+
+        if (Z_GlobalCSharpRuntime->HotReload(Report))
+        {
+            return true;
+        }
 
-            FCSharpFunctionRedirectionUtils::RestoreAllCSharpFunctions();
+        if (Report.bIsRuntimeLost)
+        {
+            // it has no domain any more, so it can't be shut down again,
+            // sessions holding it release it later, and next session starts a new one
+            US_LOG_ERROR(TEXT("C# runtime is lost by the failed hot reload, C# is not available until next session."));
 
-            US_LOG(TEXT("restore all C# functions success."));
+            Z_GlobalCSharpRuntime.SafeRelease();
         }
+
+        return false;
     }
 
     bool FCSharpRuntimeFactory::IsGlobalCSharpRuntimeValid()
@@ -89,6 +197,11 @@ namespace UnrealSharp
         return Z_GlobalCSharpRuntime.IsValid();
     }
 
+    bool FCSharpRuntimeFactory::IsGlobalCSharpRuntimeActive()
+    {
+        return Z_GlobalCSharpRuntime.IsValid() && !Z_bIsCSharpRuntimeKeptAlive;
+    }
+
     ICSharpRuntime* FCSharpRuntimeFactory::GetInstance()
     {
         check(Z_GlobalCSharpRuntime);
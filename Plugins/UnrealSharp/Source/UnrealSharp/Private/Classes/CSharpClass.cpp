@@ -29,6 +29,7 @@
 #include "UnrealFunctionInvokeRedirector.h"
 #include "ICSharpLibraryAccessor.h"
 #include "Misc/InteropUtils.h"
+#include "Misc/CSharpStartupProfile.h"
 
 bool FCSharpFunctionArgumentData::IsPassByReference() const
 {
@@ -122,7 +123,8 @@ void UCSharpClass::StaticClassConstructor(UCSharpClass* InCSharpClass, const FOb
     {
         UnrealSharp::FCSharpObjectMarshalValue CSharpObject;
 
-        if (UnrealSharp::FCSharpRuntimeFactory::IsGlobalCSharpRuntimeValid())
+        // objects created by editor between PIE sessions don't have C# proxies
+        if (UnrealSharp::FCSharpRuntimeFactory::IsGlobalCSharpRuntimeActive())
         {
             CSharpObject = UnrealSharp::FInteropUtils::GetCSharpObjectOfUnrealObject(ObjectInitializer.GetObj());
 
@@ -221,32 +223,58 @@ void UCSharpClass::CallCSharpFunction(UObject* Context, FFrame& TheStack, RESULT
 
     if (!Data->Invoker)
     {
-        UnrealSharp::ICSharpRuntime* Runtime = UnrealSharp::FCSharpRuntimeFactory::GetInstance();
+        Class->CreateCSharpFunctionInvoker(*Data);
+    }
+
+    Data->Invoker->Invoke(Context, TheStack, RESULT_PARAM);
+}
+
+bool UCSharpClass::BindCSharpFunction(const UFunction* InFunction)
+{
+    FCSharpFunctionRedirectionData* Data = RedirectionCaches.Find(const_cast<UFunction*>(InFunction));
+
+    if (Data == nullptr)
+    {
+        return false;
+    }
+
+    if (!Data->Invoker)
+    {
+        CreateCSharpFunctionInvoker(*Data);
+    }
+
+    return true;
+}
 
-        checkSlow(Runtime != nullptr);
+void UCSharpClass::CreateCSharpFunctionInvoker(FCSharpFunctionRedirectionData& InData)
+{
+    UFunction* Func = InData.Function;
 
-        const FString& Signature = Class->GetCSharpFunctionSignature(*Func->GetName());
+    UnrealSharp::ICSharpRuntime* Runtime = UnrealSharp::FCSharpRuntimeFactory::GetInstance();
 
-        checkf(!Signature.IsEmpty(), TEXT("missing C# method signature for: %s.%s"), *Class->CSharpFullName, *Func->GetName());
+    checkSlow(Runtime != nullptr);
 
-        TSharedPtr<UnrealSharp::ICSharpMethodInvocation> InvocationPtr = Runtime->CreateCSharpMethodInvocation(Class->AssemblyName, Signature);
+    const FString& Signature = GetCSharpFunctionSignature(*Func->GetName());
 
-        checkf(InvocationPtr, TEXT("Failed create invocation from signature (%s) in %s"), *Signature, *Class->CSharpFullName);
+    checkf(!Signature.IsEmpty(), TEXT("missing C# method signature for: %s.%s"), *CSharpFullName, *Func->GetName());
 
-        const TSharedPtr<UnrealSharp::FUnrealFunctionInvokeRedirector> Invoker = 
-            MakeShared<UnrealSharp::FUnrealFunctionInvokeRedirector>(
-                Runtime, 
-                Class, 
-                Func, 
-                Data->FunctionData, 
-                InvocationPtr
-            );
+    TSharedPtr<UnrealSharp::ICSharpMethodInvocation> InvocationPtr = Runtime->CreateCSharpMethodInvocation(AssemblyName, Signature);
 
-        Data->Invoker = Invoker;
+    checkf(InvocationPtr, TEXT("Failed create invocation from signature (%s) in %s"), *Signature, *CSharpFullName);
 
-        checkf(Data->Invoker, TEXT("Failed bind C# method %s:%s"), *Class->CSharpFullName, *Func->GetName());
-    }
+    const TSharedPtr<UnrealSharp::FUnrealFunctionInvokeRedirector> Invoker = 
+        MakeShared<UnrealSharp::FUnrealFunctionInvokeRedirector>(
+            Runtime, 
+            this, 
+            Func, 
+            InData.FunctionData, 
+            InvocationPtr
+        );
 
-    Data->Invoker->Invoke(Context, TheStack, RESULT_PARAM);
+    InData.Invoker = Invoker;
+
+    checkf(InData.Invoker, TEXT("Failed bind C# method %s:%s"), *CSharpFullName, *Func->GetName());
+
+    UnrealSharp::FCSharpStartupProfile::Record(UnrealSharp::FCSharpStartupProfile::EEntryKind::Redirector, FString(), Func->GetPathName());
 }
 
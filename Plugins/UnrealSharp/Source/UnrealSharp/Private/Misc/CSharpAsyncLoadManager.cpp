@@ -0,0 +1,268 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "Misc/CSharpAsyncLoadManager.h"
+#include "ICSharpRuntime.h"
+#include "ICSharpMethodInvocation.h"
+#include "Misc/UnrealSharpUtils.h"
+#include "Misc/UnrealSharpLog.h"
+#include "Misc/StackMemory.h"
+#include "Misc/ScopedCSharpMethodInvocation.h"
+#include "HAL/IConsoleManager.h"
+
+namespace UnrealSharp
+{
+    static FAutoConsoleCommand DumpAsyncLoadStatisticsCommand(
+        TEXT("UnrealSharp.DumpAsyncLoadStatistics"),
+        TEXT("Print statistics of asynchronous loads requested by C#."),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            if (!FCSharpRuntimeFactory::IsGlobalCSharpRuntimeValid())
+            {
+                US_LOG(TEXT("There is no C# runtime."));
+                return;
+            }
+
+            if (FCSharpAsyncLoadManager* AsyncLoadManager = FCSharpRuntimeFactory::GetInstance()->GetAsyncLoadManager(); AsyncLoadManager != nullptr)
+            {
+                AsyncLoadManager->DumpStatistics();
+            }
+        })
+    );
+
+    FCSharpAsyncLoadManager::FCSharpAsyncLoadManager(ICSharpRuntime* InRuntime) :
+        Runtime(InRuntime)
+    {
+        check(InRuntime);
+
+        CompletedInvocation = FUnrealSharpUtils::BindUnrealEngineCSharpMethodChecked(InRuntime, TEXT("AsyncLoadManager"), TEXT("OnAsyncLoadCompleted (int)"));
+        AllCanceledInvocation = FUnrealSharpUtils::BindUnrealEngineCSharpMethodChecked(InRuntime, TEXT("AsyncLoadManager"), TEXT("OnAllAsyncLoadsCanceled ()"));
+    }
+
+    FCSharpAsyncLoadManager::~FCSharpAsyncLoadManager()
+    {
+        // C# can't be notified any more, tasks waiting for them are canceled by C# when its runtime is gone
+        for (auto& Pair : Requests)
+        {
+            if (Pair.Value.State == ERequestState::Pending && Pair.Value.Handle)
+            {
+                Pair.Value.Handle->CancelHandle();
+            }
+        }
+
+        Requests.Empty();
+    }
+
+    int32 FCSharpAsyncLoadManager::RequestAsyncLoad(TArray<FSoftObjectPath>&& InPaths, int32 InPriority)
+    {
+        // keep null paths in the request, the loaded objects are returned in the requested order
+        TArray<FSoftObjectPath> PathsToLoad = InPaths.FilterByPredicate([](const FSoftObjectPath& Path) { return !Path.IsNull(); });
+
+        if (PathsToLoad.IsEmpty())
+        {
+            return 0;
+        }
+
+        const int32 RequestId = NextRequestId++;
+
+        // 0 means no request, ids wrap after 2 billion requests
+        if (NextRequestId <= 0)
+        {
+            NextRequestId = 1;
+        }
+
+        FRequest& NewRequest = Requests.Add(RequestId);
+        NewRequest.Paths = MoveTemp(InPaths);
+        NewRequest.StartTime = FPlatformTime::Seconds();
+
+        ++Statistics.PendingCount;
+
+        // the delegate may be executed in this call if all objects are loaded, 
+        // and C# may make new requests in it, so don't keep references into Requests
+        TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+            MoveTemp(PathsToLoad),
+            FStreamableDelegate::CreateRaw(this, &FCSharpAsyncLoadManager::OnRequestCompleted, RequestId),
+            InPriority,
+            false,
+            false,
+            TEXT("UnrealSharp")
+        );
+
+        if (FRequest* Request = Requests.Find(RequestId); Request != nullptr)
+        {
+            Request->Handle = Handle;
+
+            // the delegate is never executed without a handle
+            if (!Handle.IsValid())
+            {
+                OnRequestCompleted(RequestId);
+            }
+        }
+        else if (Handle.IsValid())
+        {
+            // released by C# in the delegate
+            Handle->ReleaseHandle();
+        }
+
+        return RequestId;
+    }
+
+    FCSharpAsyncLoadManager::ERequestState FCSharpAsyncLoadManager::GetState(int32 InRequestId, float* OutProgress) const
+    {
+        const FRequest* Request = Requests.Find(InRequestId);
+
+        if (OutProgress != nullptr)
+        {
+            *OutProgress = Request == nullptr ? 0.0f : 
+                Request->State != ERequestState::Pending ? 1.0f :
+                Request->Handle.IsValid() ? Request->Handle->GetProgress() : 0.0f;
+        }
+
+        return Request != nullptr ? Request->State : ERequestState::Invalid;
+    }
+
+    int32 FCSharpAsyncLoadManager::GetLoadedObjects(int32 InRequestId, UObject** OutObjects, int32 InCount) const
+    {
+        const FRequest* Request = Requests.Find(InRequestId);
+
+        if (Request == nullptr || Request->State != ERequestState::Completed || OutObjects == nullptr)
+        {
+            return 0;
+        }
+
+        int32 LoadedCount = 0;
+
+        for (int32 i = 0; i < InCount; ++i)
+        {
+            OutObjects[i] = Request->Paths.IsValidIndex(i) ? Request->Paths[i].ResolveObject() : nullptr;
+
+            LoadedCount += OutObjects[i] != nullptr ? 1 : 0;
+        }
+
+        return LoadedCount;
+    }
+
+    void FCSharpAsyncLoadManager::Cancel(int32 InRequestId)
+    {
+        FRequest* Request = Requests.Find(InRequestId);
+
+        if (Request == nullptr || Request->State != ERequestState::Pending)
+        {
+            return;
+        }
+
+        Request->State = ERequestState::Canceled;
+
+        --Statistics.PendingCount;
+        ++Statistics.CanceledCount;
+
+        if (Request->Handle.IsValid())
+        {
+            Request->Handle->CancelHandle();
+        }
+    }
+
+    void FCSharpAsyncLoadManager::Release(int32 InRequestId)
+    {
+        Cancel(InRequestId);
+
+        if (FRequest Request; Requests.RemoveAndCopyValue(InRequestId, Request) && Request.Handle.IsValid())
+        {
+            Request.Handle->ReleaseHandle();
+        }
+    }
+
+    void FCSharpAsyncLoadManager::CancelAll()
+    {
+        check(IsInGameThread());
+
+        // C# may make new requests when its tasks are canceled, they belong to the next session
+        TMap<int32, FRequest> CanceledRequests = MoveTemp(Requests);
+        Requests.Reset();
+
+        for (auto& Pair : CanceledRequests)
+        {
+            if (Pair.Value.State == ERequestState::Pending)
+            {
+                --Statistics.PendingCount;
+                ++Statistics.CanceledCount;
+
+                if (Pair.Value.Handle.IsValid())
+                {
+                    Pair.Value.Handle->CancelHandle();
+                }
+            }
+
+            if (Pair.Value.Handle.IsValid())
+            {
+                Pair.Value.Handle->ReleaseHandle();
+            }
+        }
+
+        if (!CanceledRequests.IsEmpty())
+        {
+            US_LOG(TEXT("Canceled %d C# async loads of the ended session."), CanceledRequests.Num());
+        }
+
+        US_SCOPED_CSHARP_METHOD_INVOCATION(AllCanceledInvocation);
+
+        AllCanceledInvocationInvoker.Invoke(nullptr);
+    }
+
+    void FCSharpAsyncLoadManager::OnRequestCompleted(int32 InRequestId)
+    {
+        FRequest* Request = Requests.Find(InRequestId);
+
+        if (Request == nullptr || Request->State != ERequestState::Pending)
+        {
+            return;
+        }
+
+        Request->State = ERequestState::Completed;
+
+        const double Seconds = FPlatformTime::Seconds() - Request->StartTime;
+
+        --Statistics.PendingCount;
+        ++Statistics.CompletedCount;
+        Statistics.TotalLoadSeconds += Seconds;
+        Statistics.MaxLoadSeconds = FMath::Max(Statistics.MaxLoadSeconds, Seconds);
+
+        US_SCOPED_CSHARP_METHOD_INVOCATION(CompletedInvocation);
+
+        CompletedInvocationInvoker.Invoke(nullptr, &InRequestId);
+    }
+
+    void FCSharpAsyncLoadManager::DumpStatistics() const
+    {
+        US_LOG(TEXT("C# async loads: %d pending, %d completed, %d canceled, %.2f ms average, %.2f ms max, %d requests not released."),
+            Statistics.PendingCount,
+            Statistics.CompletedCount,
+            Statistics.CanceledCount,
+            Statistics.CompletedCount > 0 ? Statistics.TotalLoadSeconds * 1000.0 / Statistics.CompletedCount : 0.0,
+            Statistics.MaxLoadSeconds * 1000.0,
+            Requests.Num()
+        );
+    }
+}
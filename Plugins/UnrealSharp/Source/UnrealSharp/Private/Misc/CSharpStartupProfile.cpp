@@ -0,0 +1,142 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "Misc/CSharpStartupProfile.h"
+#include "Misc/UnrealSharpLog.h"
+#include "Misc/UnrealSharpPaths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/IConsoleManager.h"
+
+namespace UnrealSharp
+{
+    FCriticalSection FCSharpStartupProfile::CriticalSection;
+    TArray<FCSharpStartupProfile::FEntry> FCSharpStartupProfile::Entries;
+    TSet<FString> FCSharpStartupProfile::RecordedKeys;
+    bool FCSharpStartupProfile::bIsRecording = false;
+
+    static const TCHAR EntryKindNames[] = { TEXT('M'), TEXT('T'), TEXT('S'), TEXT('R') };
+
+    static FAutoConsoleCommand SaveStartupProfileCommand(
+        TEXT("UnrealSharp.SaveStartupProfile"),
+        TEXT("Save C# startup profile recorded by this session, it is saved automatically when the runtime shuts down."),
+        FConsoleCommandDelegate::CreateLambda([]() { FCSharpStartupProfile::Save(FUnrealSharpPaths::GetStartupProfilePath()); })
+    );
+
+    void FCSharpStartupProfile::StartRecording()
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        Entries.Empty();
+        RecordedKeys.Empty();
+        bIsRecording = true;
+    }
+
+    void FCSharpStartupProfile::StopRecording()
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        bIsRecording = false;
+    }
+
+    void FCSharpStartupProfile::RecordInternal(EEntryKind InKind, const FString& InAssemblyName, const FString& InName)
+    {
+        FString Line = FString::Printf(TEXT("%c\t%s\t%s"), EntryKindNames[(int)InKind], *InAssemblyName, *InName);
+
+        FScopeLock Lock(&CriticalSection);
+
+        bool bIsAlreadyRecorded = false;
+        RecordedKeys.Add(MoveTemp(Line), &bIsAlreadyRecorded);
+
+        if (!bIsAlreadyRecorded)
+        {
+            Entries.Add({ InKind, InAssemblyName, InName });
+        }
+    }
+
+    bool FCSharpStartupProfile::Save(const FString& InFilePath)
+    {
+        TArray<FString> Lines;
+
+        {
+            FScopeLock Lock(&CriticalSection);
+
+            if (Entries.IsEmpty())
+            {
+                return false;
+            }
+
+            Lines.Reserve(Entries.Num());
+
+            for (const FEntry& Entry : Entries)
+            {
+                Lines.Add(FString::Printf(TEXT("%c\t%s\t%s"), EntryKindNames[(int)Entry.Kind], *Entry.AssemblyName, *Entry.Name));
+            }
+        }
+
+        if (!FFileHelper::SaveStringArrayToFile(Lines, *InFilePath))
+        {
+            US_LOG_ERROR(TEXT("Failed save C# startup profile to %s."), *InFilePath);
+            return false;
+        }
+
+        US_LOG(TEXT("Saved C# startup profile with %d entries to %s."), Lines.Num(), *InFilePath);
+
+        return true;
+    }
+
+    bool FCSharpStartupProfile::Load(const FString& InFilePath, TArray<FEntry>& OutEntries)
+    {
+        TArray<FString> Lines;
+
+        if (!FFileHelper::LoadFileToStringArray(Lines, *InFilePath))
+        {
+            return false;
+        }
+
+        OutEntries.Reserve(OutEntries.Num() + Lines.Num());
+
+        for (const FString& Line : Lines)
+        {
+            TArray<FString> Fields;
+
+            // keep the empty assembly name of struct factories and redirectors
+            if (Line.ParseIntoArray(Fields, TEXT("\t"), false) != 3 || Fields[0].Len() != 1)
+            {
+                continue;
+            }
+
+            for (int i = 0; i < UE_ARRAY_COUNT(EntryKindNames); ++i)
+            {
+                if (Fields[0][0] == EntryKindNames[i])
+                {
+                    OutEntries.Add({ (EEntryKind)i, MoveTemp(Fields[1]), MoveTemp(Fields[2]) });
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+}
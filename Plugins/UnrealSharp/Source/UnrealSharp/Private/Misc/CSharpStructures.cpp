@@ -24,6 +24,7 @@
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
 #include "Misc/CSharpStructures.h"
+#include "Misc/UnrealInteropFunctions.h"
 
 namespace UnrealSharp
 {    
@@ -67,6 +68,8 @@ namespace UnrealSharp
         Result.Configuration = EUnrealSharpBuildConfiguration::Release;
 #endif
 
+        Result.InteropFunctionTableLayoutHash = FUnrealInteropFunctionTable::GetLayoutHash();
+
         return Result;
     }
 
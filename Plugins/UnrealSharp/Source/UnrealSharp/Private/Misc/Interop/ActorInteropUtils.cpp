@@ -25,6 +25,7 @@
 */
 #include "Misc/InteropUtils.h"
 #include "Engine/World.h"
+#include "GameFramework/Actor.h"
 
 namespace UnrealSharp
 {
@@ -69,5 +70,60 @@ namespace UnrealSharp
 
         return Actor != nullptr ? GetCSharpObjectOfUnrealObject(Actor) : FCSharpObjectMarshalValue();
     }
+
+    int FInteropUtils::SpawnActorsDeferred(UWorld* InWorld, UClass* InClass, const void* InTransformsPtr, int InTransformSize, int InCount, AActor** OutActors)
+    {
+        check(InWorld);
+        check(InTransformsPtr != nullptr || InCount == 0);
+        check(InTransformSize == sizeof(FTransform));
+        check(OutActors != nullptr || InCount == 0);
+
+        int SpawnedCount = 0;
+
+        for (int i = 0; i < InCount; ++i)
+        {
+            // see SpawnActorByTransform, don't trust the alignment of C# memory
+            FTransform Transform;
+            memcpy(&Transform, (const uint8*)InTransformsPtr + i * InTransformSize, InTransformSize); // NOLINT
+
+            // constructors of C# classes run here, the same as SpawnActor
+            AActor* Actor = InWorld->SpawnActorDeferred<AActor>(InClass, Transform);
+
+            if (Actor != nullptr)
+            {
+                // create proxies in this call, so C# finds all of them without interop calls
+                GetCSharpObjectOfUnrealObject(Actor);
+
+                ++SpawnedCount;
+            }
+
+            OutActors[i] = Actor;
+        }
+
+        return SpawnedCount;
+    }
+
+    void FInteropUtils::FinishSpawningActors(AActor** InActors, const void* InTransformsPtr, int InTransformSize, int InCount)
+    {
+        check(InActors != nullptr || InCount == 0);
+        check(InTransformsPtr != nullptr || InCount == 0);
+        check(InTransformSize == sizeof(FTransform));
+
+        for (int i = 0; i < InCount; ++i)
+        {
+            AActor* Actor = InActors[i];
+
+            // may be destroyed by C# code between the two calls
+            if (!IsValid(Actor) || Actor->IsActorInitialized())
+            {
+                continue;
+            }
+
+            FTransform Transform;
+            memcpy(&Transform, (const uint8*)InTransformsPtr + i * InTransformSize, InTransformSize); // NOLINT
+
+            Actor->FinishSpawning(Transform);
+        }
+    }
 }
 
@@ -26,6 +26,7 @@
 #include "Misc/InteropUtils.h"
 #include "Misc/UnrealSharpUtils.h"
 #include "Classes/CSharpStruct.h"
+#include "Misc/UnrealFieldResolver.h"
 
 namespace UnrealSharp
 {
@@ -51,9 +52,39 @@ namespace UnrealSharp
             return nullptr;
         }
 
-        const UField* Result = LoadObject<UField>(nullptr, US_STRING_TO_TCHAR(InCSharpFieldPathName));
+        return FUnrealFieldResolver::Get().ResolveField(US_STRING_TO_TCHAR(InCSharpFieldPathName));
+    }
+
+    int FInteropUtils::LoadUnrealFields(const char* InCSharpFieldPathNames, const UField** OutFields, int InCount)
+    {
+        if (InCSharpFieldPathNames == nullptr || OutFields == nullptr || InCount <= 0)
+        {
+            return 0;
+        }
+
+        // field paths are packed into one string by C#, separated by ';'
+        TArray<FString> FieldPaths;
+        FString(US_STRING_TO_TCHAR(InCSharpFieldPathNames)).ParseIntoArray(FieldPaths, TEXT(";"), true);
+
+        checkf(FieldPaths.Num() == InCount, TEXT("Field path count mismatch, C# count = %d, native count = %d"), InCount, FieldPaths.Num());
+
+        TArray<const UField*> Fields;
+        FUnrealFieldResolver::Get().ResolveFields(FieldPaths, Fields);
+
+        int FoundCount = 0;
+        const int Count = FMath::Min(InCount, Fields.Num());
 
-        return Result;
+        for (int i = 0; i < Count; ++i)
+        {
+            OutFields[i] = Fields[i];
+
+            if (Fields[i] != nullptr)
+            {
+                ++FoundCount;
+            }
+        }
+
+        return FoundCount;
     }
 
     bool FInteropUtils::CheckUClassIsChildOf(const UClass* InTestClass, const UClass* InTestBaseClass)
@@ -81,22 +112,60 @@ namespace UnrealSharp
             return nullptr;
         }
 
-        const FName TargetName = US_STRING_TO_TCHAR(InCSharpPropertyName);
+        return FUnrealFieldResolver::Get().FindProperty(InStruct, US_STRING_TO_TCHAR(InCSharpPropertyName));
+    }
 
-        if (const UUserDefinedStruct* UserDefinedStruct = Cast<UUserDefinedStruct>(InStruct))
+    int FInteropUtils::GetPropertyMetaCaches(const UStruct* InStruct, const char* InCSharpPropertyNames, FPropertyMetaCache* OutMetaCaches, int InCount)
+    {
+        if (InStruct == nullptr || InCSharpPropertyNames == nullptr || OutMetaCaches == nullptr || InCount <= 0)
         {
-            for (const FProperty* Property = UserDefinedStruct->PropertyLink; Property != nullptr; Property = Property->PropertyLinkNext)
-            {                
-                const FName PropertyName = FUnrealSharpUtils::ExtraUserDefinedStructPropertyName(Property);
-
-                if (PropertyName == TargetName)
-                {
-                    return Property;
-                }
+            return 0;
+        }
+
+        // property names are packed into one string by C#, separated by ';'
+        TArray<FString> PropertyNames;
+        FString(US_STRING_TO_TCHAR(InCSharpPropertyNames)).ParseIntoArray(PropertyNames, TEXT(";"), true);
+
+        checkf(PropertyNames.Num() == InCount, TEXT("Property name count mismatch, C# count = %d, native count = %d"), InCount, PropertyNames.Num());
+
+        FUnrealFieldResolver& Resolver = FUnrealFieldResolver::Get();
+
+        int FoundCount = 0;
+        const int Count = FMath::Min(InCount, PropertyNames.Num());
+
+        for (int i = 0; i < Count; ++i)
+        {
+            FPropertyMetaCache& MetaCache = OutMetaCaches[i];
+            const FProperty* Property = Resolver.FindProperty(InStruct, FName(*PropertyNames[i]));
+
+            if (Property != nullptr)
+            {
+                MetaCache.PropertyPointer = Property;
+                MetaCache.Offset = Property->GetOffset_ReplaceWith_ContainerPtrToValuePtr();
+                MetaCache.Size = Property->GetSize();
+
+                ++FoundCount;
             }
+            else
+            {
+                MetaCache = FPropertyMetaCache();
+            }
+        }
+
+        return FoundCount;
+    }
+
+    const UStruct* FInteropUtils::LoadStructPropertyMetaCaches(const char* InCSharpStructPathName, const char* InCSharpPropertyNames, FPropertyMetaCache* OutMetaCaches, int InCount)
+    {
+        // the struct and its properties are resolved by one interop call
+        const UStruct* Struct = Cast<UStruct>(LoadUnrealField(InCSharpStructPathName));
+
+        if (Struct != nullptr)
+        {
+            GetPropertyMetaCaches(Struct, InCSharpPropertyNames, OutMetaCaches, InCount);
         }
 
-        return InStruct->FindPropertyByName(TargetName);
+        return Struct;
     }
 
     const UFunction* FInteropUtils::GetFunction(const UClass* InClass, const char* InCSharpFunctionName)
@@ -59,6 +59,15 @@ namespace UnrealSharp
         return { Runtime->GetObjectTable()->GetCSharpObject(const_cast<UObject*>(InObject)) };
     }
 
+    const FCSharpObjectHandleSlotTable* FInteropUtils::GetCSharpObjectHandleSlotTable()
+    {
+        ICSharpRuntime* Runtime = FCSharpRuntimeFactory::GetInstance();
+
+        check(Runtime);
+
+        return Runtime->GetObjectTable()->GetHandleSlotTable();
+    }
+
     FCSharpObjectMarshalValue FInteropUtils::GetOuterOfUnrealObject(const UObject* InObject)
     {
         if (InObject == nullptr)
@@ -24,6 +24,8 @@
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
 #include "Misc/InteropUtils.h"
+#include "Misc/CSharpAsyncLoadManager.h"
+#include "ICSharpRuntime.h"
 
 namespace UnrealSharp
 {
@@ -112,5 +114,62 @@ namespace UnrealSharp
             }
         }
     }
-}
 
+    static FCSharpAsyncLoadManager* GetAsyncLoadManager()
+    {
+        ICSharpRuntime* Runtime = FCSharpRuntimeFactory::GetInstance();
+
+        check(Runtime);
+
+        FCSharpAsyncLoadManager* Manager = Runtime->GetAsyncLoadManager();
+
+        check(Manager);
+
+        return Manager;
+    }
+
+    int FInteropUtils::RequestAsyncLoadSoftObjectPtrs(const FSoftObjectPtr** InSoftObjectPtrs, int InCount, int InPriority)
+    {
+        if (InSoftObjectPtrs == nullptr || InCount <= 0)
+        {
+            return 0;
+        }
+
+        TArray<FSoftObjectPath> Paths;
+        Paths.Reserve(InCount);
+
+        for (int i = 0; i < InCount; ++i)
+        {
+            Paths.Add(InSoftObjectPtrs[i] != nullptr ? InSoftObjectPtrs[i]->ToSoftObjectPath() : FSoftObjectPath());
+        }
+
+        return GetAsyncLoadManager()->RequestAsyncLoad(MoveTemp(Paths), InPriority);
+    }
+
+    int FInteropUtils::GetAsyncLoadState(int InRequestId, float* OutProgress)
+    {
+        return static_cast<int>(GetAsyncLoadManager()->GetState(InRequestId, OutProgress));
+    }
+
+    int FInteropUtils::GetAsyncLoadedObjects(int InRequestId, UObject** OutObjects, int InCount)
+    {
+        return GetAsyncLoadManager()->GetLoadedObjects(InRequestId, OutObjects, InCount);
+    }
+
+    void FInteropUtils::CancelAsyncLoad(int InRequestId)
+    {
+        GetAsyncLoadManager()->Cancel(InRequestId);
+    }
+
+    void FInteropUtils::ReleaseAsyncLoad(int InRequestId)
+    {
+        GetAsyncLoadManager()->Release(InRequestId);
+    }
+
+    void FInteropUtils::GetAsyncLoadStatistics(FCSharpAsyncLoadStatistics* OutStatistics)
+    {
+        check(OutStatistics);
+
+        *OutStatistics = GetAsyncLoadManager()->GetStatistics();
+    }
+}
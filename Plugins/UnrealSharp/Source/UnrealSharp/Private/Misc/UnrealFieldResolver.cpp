@@ -0,0 +1,239 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "Misc/UnrealFieldResolver.h"
+#include "Misc/UnrealSharpUtils.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Misc/PackageName.h"
+
+namespace UnrealSharp
+{
+    FUnrealFieldResolver& FUnrealFieldResolver::Get()
+    {
+        static FUnrealFieldResolver Instance;
+        return Instance;
+    }
+
+    void FUnrealFieldResolver::Startup()
+    {
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+        {
+            Invalidate();
+        });
+
+        // property pointers of a collected struct are not valid any more
+        PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([this]()
+        {
+            for (auto It = PropertyCache.CreateIterator(); It; ++It)
+            {
+                if (!It->Value.Struct.IsValid())
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        });
+
+#if WITH_EDITOR
+        // blueprint recompiling will reinstance classes and regenerate properties
+        ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([this](const TMap<UObject*, UObject*>&)
+        {
+            Invalidate();
+        });
+#endif
+    }
+
+    void FUnrealFieldResolver::Shutdown()
+    {
+        FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+        FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+#if WITH_EDITOR
+        FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+#endif
+
+        Invalidate();
+    }
+
+    const UField* FUnrealFieldResolver::ResolveField(const FString& InFieldPath)
+    {
+        check(IsInGameThread());
+
+        if (const UField* Field = FindCachedField(InFieldPath))
+        {
+            return Field;
+        }
+
+        const UField* Field = LoadField(InFieldPath);
+
+        if (Field != nullptr)
+        {
+            FieldCache.Add(InFieldPath, Field);
+        }
+
+        return Field;
+    }
+
+    void FUnrealFieldResolver::ResolveFields(const TArray<FString>& InFieldPaths, TArray<const UField*>& OutFields)
+    {
+        check(IsInGameThread());
+
+        OutFields.SetNumZeroed(InFieldPaths.Num());
+
+        // package name -> indices of fields in this package
+        TMap<FString, TArray<int>> PackageGroups;
+
+        for (int i = 0; i < InFieldPaths.Num(); ++i)
+        {
+            const FString& FieldPath = InFieldPaths[i];
+
+            if (const UField* Field = FindCachedField(FieldPath))
+            {
+                OutFields[i] = Field;
+                continue;
+            }
+
+            PackageGroups.FindOrAdd(FPackageName::ObjectPathToPackageName(FieldPath)).Add(i);
+        }
+
+        for (const auto& [PackageName, Indices] : PackageGroups)
+        {
+            const UPackage* Package = Cast<UPackage>(StaticFindObjectFast(UPackage::StaticClass(), nullptr, FName(*PackageName)));
+
+            for (const int Index : Indices)
+            {
+                const FString& FieldPath = InFieldPaths[Index];
+                const UField* Field = nullptr;
+
+                // direct children of a loaded package can be found without parsing the whole path again
+                if (Package != nullptr)
+                {
+                    const FString ObjectName = FPackageName::ObjectPathToObjectName(FieldPath);
+
+                    if (!ObjectName.Contains(TEXT(":")) && !ObjectName.Contains(TEXT(".")))
+                    {
+                        Field = Cast<UField>(StaticFindObjectFast(UField::StaticClass(), const_cast<UPackage*>(Package), FName(*ObjectName)));
+                    }
+                }
+
+                if (Field == nullptr)
+                {
+                    Field = LoadField(FieldPath);
+
+                    // the package is loaded by this field, the others can be found directly
+                    if (Package == nullptr && Field != nullptr)
+                    {
+                        Package = Field->GetPackage();
+                    }
+                }
+
+                if (Field != nullptr)
+                {
+                    FieldCache.Add(FieldPath, Field);
+                }
+
+                OutFields[Index] = Field;
+            }
+        }
+    }
+
+    const FProperty* FUnrealFieldResolver::FindProperty(const UStruct* InStruct, const FName& InPropertyName)
+    {
+        check(IsInGameThread());
+
+        if (InStruct == nullptr)
+        {
+            return nullptr;
+        }
+
+        const FProperty* const* PropertyPtr = GetPropertyTable(InStruct).Find(InPropertyName);
+
+        return PropertyPtr != nullptr ? *PropertyPtr : nullptr;
+    }
+
+    void FUnrealFieldResolver::Invalidate()
+    {
+        FieldCache.Empty();
+        PropertyCache.Empty();
+    }
+
+    const TMap<FName, const FProperty*>& FUnrealFieldResolver::GetPropertyTable(const UStruct* InStruct)
+    {
+        checkSlow(InStruct != nullptr);
+
+        FPropertyTable* TablePtr = PropertyCache.Find(InStruct);
+
+        // the address may be reused by a new struct after the old one is collected
+        if (TablePtr != nullptr && TablePtr->Struct.Get() == InStruct && TablePtr->PropertyLink == InStruct->PropertyLink)
+        {
+            return TablePtr->Properties;
+        }
+
+        FPropertyTable& Table = PropertyCache.Add(InStruct);
+        Table.Struct = InStruct;
+        Table.PropertyLink = InStruct->PropertyLink;
+
+        const bool bIsUserDefinedStruct = InStruct->IsA<UUserDefinedStruct>();
+
+        for (TFieldIterator<FProperty> PropertyIter(InStruct, EFieldIterationFlags::IncludeSuper); PropertyIter; ++PropertyIter)
+        {
+            const FProperty* Property = *PropertyIter;
+
+            // properties of child struct are iterated first, keep them like FindPropertyByName does
+            if (bIsUserDefinedStruct)
+            {
+                // C# uses the display name, the generated FName is still accepted like FindPropertyByName
+                Table.Properties.FindOrAdd(FUnrealSharpUtils::ExtraUserDefinedStructPropertyName(Property), Property);
+            }
+
+            Table.Properties.FindOrAdd(Property->GetFName(), Property);
+        }
+
+        return Table.Properties;
+    }
+
+    const UField* FUnrealFieldResolver::FindCachedField(const FString& InFieldPath) const
+    {
+        const TWeakObjectPtr<const UField>* CachedPtr = FieldCache.Find(InFieldPath);
+        const UField* Field = CachedPtr != nullptr ? CachedPtr->Get() : nullptr;
+
+        // the path is resolved to the new version after recompiling
+        if (Field == nullptr || Field->HasAnyFlags(RF_NewerVersionExists))
+        {
+            return nullptr;
+        }
+
+        if (const UClass* Class = Cast<UClass>(Field); Class != nullptr && Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+        {
+            return nullptr;
+        }
+
+        return Field;
+    }
+
+    const UField* FUnrealFieldResolver::LoadField(const FString& InFieldPath)
+    {
+        return LoadObject<UField>(nullptr, *InFieldPath);
+    }
+}
@@ -26,6 +26,8 @@
 #include "Misc/UnrealFunctionInvocation.h"
 
 #include "Misc/UnrealSharpLog.h"
+#include "Misc/UnrealSharpTrace.h"
+#include "Misc/UnrealSharpStats.h"
 
 namespace UnrealSharp
 {
@@ -119,6 +121,10 @@ namespace UnrealSharp
     {        
         void* Address = InParameterBuffer;
 
+        US_INTEROP_SCOPE(STAT_UnrealSharp_CallUnreal);
+        INC_DWORD_STAT(STAT_UnrealSharp_CallUnrealCount);
+        US_TRACE_EVENT(VeryVerbose, UnrealFunctionInvoke, Function, InObject);
+
         if (DelegateProperty == nullptr && MulticastDelegateProperty == nullptr)
         {
             check(Function != nullptr);
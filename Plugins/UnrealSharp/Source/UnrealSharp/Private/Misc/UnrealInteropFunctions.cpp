@@ -104,7 +104,7 @@ namespace UnrealSharp
     void FUnrealInteropFunctions::SetupInternalInteropFunctions()
     {        
 #define DECLARE_UNREAL_SHARP_INTEROP_API(returnType, name, parameters) \
-            AddInteropFunction(TEXT(#name), (void*)&FInteropUtils::name)
+            FunctionTable.name = (void*)&FInteropUtils::name
 
 #include "Misc/InteropApiDefines.inl"
 
@@ -130,12 +130,44 @@ namespace UnrealSharp
             sizeof(Info),
             Instance, 
             (void*)&FUnrealInteropFunctions::GetUnrealInteropFunctionPointer, // NOLINT 
-            (void*)&FUnrealInteropFunctions::LogMessage // NOLINT
+            (void*)&FUnrealInteropFunctions::LogMessage, // NOLINT
+            &Instance->GetFunctionTable()
         };
 
         return &Info;
     }
 
+    uint32 FUnrealInteropFunctionTable::GetLayoutHash()
+    {
+        static const uint32 LayoutHash = []()
+        {
+            // FNV-1a of all function names, each name is terminated by ';'
+            // must match with C#
+            auto HashName = [](uint32 InHash, const char* InName)
+            {
+                for (const char* Character = InName; *Character != 0; ++Character)
+                {
+                    InHash = (InHash ^ static_cast<uint8>(*Character)) * 16777619u;
+                }
+
+                return (InHash ^ static_cast<uint8>(';')) * 16777619u;
+            };
+
+            uint32 Hash = 2166136261u;
+
+#define DECLARE_UNREAL_SHARP_INTEROP_API(returnType, name, parameters) \
+            Hash = HashName(Hash, #name)
+
+#include "Misc/InteropApiDefines.inl"
+
+#undef DECLARE_UNREAL_SHARP_INTEROP_API
+
+            return Hash;
+        }();
+
+        return LayoutHash;
+    }
+
     void* FUnrealInteropFunctions::GetUnrealInteropFunctionPointer(const FUnrealInteropFunctions* InInstance, const char* InCSharpText)
     {
         checkSlow(InInstance);
@@ -206,7 +238,7 @@ namespace UnrealSharp
             InBuildInfo->bWithEditor ? TEXT("true") : TEXT("false")
         );
 
-        const auto [Platform, Configuration, bWithEditor] = FUnrealSharpBuildInfo::GetNativeBuildInfo();
+        const auto [Platform, Configuration, bWithEditor, InteropFunctionTableLayoutHash] = FUnrealSharpBuildInfo::GetNativeBuildInfo();
 
         checkf(bWithEditor == InBuildInfo->bWithEditor, 
             TEXT("UnrealSharp is build with invalid configuration. C++ WITH_EDITOR=%s but C# WITH_EDITOR=%s"),
@@ -219,6 +251,12 @@ namespace UnrealSharp
             *FUnrealSharpBuildInfo::GetPlatformString(Platform),
             *FUnrealSharpBuildInfo::GetPlatformString(InBuildInfo->Platform)
             );
+
+        checkf(InteropFunctionTableLayoutHash == InBuildInfo->InteropFunctionTableLayoutHash,
+            TEXT("UnrealSharp is build with mismatched interop function table. C++ layout hash=0x%08x but C# layout hash=0x%08x, please sync FUnrealInteropFunctionTable with InteropApiDefines.inl"),
+            InteropFunctionTableLayoutHash,
+            InBuildInfo->InteropFunctionTableLayoutHash
+            );
     }
 }
 
@@ -66,6 +66,11 @@ namespace UnrealSharp
         return ManagedPath;
     }
 
+    FString FUnrealSharpPaths::GetStartupProfilePath()
+    {
+        return FPaths::Combine(GetUnrealSharpManagedLibraryDir(), TEXT("UnrealSharp.StartupProfile.txt"));
+    }
+
     FString FUnrealSharpPaths::GetDefaultUnrealCppDatabaseFilePath()
     {
         return FPaths::Combine(GetUnrealSharpIntermediateDirInner(), UnrealCppDatabaseFileName);
@@ -0,0 +1,91 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "Misc/UnrealSharpStats.h"
+#include "Misc/UnrealSharpLog.h"
+#include "HAL/IConsoleManager.h"
+
+UE_TRACE_CHANNEL_DEFINE(UnrealSharpChannel);
+
+DEFINE_STAT(STAT_UnrealSharp_CallCSharp);
+DEFINE_STAT(STAT_UnrealSharp_MarshalToCSharp);
+DEFINE_STAT(STAT_UnrealSharp_CSharpMethodInvoke);
+DEFINE_STAT(STAT_UnrealSharp_CallUnreal);
+DEFINE_STAT(STAT_UnrealSharp_ProxyCreate);
+DEFINE_STAT(STAT_UnrealSharp_GarbageCollect);
+
+DEFINE_STAT(STAT_UnrealSharp_CallCSharpCount);
+DEFINE_STAT(STAT_UnrealSharp_CallUnrealCount);
+DEFINE_STAT(STAT_UnrealSharp_ProxyCreateCount);
+DEFINE_STAT(STAT_UnrealSharp_ProxyDestroyCount);
+DEFINE_STAT(STAT_UnrealSharp_ProxyAliveCount);
+
+namespace UnrealSharp
+{
+    static int32 TraceFunctionSampleRate = 16;
+
+    static FAutoConsoleVariableRef TraceFunctionSampleRateVariable(
+        TEXT("UnrealSharp.TraceFunctionSampleRate"),
+        TraceFunctionSampleRate,
+        TEXT("Report one of N C++ to C# calls of each UFunction to Unreal Insights, 1 reports all calls.")
+    );
+
+    FInteropFunctionTraceScope::FInteropFunctionTraceScope(const UFunction* InFunction, uint32& InOutEventId, uint32& InOutCallCount)
+    {
+#if CPUPROFILERTRACE_ENABLED
+        if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(UnrealSharpChannel))
+        {
+            return;
+        }
+
+        if (InOutCallCount++ % static_cast<uint32>(FMath::Max(TraceFunctionSampleRate, 1)) != 0)
+        {
+            return;
+        }
+
+        if (InOutEventId == 0)
+        {
+            InOutEventId = FCpuProfilerTrace::OutputEventType(*InFunction->GetPathName());
+        }
+
+        FCpuProfilerTrace::OutputBeginEvent(InOutEventId);
+        bActive = true;
+#else
+        US_UNREFERENCED_PARAMETER(InFunction);
+        US_UNREFERENCED_PARAMETER(InOutEventId);
+        US_UNREFERENCED_PARAMETER(InOutCallCount);
+#endif
+    }
+
+    FInteropFunctionTraceScope::~FInteropFunctionTraceScope()
+    {
+#if CPUPROFILERTRACE_ENABLED
+        if (bActive)
+        {
+            FCpuProfilerTrace::OutputEndEvent();
+        }
+#endif
+    }
+}
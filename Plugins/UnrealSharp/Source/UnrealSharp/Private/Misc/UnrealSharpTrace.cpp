@@ -0,0 +1,119 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "Misc/UnrealSharpTrace.h"
+#include "HAL/IConsoleManager.h"
+
+namespace UnrealSharp
+{
+    int32 FInteropTrace::RuntimeLevel = 0;
+
+    // must be power of two
+    static constexpr uint32 InteropTraceRecordCount = 4096;
+    static FInteropTraceRecord InteropTraceRecords[InteropTraceRecordCount];
+    static std::atomic<uint32> InteropTraceWriteIndex = 0;
+
+    static FAutoConsoleVariableRef InteropTraceLevelVariable(
+        TEXT("UnrealSharp.TraceLevel"),
+        FInteropTrace::RuntimeLevel,
+        TEXT("Interop trace level, 0:None 1:Basic 2:Verbose 3:VeryVerbose, levels above UNREALSHARP_TRACE_LEVEL are not compiled.")
+    );
+
+    static FAutoConsoleCommand DumpInteropTraceCommand(
+        TEXT("UnrealSharp.DumpInteropTrace"),
+        TEXT("Print recent interop trace events, enable them by UnrealSharp.TraceLevel."),
+        FConsoleCommandDelegate::CreateStatic(&FInteropTrace::Dump)
+    );
+
+    void FInteropTrace::Record(EInteropTraceEvent InEvent, const void* InSubject, const void* InDetail, int64 InValue)
+    {
+        const uint32 Index = InteropTraceWriteIndex.fetch_add(1, std::memory_order_relaxed) & (InteropTraceRecordCount - 1);
+
+        FInteropTraceRecord& Record = InteropTraceRecords[Index];
+        Record.Cycles = FPlatformTime::Cycles64();
+        Record.Subject = InSubject;
+        Record.Detail = InDetail;
+        Record.Value = InValue;
+        Record.ThreadId = FPlatformTLS::GetCurrentThreadId();
+        Record.Event = InEvent;
+    }
+
+    void FInteropTrace::Dump()
+    {
+        const uint32 WriteIndex = InteropTraceWriteIndex.load(std::memory_order_relaxed);
+        const uint32 Count = FMath::Min(WriteIndex, InteropTraceRecordCount);
+
+        if (Count == 0)
+        {
+            US_LOG(TEXT("No interop trace event, current trace level is %d, compiled level is %d."), RuntimeLevel, UNREALSHARP_TRACE_LEVEL);
+            return;
+        }
+
+        const uint64 LastCycles = InteropTraceRecords[(WriteIndex - 1) & (InteropTraceRecordCount - 1)].Cycles;
+
+        US_LOG(TEXT("Last %u interop trace events:"), Count);
+
+        for (uint32 i = WriteIndex - Count; i != WriteIndex; ++i)
+        {
+            const FInteropTraceRecord& Record = InteropTraceRecords[i & (InteropTraceRecordCount - 1)];
+
+            US_LOG(TEXT("  %10.3f ms [%5u] %-24s %p %p %lld"),
+                -FPlatformTime::ToMilliseconds64(LastCycles - Record.Cycles),
+                Record.ThreadId,
+                GetEventName(Record.Event),
+                Record.Subject,
+                Record.Detail,
+                Record.Value
+            );
+        }
+    }
+
+    const TCHAR* FInteropTrace::GetEventName(EInteropTraceEvent InEvent)
+    {
+        switch (InEvent)
+        {
+        case EInteropTraceEvent::GarbageCollect:
+            return TEXT("GarbageCollect");
+        case EInteropTraceEvent::ObjectConnectionBreak:
+            return TEXT("ObjectConnectionBreak");
+        case EInteropTraceEvent::ObjectProxyCreate:
+            return TEXT("ObjectProxyCreate");
+        case EInteropTraceEvent::ObjectToUnreal:
+            return TEXT("ObjectToUnreal");
+        case EInteropTraceEvent::ObjectToCSharp:
+            return TEXT("ObjectToCSharp");
+        case EInteropTraceEvent::SoftObjectToUnreal:
+            return TEXT("SoftObjectToUnreal");
+        case EInteropTraceEvent::CSharpMethodInvoke:
+            return TEXT("CSharpMethodInvoke");
+        case EInteropTraceEvent::UnrealFunctionInvoke:
+            return TEXT("UnrealFunctionInvoke");
+        case EInteropTraceEvent::UnrealFunctionRedirect:
+            return TEXT("UnrealFunctionRedirect");
+        default:
+            return TEXT("Unknown");
+        }
+    }
+}
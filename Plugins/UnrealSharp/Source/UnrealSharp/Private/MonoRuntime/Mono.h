@@ -43,6 +43,8 @@
 #include <mono/utils/details/mono-dl-fallback-types.h>
 #include <mono/metadata/details/appdomain-types.h>
 #include <mono/metadata/details/loader-types.h>
+#include <mono/metadata/details/threads-types.h>
+#include <mono/metadata/details/profiler-types.h>
 
 #if PLATFORM_WINDOWS || (WITH_EDITOR && PLATFORM_MAC || PLATFORM_LINUX)
 #define UNREALSHARP_MONO_APIS_DYNAMIC_BINDING 1
@@ -41,3 +41,5 @@
 #include <mono/metadata/details/appdomain-functions.h>
 #include <mono/metadata/details/object-functions.h>
 #include <mono/metadata/details/loader-functions.h>
+#include <mono/metadata/details/threads-functions.h>
+#include <mono/metadata/details/profiler-functions.h>
@@ -0,0 +1,245 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "MonoRuntime/MonoAssemblyIndex.h"
+
+#if WITH_MONO
+#include "Misc/UnrealSharpLog.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+
+namespace UnrealSharp::Mono
+{
+    void FMonoAssemblyIndex::Build(const TArray<FString>& InSearchPaths, const FString& InCacheFilePath)
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        const double StartTime = FPlatformTime::Seconds();
+
+        SearchPaths = InSearchPaths;
+        CacheFilePath = InCacheFilePath;
+
+        const bool bIsCacheUsed = LoadCache() && IsUpToDate();
+
+        if (!bIsCacheUsed)
+        {
+            Scan();
+            SaveCache();
+        }
+
+        US_LOG(TEXT("Assembly index %s: %d files in %d directories, %.2f ms."), bIsCacheUsed ? TEXT("loaded") : TEXT("built"), Locations.Num(), DirectoryTimeStamps.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+
+    void FMonoAssemblyIndex::Refresh()
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        if (!IsUpToDate())
+        {
+            Scan();
+            SaveCache();
+        }
+    }
+
+    FString FMonoAssemblyIndex::Find(const FString& InFileName, const FString& InCulture)
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        const FLocation* Location = Locations.Find(InFileName);
+
+        if (!InCulture.IsEmpty())
+        {
+            // same order as probing each search directory for file name and then culture/file name
+            if (const FLocation* CultureLocation = Locations.Find(InCulture / InFileName); CultureLocation != nullptr && (Location == nullptr || CultureLocation->SearchPathIndex < Location->SearchPathIndex))
+            {
+                Location = CultureLocation;
+            }
+        }
+
+        return Location != nullptr ? Location->Path : FString();
+    }
+
+    bool FMonoAssemblyIndex::IsKnownMissing(const FString& InFileName, const FString& InCulture)
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        return MissingFiles.Contains(InCulture / InFileName);
+    }
+
+    void FMonoAssemblyIndex::MarkMissing(const FString& InFileName, const FString& InCulture)
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        MissingFiles.Add(InCulture / InFileName);
+    }
+
+    bool FMonoAssemblyIndex::IsUpToDate() const
+    {
+        if (DirectoryTimeStamps.IsEmpty())
+        {
+            return false;
+        }
+
+        IFileManager& FileManager = IFileManager::Get();
+
+        // adding or removing a file changes timestamp of its directory, a new sub directory changes its parent
+        for (const auto& [Directory, TimeStamp] : DirectoryTimeStamps)
+        {
+            if (const FFileStatData StatData = FileManager.GetStatData(*Directory); !StatData.bIsValid || StatData.ModificationTime != TimeStamp)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void FMonoAssemblyIndex::Scan()
+    {
+        DirectoryTimeStamps.Empty();
+        Locations.Empty();
+        MissingFiles.Empty();
+
+        for (int32 i = 0; i < SearchPaths.Num(); ++i)
+        {
+            AddDirectory(SearchPaths[i], FString(), i, true);
+        }
+    }
+
+    void FMonoAssemblyIndex::AddDirectory(const FString& InDirectory, const FString& InKeyPrefix, int32 InSearchPathIndex, bool bRecursive)
+    {
+        const FFileStatData DirectoryStatData = IFileManager::Get().GetStatData(*InDirectory);
+
+        if (!DirectoryStatData.bIsValid || !DirectoryStatData.bIsDirectory)
+        {
+            return;
+        }
+
+        DirectoryTimeStamps.Add(InDirectory, DirectoryStatData.ModificationTime);
+
+        TArray<FString> SubDirectories;
+
+        FPlatformFileManager::Get().GetPlatformFile().IterateDirectory(*InDirectory, [&](const TCHAR* InPath, bool bIsDirectory)
+        {
+            const FString FileName = FPaths::GetCleanFilename(InPath);
+
+            if (bIsDirectory)
+            {
+                SubDirectories.Add(FileName);
+            }
+            // the first search directory wins, same as probing them in order
+            else if (const FString Key = InKeyPrefix.IsEmpty() ? FileName : InKeyPrefix / FileName; !Locations.Contains(Key))
+            {
+                Locations.Add(Key, { FPaths::Combine(InDirectory, FileName), InSearchPathIndex });
+            }
+
+            return true;
+        });
+
+        if (bRecursive)
+        {
+            for (const FString& SubDirectory : SubDirectories)
+            {
+                AddDirectory(FPaths::Combine(InDirectory, SubDirectory), SubDirectory, InSearchPathIndex, false);
+            }
+        }
+    }
+
+    bool FMonoAssemblyIndex::LoadCache()
+    {
+        DirectoryTimeStamps.Empty();
+        Locations.Empty();
+
+        TArray<FString> Lines;
+        if (CacheFilePath.IsEmpty() || !FFileHelper::LoadFileToStringArray(Lines, *CacheFilePath) || Lines.IsEmpty())
+        {
+            return false;
+        }
+
+        // the first line is search paths, the index is not usable if they are changed
+        TArray<FString> CachedSearchPaths;
+        Lines[0].ParseIntoArray(CachedSearchPaths, TEXT("\t"), false);
+
+        if (CachedSearchPaths != SearchPaths)
+        {
+            return false;
+        }
+
+        // D Directory TimeStamp
+        // F Key SearchPathIndex Path
+        for (int32 i = 1; i < Lines.Num(); ++i)
+        {
+            TArray<FString> Fields;
+            Lines[i].ParseIntoArray(Fields, TEXT("\t"), false);
+
+            if (Fields.Num() == 3 && Fields[0] == TEXT("D"))
+            {
+                DirectoryTimeStamps.Add(Fields[1], FDateTime(FCString::Atoi64(*Fields[2])));
+            }
+            else if (Fields.Num() == 4 && Fields[0] == TEXT("F"))
+            {
+                Locations.Add(Fields[1], { Fields[3], FCString::Atoi(*Fields[2]) });
+            }
+            else
+            {
+                DirectoryTimeStamps.Empty();
+                Locations.Empty();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void FMonoAssemblyIndex::SaveCache() const
+    {
+        if (CacheFilePath.IsEmpty())
+        {
+            return;
+        }
+
+        TArray<FString> Lines;
+        Lines.Reserve(1 + DirectoryTimeStamps.Num() + Locations.Num());
+
+        Lines.Add(FString::Join(SearchPaths, TEXT("\t")));
+
+        for (const auto& [Directory, TimeStamp] : DirectoryTimeStamps)
+        {
+            Lines.Add(FString::Printf(TEXT("D\t%s\t%lld"), *Directory, TimeStamp.GetTicks()));
+        }
+
+        for (const auto& [Key, Location] : Locations)
+        {
+            Lines.Add(FString::Printf(TEXT("F\t%s\t%d\t%s"), *Key, Location.SearchPathIndex, *Location.Path));
+        }
+
+        if (!FFileHelper::SaveStringArrayToFile(Lines, *CacheFilePath))
+        {
+            US_LOG_WARN(TEXT("Failed save assembly index to %s."), *CacheFilePath);
+        }
+    }
+}
+#endif
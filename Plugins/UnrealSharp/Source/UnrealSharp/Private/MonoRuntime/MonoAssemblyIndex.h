@@ -0,0 +1,78 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#if WITH_MONO
+namespace UnrealSharp::Mono
+{
+    /*
+    * Map file names in assembly search directories to their paths.
+    * Each search directory and its sub directories(culture directories of resource assemblies) are enumerated once, 
+    * resolving an assembly is a map lookup instead of a FileExists call for each search directory.
+    * The index is saved to a cache file and reused by next start if no directory timestamp is changed.
+    */
+    class FMonoAssemblyIndex
+    {
+    public:
+        void                    Build(const TArray<FString>& InSearchPaths, const FString& InCacheFilePath);
+
+        // rebuild if a file is added or removed since last build, only directory timestamps are checked
+        void                    Refresh();
+
+        // eg: System.Runtime.dll, files in the culture directory are used if they are found in a search directory before the others
+        FString                 Find(const FString& InFileName, const FString& InCulture = FString());
+
+        int32                   Num() const { return Locations.Num(); }
+
+        // remember names that are still not found after a refresh(eg: satellite assemblies of missing cultures), they are forgotten when the index is rebuilt
+        bool                    IsKnownMissing(const FString& InFileName, const FString& InCulture = FString());
+        void                    MarkMissing(const FString& InFileName, const FString& InCulture = FString());
+
+    private:
+        struct FLocation
+        {
+            FString             Path;
+
+            // a smaller index has a higher priority
+            int32               SearchPathIndex = 0;
+        };
+
+        bool                    IsUpToDate() const;
+        void                    Scan();
+        void                    AddDirectory(const FString& InDirectory, const FString& InKeyPrefix, int32 InSearchPathIndex, bool bRecursive);
+        bool                    LoadCache();
+        void                    SaveCache() const;
+
+    private:
+        FCriticalSection                CriticalSection;
+        TArray<FString>                 SearchPaths;
+        FString                         CacheFilePath;
+        TMap<FString, FDateTime>        DirectoryTimeStamps;
+        TMap<FString, FLocation>        Locations;
+        TSet<FString>                   MissingFiles;
+    };
+}
+#endif
@@ -0,0 +1,115 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "MonoRuntime/MonoAssemblyPrefetcher.h"
+
+#if WITH_MONO
+#include "Misc/UnrealSharpLog.h"
+#include "Misc/FileHelper.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+
+namespace UnrealSharp::Mono
+{
+    FCriticalSection FMonoAssemblyPrefetcher::CriticalSection;
+    TMap<FString, TFuture<TArray64<uint8>>> FMonoAssemblyPrefetcher::PendingFiles;
+
+    void FMonoAssemblyPrefetcher::Start(const FString& InDirectory, bool bInKeepContents)
+    {
+        TArray<FString> Files;
+        IFileManager::Get().FindFiles(Files, *FPaths::Combine(InDirectory, TEXT("UnrealSharp.*.dll")), true, false);
+
+        FScopeLock Lock(&CriticalSection);
+
+        for (const FString& File : Files)
+        {
+            const FString FilePath = FPaths::Combine(InDirectory, File);
+
+            PendingFiles.Add(GetKey(FilePath), Async(EAsyncExecution::ThreadPool, [FilePath, bInKeepContents]()
+            {
+                TArray64<uint8> Content;
+
+                // the file cache is warm even if the content is dropped
+                if (!FFileHelper::LoadFileToArray(Content, *FilePath, FILEREAD_Silent) || !bInKeepContents)
+                {
+                    Content.Empty();
+                }
+
+                return Content;
+            }));
+        }
+
+        US_LOG(TEXT("Prefetching %d assemblies in %s."), Files.Num(), *InDirectory);
+    }
+
+    bool FMonoAssemblyPrefetcher::Take(const FString& InFilePath, TArray64<uint8>& OutContent)
+    {
+        TFuture<TArray64<uint8>> Future;
+
+        {
+            FScopeLock Lock(&CriticalSection);
+
+            const FString Key = GetKey(InFilePath);
+            TFuture<TArray64<uint8>>* PendingFile = PendingFiles.Find(Key);
+
+            if (PendingFile == nullptr)
+            {
+                return false;
+            }
+
+            Future = MoveTemp(*PendingFile);
+            PendingFiles.Remove(Key);
+        }
+
+        OutContent = Future.Consume();
+
+        return !OutContent.IsEmpty();
+    }
+
+    void FMonoAssemblyPrefetcher::Reset()
+    {
+        TMap<FString, TFuture<TArray64<uint8>>> Files;
+
+        {
+            FScopeLock Lock(&CriticalSection);
+            Files = MoveTemp(PendingFiles);
+            PendingFiles.Reset();
+        }
+
+        for (auto& [Path, Future] : Files)
+        {
+            Future.Wait();
+        }
+    }
+
+    FString FMonoAssemblyPrefetcher::GetKey(const FString& InFilePath)
+    {
+        FString Key = FPaths::ConvertRelativePathToFull(InFilePath);
+        FPaths::NormalizeFilename(Key);
+
+        return Key;
+    }
+}
+#endif
@@ -0,0 +1,57 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#if WITH_MONO
+#include "Async/Future.h"
+
+namespace UnrealSharp::Mono
+{
+    /*
+    * Read UnrealSharp assemblies on worker threads while the engine keeps loading, 
+    * so the runtime created later by game instance does not wait for disk when it loads them.
+    * Contents are kept for assemblies loaded from memory, they are only read to warm file cache for memory mapped assemblies.
+    */
+    class FMonoAssemblyPrefetcher
+    {
+    public:
+        static void             Start(const FString& InDirectory, bool bInKeepContents);
+
+        // wait the file is read and move its content out, return false if it is not prefetched
+        static bool             Take(const FString& InFilePath, TArray64<uint8>& OutContent);
+
+        // wait all pending reads and release contents not taken
+        static void             Reset();
+
+    private:
+        static FString          GetKey(const FString& InFilePath);
+
+    private:
+        static FCriticalSection                             CriticalSection;
+        static TMap<FString, TFuture<TArray64<uint8>>>      PendingFiles;
+    };
+}
+#endif
@@ -0,0 +1,296 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "MonoRuntime/MonoExceptionReporter.h"
+#include "Misc/UnrealSharpLog.h"
+
+#if WITH_MONO
+#include "MonoRuntime/MonoRuntime.h"
+#include "MonoRuntime/MonoInteropUtils.h"
+#include "HAL/IConsoleManager.h"
+
+#define LOCTEXT_NAMESPACE "MonoRuntime"
+
+namespace UnrealSharp::Mono
+{
+    FCriticalSection FMonoExceptionReporter::CriticalSection;
+    TMap<uint32, FMonoExceptionReporter::FExceptionRecord> FMonoExceptionReporter::Records;
+    FMonoExceptionReporter::FStatistics FMonoExceptionReporter::Statistics;
+    double FMonoExceptionReporter::ReportInterval = 10.0;
+    MonoClassField* FMonoExceptionReporter::MessageField = nullptr;
+
+    static FAutoConsoleCommand DumpExceptionStatisticsCommand(
+        TEXT("UnrealSharp.DumpExceptionStatistics"),
+        TEXT("Print count of C# exceptions thrown into native code."),
+        FConsoleCommandDelegate::CreateStatic(&FMonoExceptionReporter::DumpStatistics)
+    );
+
+    void FMonoExceptionReporter::Initialize(double InReportInterval)
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        ReportInterval = FMath::Max(InReportInterval, 0.0);
+        Records.Empty();
+        Statistics = FStatistics();
+        MessageField = nullptr;
+    }
+
+    void FMonoExceptionReporter::Uninitialize()
+    {
+        Flush();
+
+        FScopeLock Lock(&CriticalSection);
+
+        if (Statistics.TotalCount > 0)
+        {
+            US_LOG_WARN(TEXT("C# exceptions: %lld thrown, %d unique, %lld suppressed."), Statistics.TotalCount, Statistics.UniqueCount, Statistics.SuppressedCount);
+        }
+
+        Records.Empty();
+        
+        // the field belongs to the domain being destroyed
+        MessageField = nullptr;
+    }
+
+    uint32 FMonoExceptionReporter::ComputeFingerprint(MonoObject* InException, const void* InSite)
+    {
+        check(InException);
+
+        MonoClass* ExceptionClass = mono_object_get_class(InException);
+
+        uint32 Fingerprint = HashCombine(PointerHash(ExceptionClass), PointerHash(InSite));
+
+        if (MessageField == nullptr)
+        {
+            // System.Exception._message, found in parent classes too
+            MessageField = mono_class_get_field_from_name(ExceptionClass, "_message");
+        }
+
+        if (MessageField != nullptr)
+        {
+            MonoString* Message = nullptr;
+            mono_field_get_value(InException, MessageField, &Message);
+
+            if (Message != nullptr)
+            {
+                Fingerprint = FCrc::MemCrc32(mono_string_chars(Message), mono_string_length(Message) * sizeof(mono_unichar2), Fingerprint);
+            }
+        }
+
+        return Fingerprint;
+    }
+
+    void FMonoExceptionReporter::Report(MonoObject* InException, uint32 InFingerprint)
+    {
+        check(InException);
+
+        const double CurrentTime = FPlatformTime::Seconds();
+
+        {
+            FScopeLock Lock(&CriticalSection);
+
+            ++Statistics.TotalCount;
+
+            if (FExceptionRecord* Record = Records.Find(InFingerprint))
+            {
+                ++Record->Count;
+                ++Record->PendingCount;
+                ++Statistics.SuppressedCount;
+
+                if (CurrentTime - Record->LastReportTime >= ReportInterval)
+                {
+                    ReportPending(*Record, CurrentTime);
+                }
+
+                return;
+            }
+
+            FExceptionRecord& Record = Records.Add(InFingerprint);
+            Record.Count = 1;
+            Record.LastReportTime = CurrentTime;
+
+            ++Statistics.UniqueCount;
+            ++Statistics.FullReportCount;
+        }
+
+        // materialize strings out of the lock, they may execute managed code
+        const FString Message = GetExceptionMessage(InException);
+        const FString StackTrace = GetExceptionStackTrace(InException);
+
+        {
+            FScopeLock Lock(&CriticalSection);
+
+            // may be removed by Uninitialize on another thread
+            if (FExceptionRecord* Record = Records.Find(InFingerprint))
+            {
+                int32 LineEnd = INDEX_NONE;
+                Record->Summary = Message.FindChar(TEXT('\n'), LineEnd) ? Message.Left(LineEnd).TrimEnd() : Message;
+            }
+        }
+
+        US_LOG_ERROR(TEXT("C# Exception:%s\n%s"), *Message, *StackTrace);
+
+        FFormatNamedArguments Args;
+        Args.Add(TEXT("ExceptionMessage"), FText::FromString(Message));
+        const FText ExceptionError = FText::Format(LOCTEXT("ExceptionError", "Managed exception: {ExceptionMessage}"), Args);
+
+        if (IsInGameThread())
+        {
+            FMonoRuntime::SendErrorToMessageLog(ExceptionError);
+        }
+        else
+        {
+            // dispatch to game thread
+            FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+                FSimpleDelegateGraphTask::FDelegate::CreateStatic(&FMonoRuntime::SendErrorToMessageLog, ExceptionError)
+                , nullptr
+                , nullptr
+                , ENamedThreads::GameThread
+            );
+        }
+    }
+
+    void FMonoExceptionReporter::Flush()
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        const double CurrentTime = FPlatformTime::Seconds();
+
+        for (auto& Pair : Records)
+        {
+            ReportPending(Pair.Value, CurrentTime);
+        }
+    }
+
+    FMonoExceptionReporter::FStatistics FMonoExceptionReporter::GetStatistics()
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        return Statistics;
+    }
+
+    void FMonoExceptionReporter::DumpStatistics()
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        US_LOG(TEXT("C# exceptions: %lld thrown, %d unique, %lld fully reported, %lld suppressed."), 
+            Statistics.TotalCount, 
+            Statistics.UniqueCount, 
+            Statistics.FullReportCount, 
+            Statistics.SuppressedCount
+        );
+
+        TArray<const FExceptionRecord*> SortedRecords;
+        SortedRecords.Reserve(Records.Num());
+
+        for (const auto& Pair : Records)
+        {
+            SortedRecords.Add(&Pair.Value);
+        }
+
+        SortedRecords.Sort([](const FExceptionRecord& A, const FExceptionRecord& B) { return A.Count > B.Count; });
+
+        for (const FExceptionRecord* Record : SortedRecords)
+        {
+            US_LOG(TEXT("    %8lld %s"), Record->Count, *Record->Summary);
+        }
+    }
+
+    void FMonoExceptionReporter::ReportPending(FExceptionRecord& InRecord, double InCurrentTime)
+    {
+        if (InRecord.PendingCount > 0)
+        {
+            US_LOG_ERROR(TEXT("C# Exception repeated %lld times in the last %.1f seconds, %lld times in total:%s"),
+                InRecord.PendingCount,
+                InCurrentTime - InRecord.LastReportTime,
+                InRecord.Count,
+                *InRecord.Summary
+            );
+
+            InRecord.PendingCount = 0;
+        }
+
+        InRecord.LastReportTime = InCurrentTime;
+    }
+
+    FString FMonoExceptionReporter::GetExceptionMessage(MonoObject* InException)
+    {
+        check(InException);
+
+        FString Message;
+        MonoObject* ExceptionInStringConversion = nullptr;
+        MonoString* MonoExceptionString = mono_object_to_string(InException, &ExceptionInStringConversion);
+
+        if (MonoExceptionString != nullptr)
+        {
+            Message = FMonoInteropUtils::GetFString(MonoExceptionString);
+        }
+        else
+        {
+            check(ExceptionInStringConversion);
+
+            // Can't really get much out of the original exception with the public API, so just note that two exceptions were thrown
+            MonoExceptionString = mono_object_to_string(ExceptionInStringConversion, nullptr);
+            check(MonoExceptionString);
+
+            Message = FString::Printf(TEXT("Nested exception! Original exception was of type '%s'. Nested Exception: %s"),
+                ANSI_TO_TCHAR(mono_class_get_name(mono_object_get_class(InException))),
+                *FMonoInteropUtils::GetFString(MonoExceptionString)
+            );
+        }
+
+        // set to default if not valid...
+        if (Message.IsEmpty())
+        {
+            Message = TEXT("MonoRuntimeException");
+        }
+
+        return Message;
+    }
+
+    FString FMonoExceptionReporter::GetExceptionStackTrace(MonoObject* InException)
+    {
+        check(InException);
+
+        MonoClass* ExceptionClass = mono_object_get_class(InException);
+        MonoProperty* StackTraceProperty = mono_class_get_property_from_name(ExceptionClass, "StackTrace");
+
+        if (StackTraceProperty != nullptr)
+        {
+            MonoString* StackTrace = (MonoString*)mono_property_get_value(StackTraceProperty, InException, nullptr, nullptr); // NOLINT
+
+            if (StackTrace != nullptr)
+            {
+                return FMonoInteropUtils::GetFString(StackTrace);
+            }
+        }
+
+        return FString();
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
+
+#endif
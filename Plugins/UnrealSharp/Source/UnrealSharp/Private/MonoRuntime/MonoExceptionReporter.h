@@ -0,0 +1,94 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#if WITH_MONO
+#include "MonoRuntime/Mono.h"
+
+namespace UnrealSharp::Mono
+{
+    /*
+    * Collect managed exceptions thrown into native code.
+    * Exceptions are grouped by fingerprint(exception class + call site + message), 
+    * only the first one of each group is reported with message and stack trace, 
+    * the following ones are counted and reported as a summary at most once per ExceptionReportInterval,
+    * so a C# exception thrown every tick does not flood the log.
+    */
+    class FMonoExceptionReporter
+    {
+    public:
+        struct FStatistics
+        {
+            // all exceptions reported
+            int64               TotalCount = 0;
+
+            // exceptions reported with message and stack trace
+            int64               FullReportCount = 0;
+
+            // exceptions only counted
+            int64               SuppressedCount = 0;
+
+            // count of different fingerprints
+            int32               UniqueCount = 0;
+        };
+
+        static void             Initialize(double InReportInterval);
+        static void             Uninitialize();
+
+        // cheap enough to be called for each exception, no managed code is executed and no FString is built
+        static uint32           ComputeFingerprint(MonoObject* InException, const void* InSite);
+
+        static void             Report(MonoObject* InException, uint32 InFingerprint);
+
+        // report repeat counts not reported yet
+        static void             Flush();
+
+        static FStatistics      GetStatistics();
+        static void             DumpStatistics();
+
+        static FString          GetExceptionMessage(MonoObject* InException);
+        static FString          GetExceptionStackTrace(MonoObject* InException);
+
+    private:
+        struct FExceptionRecord
+        {
+            FString             Summary;
+            int64               Count = 0;
+            int64               PendingCount = 0;
+            double              LastReportTime = 0;
+        };
+
+        static void             ReportPending(FExceptionRecord& InRecord, double InCurrentTime);
+
+    private:
+        static FCriticalSection                 CriticalSection;
+        static TMap<uint32, FExceptionRecord>   Records;
+        static FStatistics                      Statistics;
+        static double                           ReportInterval;
+        static MonoClassField*                  MessageField;
+    };
+}
+#endif
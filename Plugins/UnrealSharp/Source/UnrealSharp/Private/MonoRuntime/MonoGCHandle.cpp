@@ -69,5 +69,10 @@ namespace UnrealSharp::Mono
 
         return mono_gchandle_get_target(Handle); 
     }
+
+    void* FMonoGCHandle::GetHandleValue() const
+    {
+        return reinterpret_cast<void*>(static_cast<UPTRINT>(Handle));
+    }
 }
 #endif
@@ -40,6 +40,7 @@ namespace UnrealSharp::Mono
         virtual bool                IsWeakReference() const override;
         virtual bool                IsValid() const override;
         virtual void*               GetObject() const override;
+        virtual void*               GetHandleValue() const override;
 
     private:
         uint32                      Handle;
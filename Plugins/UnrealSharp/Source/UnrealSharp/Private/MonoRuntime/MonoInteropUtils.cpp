@@ -5,11 +5,30 @@
 #include "MonoRuntime/MonoType.h"
 #include "MonoRuntime/MonoRuntime.h"
 #include "Misc/ScopedExit.h"
+#include "Classes/UnrealSharpSettings.h"
+#include "Hash/CityHash.h"
+#include "HAL/IConsoleManager.h"
 
 namespace UnrealSharp::Mono
 {
     FMonoRuntime* FMonoInteropUtils::Runtime = nullptr;
     TMap<uint32, TTuple<FString, void*>> FMonoInteropUtils::FallbackApis;
+    FMonoInteropUtils::FInternedStringMapType FMonoInteropUtils::InternedStrings;
+    TMap<uint32, uint8> FMonoInteropUtils::InternCandidates;
+    int32 FMonoInteropUtils::MaxInternedStringLength = 0;
+
+    static_assert(sizeof(TCHAR) == sizeof(mono_unichar2), "MonoString characters are used as TCHAR directly.");
+
+    // a string is interned when it is converted this many times
+    static constexpr uint8 InternThreshold = 2;
+    static constexpr int32 MaxInternedStringCount = 4096;
+    static constexpr int32 MaxInternCandidateCount = 16384;
+
+    static FAutoConsoleCommand DumpInternedStringsCommand(
+        TEXT("UnrealSharp.DumpInternedStrings"),
+        TEXT("Print short strings shared by native to C# string conversions."),
+        FConsoleCommandDelegate::CreateStatic(&FMonoInteropUtils::DumpInternedStrings)
+    );
 
     static inline uint32 CalcHashFast(const char* p, uint32 s) // NOLINT
     {
@@ -58,6 +77,8 @@ namespace UnrealSharp::Mono
 
         FallbackApis.Empty();
 
+        MaxInternedStringLength = FMath::Max(GetDefault<UUnrealSharpSettings>()->MaxInternedStringLength, 0);
+
         Bind();
 
         mono_dl_fallback_register(MonoPInvokeLoadLib, MonoPInvokeGetSymbol, MonoPInvokeFallbackClose, nullptr);
@@ -65,40 +86,138 @@ namespace UnrealSharp::Mono
 
     void FMonoInteropUtils::Uninitialize()
     {
+        ClearInternedStrings();
+
         FallbackApis.Empty();
         Runtime = nullptr;
     }
 
     FString FMonoInteropUtils::GetFString(MonoString* InMonoString)
+    {
+        return FString(GetStringView(InMonoString));
+    }
+
+    void FMonoInteropUtils::GetFString(MonoString* InMonoString, FString& OutString)
+    {
+        const FStringView View = GetStringView(InMonoString);
+
+        // keep the allocation of OutString if it is large enough
+        OutString.Reset(View.Len());
+        OutString.AppendChars(View.GetData(), View.Len());
+    }
+
+    FStringView FMonoInteropUtils::GetStringView(MonoString* InMonoString)
     {
         if (InMonoString == nullptr)
         {
-            return FString();
+            return FStringView();
         }
 
-        const auto UTF16Text = mono_string_to_utf16(InMonoString);
-
-        US_SCOPED_EXIT(mono_free(UTF16Text));
+        return FStringView((const TCHAR*)mono_string_chars(InMonoString), mono_string_length(InMonoString)); // NOLINT
+    }
 
-        FString Text(UTF16Text);
+    FName FMonoInteropUtils::GetFName(MonoString* InMonoString)
+    {
+        const FStringView View = GetStringView(InMonoString);
 
-        return Text;
+        return View.IsEmpty() ? FName() : FName(View.Len(), View.GetData());
     }
 
     MonoString* FMonoInteropUtils::GetMonoString(const FString& InString)
     {
-        MonoString* String = mono_string_new_utf16(Runtime->GetDomain(), (const mono_unichar2*)*InString, InString.Len()); // NOLINT
+        return GetMonoString(FStringView(InString));
+    }
+
+    MonoString* FMonoInteropUtils::GetMonoString(const FStringView& InStringView)
+    {
+        if (InStringView.IsEmpty())
+        {
+            return mono_string_empty(Runtime->GetDomain());
+        }
+
+        if (InStringView.Len() <= MaxInternedStringLength && IsInGameThread())
+        {
+            if (MonoString* String = FindOrInternMonoString(InStringView))
+            {
+                return String;
+            }
+        }
+
+        MonoString* String = mono_string_new_utf16(Runtime->GetDomain(), (const mono_unichar2*)InStringView.GetData(), InStringView.Len());// NOLINT
 
         return String;
     }
 
-    MonoString* FMonoInteropUtils::GetMonoString(const FStringView& InStringView)
+    uint32 FMonoInteropUtils::FInternedStringKeyFuncs::HashString(const FStringView& InStringView)
+    {
+        return CityHash32((const char*)InStringView.GetData(), InStringView.Len() * sizeof(TCHAR)); // NOLINT
+    }
+
+    MonoString* FMonoInteropUtils::FindOrInternMonoString(const FStringView& InStringView)
     {
+        const uint32 HashCode = FInternedStringKeyFuncs::HashString(InStringView);
+
+        if (const FInternedString* Interned = InternedStrings.FindByHash(HashCode, InStringView))
+        {
+            return Interned->String;
+        }
+
+        if (InternedStrings.Num() >= MaxInternedStringCount)
+        {
+            return nullptr;
+        }
+
+        // count by hash only, a collision just interns a string a little earlier
+        uint8& Count = InternCandidates.FindOrAddByHash(HashCode, HashCode);
+
+        if (++Count < InternThreshold)
+        {
+            if (InternCandidates.Num() >= MaxInternCandidateCount)
+            {
+                InternCandidates.Reset();
+            }
+
+            return nullptr;
+        }
+
+        InternCandidates.RemoveByHash(HashCode, HashCode);
+
         MonoString* String = mono_string_new_utf16(Runtime->GetDomain(), (const mono_unichar2*)InStringView.GetData(), InStringView.Len());// NOLINT
 
+        if (String == nullptr)
+        {
+            return nullptr;
+        }
+
+        // pinned, the cached pointer must not be moved by GC
+        const uint32 GCHandle = mono_gchandle_new((MonoObject*)String, true); // NOLINT
+
+        InternedStrings.AddByHash(HashCode, FString(InStringView), FInternedString{ String, GCHandle });
+
         return String;
     }
 
+    void FMonoInteropUtils::ClearInternedStrings()
+    {
+        for (const auto& Pair : InternedStrings)
+        {
+            mono_gchandle_free(Pair.Value.GCHandle);
+        }
+
+        InternedStrings.Empty();
+        InternCandidates.Empty();
+    }
+
+    void FMonoInteropUtils::DumpInternedStrings()
+    {
+        US_LOG(TEXT("Interned C# strings: %d, candidates: %d, max length: %d"), InternedStrings.Num(), InternCandidates.Num(), MaxInternedStringLength);
+
+        for (const auto& Pair : InternedStrings)
+        {
+            US_LOG(TEXT("  %s"), *Pair.Key);
+        }
+    }
+
     void FMonoInteropUtils::Bind()
     {
 #define __PP_TEXT(name) #name /* NOLINT */
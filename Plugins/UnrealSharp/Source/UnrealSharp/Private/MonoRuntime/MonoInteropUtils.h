@@ -45,9 +45,16 @@ namespace UnrealSharp::Mono
 
     public:
         static FString                      GetFString(MonoString* InMonoString);        
+        // reuse the buffer of OutString
+        static void                         GetFString(MonoString* InMonoString, FString& OutString);
+        // view of the characters of InMonoString, no copy, use it before returning to C#
+        static FStringView                  GetStringView(MonoString* InMonoString);
+        static FName                        GetFName(MonoString* InMonoString);
         static MonoString*                  GetMonoString(const FString& InString);
         static MonoString*                  GetMonoString(const FStringView& InStringView);
 
+        static void                         DumpInternedStrings();
+
         static void                         DumpMonoObjectInformation(MonoObject* InMonoObject);        
         static void                         DumpAssemblyClasses(MonoAssembly* InAssembly);
         static void                         DumpClassInformation(MonoClass* InClass);
@@ -59,9 +66,36 @@ namespace UnrealSharp::Mono
         static void*                        MonoPInvokeGetSymbol(void* handle, const char* name, char** err, void* InUserData); // NOLINT
         static void*                        MonoPInvokeFallbackClose(void* handle, void* InUserData); // NOLINT
 
+        static MonoString*                  FindOrInternMonoString(const FStringView& InStringView);
+        static void                         ClearInternedStrings();
+
     public:
         static FMonoRuntime*                Runtime;
         static FFallbackApiMappingType      FallbackApis;
+
+    private:
+        struct FInternedString
+        {
+            MonoString*                     String;
+            uint32                          GCHandle;
+        };
+
+        struct FInternedStringKeyFuncs : BaseKeyFuncs<TPair<FString, FInternedString>, FString, false>
+        {
+            static const FString&           GetSetKey(const TPair<FString, FInternedString>& InElement) { return InElement.Key; }
+            static bool                     Matches(const FString& InA, const FString& InB) { return InA.Equals(InB, ESearchCase::CaseSensitive); }
+            static bool                     Matches(const FString& InA, const FStringView& InB) { return FStringView(InA).Equals(InB, ESearchCase::CaseSensitive); }
+            static uint32                   GetKeyHash(const FString& InKey) { return HashString(InKey); }
+            static uint32                   HashString(const FStringView& InStringView);
+        };
+
+        typedef TMap<FString, FInternedString, FDefaultSetAllocator, FInternedStringKeyFuncs> FInternedStringMapType;
+
+        // short strings passed to C# repeatedly share one MonoString, C# strings are immutable.
+        static FInternedStringMapType       InternedStrings;
+        // how many times a short string is converted before it is interned, keyed by hash
+        static TMap<uint32, uint8>          InternCandidates;
+        static int32                        MaxInternedStringLength;
     };
 }
 #endif
@@ -0,0 +1,127 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "MonoRuntime/MonoJitPrewarmer.h"
+
+#if WITH_MONO
+#include "Misc/UnrealSharpLog.h"
+#include "Misc/ScopedExit.h"
+#include "HAL/RunnableThread.h"
+
+namespace UnrealSharp::Mono
+{
+    FMonoJitPrewarmer::FMonoJitPrewarmer(MonoDomain* InDomain, TArray<FEntry>&& InEntries) :
+        Domain(InDomain),
+        Entries(MoveTemp(InEntries))
+    {
+        check(Domain != nullptr);
+
+        Thread.Reset(FRunnableThread::Create(this, TEXT("UnrealSharpJitPrewarmer"), 0, TPri_BelowNormal));
+    }
+
+    FMonoJitPrewarmer::~FMonoJitPrewarmer()
+    {
+        if (Thread)
+        {
+            // kill waits the thread after Stop is called
+            Thread->Kill(true);
+            Thread.Reset();
+        }
+    }
+
+    uint32 FMonoJitPrewarmer::Run()
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        MonoThread* AttachedThread = mono_thread_attach(Domain);
+
+        US_SCOPED_EXIT(mono_thread_detach(AttachedThread););
+
+        int32 CompiledCount = 0;
+        int32 FailedCount = 0;
+
+        for (const FEntry& Entry : Entries)
+        {
+            if (bIsStopRequested)
+            {
+                break;
+            }
+
+            if (Entry.bIsType)
+            {
+                const size_t Separator = Entry.Name.rfind('.');
+                const std::string Namespace = Separator != std::string::npos ? Entry.Name.substr(0, Separator) : std::string();
+                const std::string Name = Separator != std::string::npos ? Entry.Name.substr(Separator + 1) : Entry.Name;
+
+                if (MonoClass* Class = mono_class_from_name(Entry.Image, Namespace.c_str(), Name.c_str()); Class != nullptr && mono_class_init(Class))
+                {
+                    ++CompiledCount;
+                }
+                else
+                {
+                    ++FailedCount;
+                }
+
+                continue;
+            }
+
+            MonoMethodDesc* MethodDesc = mono_method_desc_new(Entry.Name.c_str(), true);
+
+            if (MethodDesc == nullptr)
+            {
+                ++FailedCount;
+                continue;
+            }
+
+            MonoMethod* Method = mono_method_desc_search_in_image(MethodDesc, Entry.Image);
+            mono_method_desc_free(MethodDesc);
+
+            // abstract or generic methods can't be compiled without an instance type
+            if (Method != nullptr && mono_compile_method(Method) != nullptr)
+            {
+                ++CompiledCount;
+            }
+            else
+            {
+                ++FailedCount;
+            }
+        }
+
+        US_LOG(TEXT("JIT prewarm %s: %d methods and types prepared, %d failed, %.2f ms."), 
+            bIsStopRequested ? TEXT("stopped") : TEXT("finished"), 
+            CompiledCount, 
+            FailedCount, 
+            (FPlatformTime::Seconds() - StartTime) * 1000.0
+            );
+
+        return 0;
+    }
+
+    void FMonoJitPrewarmer::Stop()
+    {
+        bIsStopRequested = true;
+    }
+}
+#endif
@@ -0,0 +1,70 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#if WITH_MONO
+#include "MonoRuntime/Mono.h"
+#include "HAL/Runnable.h"
+#include <string>
+#include <atomic>
+
+namespace UnrealSharp::Mono
+{
+    /*
+    * Compile C# methods by JIT and initialize C# classes on a background thread attached to mono, 
+    * so the first uses of them in game don't pay for JIT compilation and class loading.
+    * Images must be loaded before, the thread only searches methods and classes in them.
+    */
+    class FMonoJitPrewarmer : public FRunnable
+    {
+    public:
+        struct FEntry
+        {
+            MonoImage*          Image = nullptr;
+
+            // method eg: UnrealSharp.GameScripts.MyActor:ReceiveBeginPlay ()
+            // type eg: UnrealSharp.GameScripts.MyActor
+            std::string         Name;
+
+            bool                bIsType = false;
+        };
+
+        FMonoJitPrewarmer(MonoDomain* InDomain, TArray<FEntry>&& InEntries);
+
+        // stop and wait the thread, must be destroyed before domain is cleaned up
+        virtual ~FMonoJitPrewarmer() override;
+
+        virtual uint32          Run() override;
+        virtual void            Stop() override;
+
+    private:
+        MonoDomain*                     Domain;
+        TArray<FEntry>                  Entries;
+        std::atomic<bool>               bIsStopRequested = false;
+        TUniquePtr<FRunnableThread>     Thread;
+    };
+}
+#endif
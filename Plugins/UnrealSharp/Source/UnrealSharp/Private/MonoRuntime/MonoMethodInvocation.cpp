@@ -25,74 +25,69 @@
 */
 #include "MonoRuntime/MonoMethodInvocation.h"
 #include "Misc/UnrealSharpLog.h"
+#include "Misc/UnrealSharpTrace.h"
+#include "Misc/UnrealSharpStats.h"
 
 #if WITH_MONO
-#include "MonoRuntime/MonoInteropUtils.h"
+#include "MonoRuntime/MonoExceptionReporter.h"
 #include "MonoRuntime/MonoMethod.h"
 #include "Misc/StackMemory.h"
 #include "Misc/ScopedCSharpMethodInvocation.h"
 
 namespace UnrealSharp::Mono
 {
-    class FMonoInvocationException : public ICSharpMethodInvocationException
+    /*
+    * Keep the exception object alive by a GC handle, 
+    * message and stack trace are converted to FString only when they are read.
+    */
+    class FMonoInvocationException : public ICSharpMethodInvocationException, FNoncopyable
     {
     public:
-        FString Message;
-        FString StackTrace;
-
-        FMonoInvocationException(MonoObject* InExceptionObject)
+        FMonoInvocationException(MonoObject* InExceptionObject, uint32 InFingerprint) :
+            Handle(mono_gchandle_new(InExceptionObject, false)),
+            Fingerprint(InFingerprint)
         {
-            MonoObject* ExceptionInStringConversion = nullptr;
-            MonoString* MonoExceptionString = mono_object_to_string(InExceptionObject, &ExceptionInStringConversion);
+        }
 
-            if (MonoExceptionString != nullptr)
-            {
-                Message = FMonoInteropUtils::GetFString(MonoExceptionString);
-            }
-            else
-            {
-                check(ExceptionInStringConversion);
-
-                // Can't really get much out of the original exception with the public API, so just note that two exceptions were thrown
-                FString ExceptionString;
-                MonoExceptionString = mono_object_to_string(ExceptionInStringConversion, nullptr);
-                check(MonoExceptionString);
-                
-                Message = FMonoInteropUtils::GetFString(MonoExceptionString);
-            }
+        virtual ~FMonoInvocationException() override
+        {
+            mono_gchandle_free(Handle);
+        }
 
-            // set to default if not valid...
-            if (Message.IsEmpty())
+        virtual const FString& GetMessage() const override
+        {
+            if (!bMessageMaterialized)
             {
-                Message = TEXT("MonoRuntimeException");
+                Message = FMonoExceptionReporter::GetExceptionMessage(mono_gchandle_get_target(Handle));
+                bMessageMaterialized = true;
             }
 
-            // get stack trace
-            MonoClass* ExceptionClass = mono_object_get_class(InExceptionObject);
-
-            // FMonoRuntime::DumpClassInformation(exceptionClass);
-            MonoProperty* StackTraceProperty = mono_class_get_property_from_name(ExceptionClass, "StackTrace");
+            return Message;
+        }
 
-            if (StackTraceProperty != nullptr)
+        virtual const FString& GetStackTrace() const override
+        {
+            if (!bStackTraceMaterialized)
             {
-                MonoString* stackTrace = (MonoString*)mono_property_get_value(StackTraceProperty, InExceptionObject, nullptr, nullptr); // NOLINT
+                StackTrace = FMonoExceptionReporter::GetExceptionStackTrace(mono_gchandle_get_target(Handle));
+                bStackTraceMaterialized = true;
+            }
 
-                if (stackTrace != nullptr)
-                {
-                    StackTrace = FMonoInteropUtils::GetFString(stackTrace);
-                }
-            }            
+            return StackTrace;
         }
 
-        virtual const FString& GetMessage() const override
+        virtual uint32 GetFingerprint() const override
         {
-            return Message;
+            return Fingerprint;
         }
 
-        virtual const FString& GetStackTrace() const override
-        {
-            return StackTrace;
-        }
+    private:
+        uint32          Handle;
+        uint32          Fingerprint;
+        mutable FString Message;
+        mutable FString StackTrace;
+        mutable bool    bMessageMaterialized = false;
+        mutable bool    bStackTraceMaterialized = false;
     };
     
     FMonoMethodInvocation::FMonoMethodInvocation(const TSharedPtr<FMonoMethod>& InMethod) :
@@ -112,25 +107,24 @@ namespace UnrealSharp::Mono
 
     void* FMonoMethodInvocation::Invoke(void* InInstance)
     {
+        // the exception object is released immediately, its strings are never built
         TUniquePtr<ICSharpMethodInvocationException> OutException;
         return Invoke(InInstance, OutException);
     }
 
     void* FMonoMethodInvocation::Invoke(void* InInstance, TUniquePtr<ICSharpMethodInvocationException>& OutException)
     {
+        US_INTEROP_SCOPE(STAT_UnrealSharp_CSharpMethodInvoke);
+
         MonoMethod* ActualMethod = Method->GetMethod();
 
         if (InInstance != nullptr && Method->IsVirtual())
         {
             ActualMethod = mono_object_get_virtual_method((MonoObject*)InInstance, ActualMethod); // NOLINT
-
-#if UE_BUILD_DEBUG
-        //    FString ActualMethodName = FMonoMethod::GetMethodFullName(ActualMethod, true);
-
-        //    US_LOG(TEXT("invoke C# virtual function %s, map to %s"), *Method->GetFullyQualifiedName(), *ActualMethodName);
-#endif
         }
 
+        US_TRACE_EVENT(VeryVerbose, CSharpMethodInvoke, Method->GetMethod(), ActualMethod);
+
         check(Method->IsStatic() || (!Method->IsStatic() && InInstance));
 
         // ParamBufferPtr can be null, but ParameterBuffer can't be null
@@ -142,9 +136,11 @@ namespace UnrealSharp::Mono
 
         if (Exception != nullptr)
         {
-            OutException.Reset(new FMonoInvocationException(Exception));
+            const uint32 Fingerprint = FMonoExceptionReporter::ComputeFingerprint(Exception, ActualMethod);
+
+            FMonoExceptionReporter::Report(Exception, Fingerprint);
 
-            US_LOG_ERROR(TEXT("C# Exception:%s"), *OutException->GetMessage());
+            OutException.Reset(new FMonoInvocationException(Exception, Fingerprint));
 
             return nullptr;
         }
@@ -26,6 +26,7 @@
 #include "MonoRuntime/MonoPropertyMarshaller.h"
 #include "ICSharpMethodInvocation.h"
 #include "Misc/CSharpStructures.h"
+#include "Misc/UnrealSharpTrace.h"
 
 #if WITH_MONO
 #include "MonoRuntime/MonoInteropUtils.h"
@@ -245,7 +246,7 @@ namespace UnrealSharp::Mono
         {
             MonoString* CSharpString = (MonoString*)InCSharpDataPointer; // NOLINT
 
-            *(FString*)InUnrealDataPointer = FMonoInteropUtils::GetFString(CSharpString); // NOLINT
+            FMonoInteropUtils::GetFString(CSharpString, *(FString*)InUnrealDataPointer); // NOLINT
         }
         else
         {
@@ -338,9 +339,7 @@ namespace UnrealSharp::Mono
         {
             FCSharpText* TextPtr = (FCSharpText*)InCSharpDataPointer; // NOLINT
 
-            FString Text = FMonoInteropUtils::GetFString((MonoString*)TextPtr->Text); // NOLINT
-
-            *(FText*)InUnrealDataPointer = FText::FromString(Text); // NOLINT
+            *(FText*)InUnrealDataPointer = FText::FromStringView(FMonoInteropUtils::GetStringView((MonoString*)TextPtr->Text)); // NOLINT
         }
         else if (InCopyDirection == EMarshalCopyDirection::UnrealToCSharp)
         {
@@ -375,10 +374,10 @@ namespace UnrealSharp::Mono
         {
             MonoObject* ObjectPtr = (MonoObject*)InCSharpDataPointer; // NOLINT
 
-            FMonoInteropUtils::DumpMonoObjectInformation(ObjectPtr);
-
             UObject* UnrealObjectPtr = FMonoInteropUtils::GetUnrealObjectOfCSharpObject(ObjectPtr);
 
+            US_TRACE_EVENT(Verbose, ObjectToUnreal, ObjectPtr, UnrealObjectPtr);
+
             *(UObject**)InUnrealDataPointer = UnrealObjectPtr; // NOLINT
         }
         else if (InCopyDirection == EMarshalCopyDirection::UnrealToCSharp)
@@ -389,6 +388,8 @@ namespace UnrealSharp::Mono
 
             MonoObject* ObjectPtr = (MonoObject*)Value.ObjectPtr; // NOLINT
 
+            US_TRACE_EVENT(Verbose, ObjectToCSharp, Param, ObjectPtr);
+
             *(MonoObject**)InCSharpDataPointer = ObjectPtr; // NOLINT
         }
     }
@@ -507,7 +508,7 @@ namespace UnrealSharp::Mono
         {
             // InCSharpDataPointer is MonoObject*
             MonoObject* CSharpObject = (MonoObject*)InCSharpDataPointer; // NOLINT
-            //FMonoInteropUtils::DumpMonoObjectInformation(CSharpObject);
+            US_TRACE_EVENT(Verbose, SoftObjectToUnreal, InUnrealDataPointer, CSharpObject);
 
             ICSharpRuntime* Runtime = FCSharpRuntimeFactory::GetInstance();
             checkSlow(Runtime);
@@ -557,7 +558,7 @@ namespace UnrealSharp::Mono
         {
             // InCSharpDataPointer is MonoObject*
             MonoObject* CSharpObject = (MonoObject*)InCSharpDataPointer; // NOLINT
-            //FMonoInteropUtils::DumpMonoObjectInformation(CSharpObject);
+            US_TRACE_EVENT(Verbose, SoftObjectToUnreal, InUnrealDataPointer, CSharpObject);
 
             ICSharpRuntime* Runtime = FCSharpRuntimeFactory::GetInstance();
             checkSlow(Runtime);
@@ -28,9 +28,14 @@
 #include "Misc/UnrealSharpLog.h"
 #include "Misc/ScopedExit.h"
 #include "Misc/UnrealSharpPaths.h"
+#include "Misc/UnrealSharpStats.h"
 
 #if WITH_MONO
 #include "MonoProfilerService.h"
+#include "MonoRuntime/MonoExceptionReporter.h"
+#include "MonoRuntime/MonoShadowCopyCache.h"
+#include "MonoRuntime/MonoAssemblyPrefetcher.h"
+#include "MonoRuntime/MonoJitPrewarmer.h"
 #include "MonoRuntime/MonoInteropUtils.h"
 #include "MonoRuntime/MonoMethod.h"
 #include "MonoRuntime/MonoType.h"
@@ -48,7 +53,15 @@ namespace UnrealSharp::Mono
     FString FMonoRuntime::NativeLibraryPath;
     FString FMonoRuntime::ManagedLibraryPath;
     TArray<FString> FMonoRuntime::LibrarySearchPaths;
+    FMonoAssemblyIndex FMonoRuntime::AssemblyIndex;
     bool FMonoRuntime::bIsDebuggerAvailable = false;
+    bool FMonoRuntime::bUseMappedAssemblies = false;
+    TArray<TUniquePtr<FMonoRuntime::FMappedAssemblyFile>> FMonoRuntime::MappedAssemblyFiles;
+    TMap<FString, FDateTime> FMonoRuntime::LoadedAssemblyTimeStamps;
+    FString FMonoRuntime::AotImageDirectory;
+    int32 FMonoRuntime::AotImageHitCount = 0;
+    int32 FMonoRuntime::AotImageMissCount = 0;
+    bool FMonoRuntime::bIsFullAotMode = false;
 
     void FMonoRuntime::InitLibrarySearchPaths()
     {
@@ -85,18 +98,24 @@ namespace UnrealSharp::Mono
         LibrarySearchPaths.Add(NativePath);
     }
 
-    FString FMonoRuntime::SearchLibrary(const FString& InName)
+    FString FMonoRuntime::SearchLibrary(const FString& InName, const FString& InCulture)
     {
-        for (const auto& SearchPath : LibrarySearchPaths)
+        FString AsmPath = AssemblyIndex.Find(InName, InCulture);
+
+        // it may be created after the index is built, but probes of satellite assemblies miss routinely, 
+        // so a missing name only refreshes the index once until the index is rebuilt
+        if (AsmPath.IsEmpty() && !AssemblyIndex.IsKnownMissing(InName, InCulture))
         {
-            auto AsmPath = FPaths::Combine(*SearchPath, *InName);
-            if (FPaths::FileExists(AsmPath))
+            AssemblyIndex.Refresh();
+            AsmPath = AssemblyIndex.Find(InName, InCulture);
+
+            if (AsmPath.IsEmpty())
             {
-                return AsmPath;
+                AssemblyIndex.MarkMissing(InName, InCulture);
             }
         }
 
-        return FString();
+        return AsmPath;
     }
 
 #if PLATFORM_MAC || PLATFORM_WINDOWS || PLATFORM_LINUX
@@ -153,41 +172,23 @@ namespace UnrealSharp::Mono
 #endif
         bIsDebuggerAvailable = false;
 
+#if !WITH_EDITOR
+        bUseMappedAssemblies = GetDefault<UUnrealSharpSettings>()->bUseMemoryMappedAssemblies;
+#endif
+
         if (LibrarySearchPaths.IsEmpty())
         {
             InitLibrarySearchPaths();
         }
 
-        FString CoreClrRuntimePath = FPaths::Combine(NativeLibraryPath, TEXT(UNREALSHARP_CORECLR_LIBNAME));
-        check(FPaths::FileExists(CoreClrRuntimePath));
-
-        auto UnrealSharpTempDirectory = FUnrealSharpPaths::GetUnrealSharpIntermediateDir();
-
 #if PLATFORM_MAC || PLATFORM_WINDOWS || PLATFORM_LINUX
-        DeleteIntermediateTempFiles(UnrealSharpTempDirectory);
-#endif
-
-#if WITH_EDITOR
-        if(bUseTempCoreClrLibrary)
-        {
-            FString TempDllName = FPaths::Combine(UnrealSharpTempDirectory, UnrealSharpTempFilePrefix + TEXT("coreclr.") + FGuid::NewGuid().ToString() + TEXT(".") + FPlatformProcess::GetModuleExtension());
+        // temp copies were created for each start before shadow copy cache
+        DeleteIntermediateTempFiles(FUnrealSharpPaths::GetUnrealSharpIntermediateDir());
 
-            IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-            PlatformFile.CopyFile(*TempDllName, *CoreClrRuntimePath);
-
-            check(FPaths::FileExists(TempDllName));
-
-            CoreClrRuntimePath = TempDllName;
-        }
-#endif        
-
-#if WITH_EDITOR
-        LibraryHandle = FPlatformProcess::GetDllHandle(*CoreClrRuntimePath);
-
-        checkf(LibraryHandle, TEXT("Failed load corelib from:%s"), *CoreClrRuntimePath);
-
-        FMonoApis::Import(LibraryHandle);
+        FMonoShadowCopyCache::Initialize(GetDefault<UUnrealSharpSettings>()->ShadowCopyMaxAgeDays);
 #endif
+
+        LoadCoreClrLibrary();
         
 #if PLATFORM_MAC
         // load managed require .dylib here
@@ -218,6 +219,93 @@ namespace UnrealSharp::Mono
 #endif
     }
 
+    void FMonoRuntime::LoadCoreClrLibrary()
+    {
+        FString CoreClrRuntimePath = FPaths::Combine(NativeLibraryPath, TEXT(UNREALSHARP_CORECLR_LIBNAME));
+        check(FPaths::FileExists(CoreClrRuntimePath));
+
+#if WITH_EDITOR
+        if(bUseTempCoreClrLibrary)
+        {
+            // every copy is a new library instance with its own runtime states, so mono can be initialized again
+            // loaders identify libraries by file, so it must be an exclusive copy instead of a hard link
+            FMonoShadowCopyCache::FOptions Options;
+            Options.bExclusive = true;
+
+            CoreClrRuntimePath = FMonoShadowCopyCache::Acquire(TEXT("coreclr"), { CoreClrRuntimePath }, Options);
+            CoreClrShadowCopyPath = CoreClrRuntimePath;
+        }
+#endif        
+
+#if WITH_EDITOR
+        LibraryHandle = FPlatformProcess::GetDllHandle(*CoreClrRuntimePath);
+
+        checkf(LibraryHandle, TEXT("Failed load corelib from:%s"), *CoreClrRuntimePath);
+
+        FMonoApis::Import(LibraryHandle);
+#endif
+    }
+
+    bool FMonoRuntime::CanReload() const
+    {
+        return bUseTempCoreClrLibrary;
+    }
+
+    bool FMonoRuntime::ReloadInternal()
+    {
+        check(CanReload());
+
+        ShutdownInternal();
+
+        AssemblyCaches.Empty();
+        Domain = nullptr;
+
+        // release the listening port before the new one is created
+        MonoProfiler.Reset();
+
+#if WITH_EDITOR
+        // the old library is not freed, same as the destructor, it may still be referenced by threads created by it
+        FMonoApis::UnImport();
+        LibraryHandle = nullptr;
+
+        FMonoShadowCopyCache::Release(CoreClrShadowCopyPath);
+        CoreClrShadowCopyPath.Reset();
+#endif
+
+        LoadCoreClrLibrary();
+
+        return InitializeInternal();
+    }
+
+    void FMonoRuntime::PrewarmAsync(TArray<FCSharpStartupProfile::FEntry>&& InEntries)
+    {
+        if (bIsFullAotMode)
+        {
+            return;
+        }
+
+        TArray<FMonoJitPrewarmer::FEntry> Entries;
+        Entries.Reserve(InEntries.Num());
+
+        // images are loaded here, the background thread only searches methods and classes in them
+        for (const FCSharpStartupProfile::FEntry& Entry : InEntries)
+        {
+            if (MonoImage* Image = LoadAssembly(Entry.AssemblyName).Image; Image != nullptr)
+            {
+                Entries.Add({ Image, TCHAR_TO_ANSI(*Entry.Name), Entry.Kind == FCSharpStartupProfile::EEntryKind::Type });
+            }
+        }
+
+        if (Entries.IsEmpty())
+        {
+            return;
+        }
+
+        US_LOG(TEXT("Start JIT prewarm of %d methods and types."), Entries.Num());
+
+        JitPrewarmer = MakeUnique<FMonoJitPrewarmer>(Domain, MoveTemp(Entries));
+    }
+
     FMonoRuntime::~FMonoRuntime()
     {
 #if WITH_EDITOR
@@ -233,6 +321,13 @@ namespace UnrealSharp::Mono
             
             LibraryHandle = nullptr;
         }        
+
+#if WITH_EDITOR
+        if (!CoreClrShadowCopyPath.IsEmpty())
+        {
+            FMonoShadowCopyCache::Release(CoreClrShadowCopyPath);
+        }
+#endif
         
 #if PLATFORM_MAC
         for(auto& handle : ExtraLibraryHandles)
@@ -257,6 +352,18 @@ namespace UnrealSharp::Mono
     {    
         mono_install_assembly_preload_hook(OnAssemblyLoaded, nullptr);
 
+        FMonoExceptionReporter::Initialize(GetDefault<UUnrealSharpSettings>()->ExceptionReportInterval);
+
+        if (AssemblyIndex.Num() == 0)
+        {
+            AssemblyIndex.Build(LibrarySearchPaths, FPaths::Combine(FUnrealSharpPaths::GetUnrealSharpIntermediateDir(), TEXT("AssemblyIndex.txt")));
+        }
+        else
+        {
+            // C# codes may be rebuilt since last runtime
+            AssemblyIndex.Refresh();
+        }
+
         InitLogger();
 
         if(!GetDefault<UUnrealSharpSettings>()->bPerformanceMode)
@@ -264,6 +371,8 @@ namespace UnrealSharp::Mono
             InitDebugger();
         }
 
+        InitAot();
+
         if (!InitDomain())
         {
             return false;
@@ -342,6 +451,63 @@ namespace UnrealSharp::Mono
         }
     }
 
+    void FMonoRuntime::InitAot()
+    {
+        EUnrealSharpMonoAotMode AotMode = GetDefault<UUnrealSharpSettings>()->MonoAotMode;
+
+        AotImageDirectory.Empty();
+        AotImageHitCount = 0;
+        AotImageMissCount = 0;
+        bIsFullAotMode = false;
+
+        if (AotMode == EUnrealSharpMonoAotMode::Disabled)
+        {
+            return;
+        }
+
+        if (bIsDebuggerAvailable)
+        {
+            US_LOG_WARN(TEXT("Mono AOT mode is ignored, because debugger is available."));
+            return;
+        }
+
+        const FString Directory = FPaths::Combine(FUnrealSharpPaths::GetUnrealSharpManagedLibraryDir(), TEXT("AOT"));
+
+        if (!FPaths::DirectoryExists(Directory))
+        {
+            US_LOG_WARN(TEXT("Mono AOT mode is ignored, AOT image directory is not exists: %s"), *Directory);
+            return;
+        }
+
+        AotImageDirectory = Directory;
+
+        // mono can't start without the image of corelib in full mode, framework assemblies are compiled by UnrealSharpTool with --full
+        if (AotMode == EUnrealSharpMonoAotMode::Full)
+        {
+            if (const FString CoreLibImagePath = FPaths::Combine(Directory, FString(TEXT("System.Private.CoreLib.dll.")) + FPlatformProcess::GetModuleExtension()); !FPaths::FileExists(CoreLibImagePath))
+            {
+                US_LOG_ERROR(TEXT("Mono full AOT mode is refused, AOT image of framework assemblies is not exists: %s, use normal mode instead."), *CoreLibImagePath);
+
+                AotMode = EUnrealSharpMonoAotMode::Normal;
+            }
+        }
+
+        bIsFullAotMode = AotMode == EUnrealSharpMonoAotMode::Full;
+
+        // mono searches AOT images of an assembly by its image name in these paths
+        const std::string Argument = TCHAR_TO_UTF8(*FString::Printf(TEXT("--aot-path=%s"), *AotImageDirectory));
+
+        const char* Options[] =
+        {
+            Argument.c_str()
+        };
+
+        mono_jit_parse_options(sizeof(Options)/sizeof(Options[0]), (char**)Options); // NOLINT
+        mono_jit_set_aot_mode(AotMode == EUnrealSharpMonoAotMode::Full ? MONO_AOT_MODE_FULL : MONO_AOT_MODE_NORMAL);
+
+        US_LOG(TEXT("Mono AOT mode %s, load AOT images from: %s"), AotMode == EUnrealSharpMonoAotMode::Full ? TEXT("Full") : TEXT("Normal"), *AotImageDirectory);
+    }
+
     void FMonoRuntime::MonoLog(const char* InDomainName, const char* InLogLevel, const char* InMessage, mono_bool InFatal, void* InUserData) // NOLINT
     {        
         if (InFatal || 0 == FCStringAnsi::Strncmp("error", InLogLevel, 5))
@@ -394,6 +560,9 @@ namespace UnrealSharp::Mono
 
         FMonoInteropUtils::Initialize(this);
 
+        // automatic collections are triggered by allocations, only the GC events can measure all of them
+        mono_profiler_set_gc_event_callback(mono_profiler_create(nullptr), OnGCEvent);
+
         char* Mono_Version = mono_get_runtime_build_info();
         const auto MonoVersion = FString(ANSI_TO_TCHAR(Mono_Version));
         mono_free(Mono_Version);
@@ -403,9 +572,54 @@ namespace UnrealSharp::Mono
         return true;
     }
 
+    // the collecting thread stops and restarts the world, so both events are received by the same thread
+    static thread_local uint64 GCStartCycles = 0;
+#if CPUPROFILERTRACE_ENABLED
+    static thread_local bool bIsGCTraced = false;
+#endif
+
+    void FMonoRuntime::OnGCEvent(::MonoProfiler* InProfiler, MonoProfilerGCEvent InEvent, uint32_t InGeneration, mono_bool bIsSerial)
+    {
+        if (InEvent == MONO_GC_EVENT_PRE_STOP_WORLD)
+        {
+            GCStartCycles = FPlatformTime::Cycles64();
+
+#if CPUPROFILERTRACE_ENABLED
+            bIsGCTraced = UE_TRACE_CHANNELEXPR_IS_ENABLED(UnrealSharpChannel);
+
+            if (bIsGCTraced)
+            {
+                static const uint32 EventId = FCpuProfilerTrace::OutputEventType(TEXT("STAT_UnrealSharp_GarbageCollect"));
+                FCpuProfilerTrace::OutputBeginEvent(EventId);
+            }
+#endif
+        }
+        else if (InEvent == MONO_GC_EVENT_POST_START_WORLD && GCStartCycles != 0)
+        {
+#if STATS
+            FThreadStats::AddMessage(GET_STATFNAME(STAT_UnrealSharp_GarbageCollect), EStatOperation::Add, static_cast<int64>(FPlatformTime::Cycles64() - GCStartCycles), true);
+#endif
+
+#if CPUPROFILERTRACE_ENABLED
+            if (bIsGCTraced)
+            {
+                FCpuProfilerTrace::OutputEndEvent();
+                bIsGCTraced = false;
+            }
+#endif
+
+            GCStartCycles = 0;
+        }
+    }
+
     void FMonoRuntime::ShutdownInternal()
     {
+        // the thread is attached to the domain
+        JitPrewarmer.Reset();
+        FMonoAssemblyPrefetcher::Reset();
+
         FMonoInteropUtils::Uninitialize();
+        FMonoExceptionReporter::Uninitialize();
         
         if (!bUseTempCoreClrLibrary)
         {
@@ -415,65 +629,30 @@ namespace UnrealSharp::Mono
         }        
 
         mono_jit_cleanup(Domain);
+
+        // images are closed, the mappings are not referenced any more
+        MappedAssemblyFiles.Empty();
+        LoadedAssemblyTimeStamps.Empty();
+
+        if (!AotImageDirectory.IsEmpty())
+        {
+            US_LOG(TEXT("Mono AOT images: %d found, %d missing."), AotImageHitCount, AotImageMissCount);
+        }
     }
 
     void FMonoRuntime::MonoStringToFString(FString& Result, MonoString* InString)
     {
-        auto* UTF16Text = mono_string_to_utf16(InString);
-        Result = UTF16Text;
-
-        mono_free(UTF16Text);
+        FMonoInteropUtils::GetFString(InString, Result);
     }
 
     FName FMonoRuntime::MonoStringToFName(MonoString* InString)
     {
-        FString TempString;
-        MonoStringToFString(TempString, InString);
-        return FName(*TempString);
+        return FMonoInteropUtils::GetFName(InString);
     }
 
-    void FMonoRuntime::LogException(MonoObject* InException) // NOLINT
+    void FMonoRuntime::LogException(MonoObject* InException, const void* InSite) // NOLINT
     {
-        FText ExceptionError;
-        MonoObject* ExceptionInStringConversion = nullptr;
-        MonoString* MonoExceptionString = mono_object_to_string(InException, &ExceptionInStringConversion);
-        if (nullptr != MonoExceptionString)
-        {
-            FString ExceptionString;
-            MonoStringToFString(ExceptionString, MonoExceptionString);
-            FFormatNamedArguments Args;
-            Args.Add(TEXT("ExceptionMessage"), FText::FromString(ExceptionString));
-            ExceptionError = FText::Format(LOCTEXT("ExceptionError", "Managed exception: {ExceptionMessage}"), Args);
-        }
-        else
-        {
-            check(ExceptionInStringConversion);
-            // Can't really get much out of the original exception with the public API, so just note that two exceptions were thrown
-            FString ExceptionString;
-            MonoExceptionString = mono_object_to_string(ExceptionInStringConversion, nullptr);
-            check(MonoExceptionString);
-            MonoStringToFString(ExceptionString, MonoExceptionString);
-            FFormatNamedArguments Args;
-            MonoClass* ExceptionClass = mono_object_get_class(InException);
-            Args.Add(TEXT("OriginalExceptionType"), FText::FromString(mono_class_get_name(ExceptionClass)));
-            Args.Add(TEXT("NestedExceptionMessage"), FText::FromString(ExceptionString));
-            ExceptionError = FText::Format(LOCTEXT("NestedExceptionError", "Nested exception! Original exception was of type '{OriginalExceptionType}'. Nested Exception: {NestedExceptionMessage}"), Args);
-        }
-
-        if (IsInGameThread())
-        {
-            SendErrorToMessageLog(ExceptionError);
-        }
-        else
-        {
-            // dispatch to game thread
-            FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-                FSimpleDelegateGraphTask::FDelegate::CreateStatic(SendErrorToMessageLog, ExceptionError)
-                , nullptr
-                , nullptr
-                , ENamedThreads::GameThread
-            );
-        }
+        FMonoExceptionReporter::Report(InException, FMonoExceptionReporter::ComputeFingerprint(InException, InSite));
     }
 
     void FMonoRuntime::SendErrorToMessageLog(FText InError) // NOLINT
@@ -495,23 +674,17 @@ namespace UnrealSharp::Mono
             AsmName = AsmName + TEXT(".dll");
         }
 
-        for (const auto& SearchPath : LibrarySearchPaths)
+        if (const FString AsmPath = SearchLibrary(AsmName, AsmCulture); !AsmPath.IsEmpty())
         {
-            FString AsmPath = FPaths::Combine(*SearchPath, *AsmName);
-
-            if (!FPaths::FileExists(AsmPath))
-            {
-                AsmPath = FPaths::Combine(*SearchPath, *AsmCulture, *AsmName);
-                if (!FPaths::FileExists(AsmPath))
-                {
-                    continue;
-                }
-            }
-
             US_LOG(TEXT("Found assembly %s at path '%s'."), *AsmName, *AsmPath);
 
             const auto [Assembly, Image] = StaticLoadAssembly(AsmPath);
 
+            if (Assembly != nullptr)
+            {
+                ReportAotImage(AsmPath);
+            }
+
             return Assembly;
         }
 
@@ -525,6 +698,11 @@ namespace UnrealSharp::Mono
         const FString AbsoluteAssemblyPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*InAssemblyPath);
         const FString AsmName = FPaths::GetBaseFilename(InAssemblyPath);
 
+        if (AsmName.StartsWith(TEXT("UnrealSharp.")))
+        {
+            LoadedAssemblyTimeStamps.Add(AbsoluteAssemblyPath, IFileManager::Get().GetTimeStamp(*AbsoluteAssemblyPath));
+        }
+
         MonoImageOpenStatus Status;
         MonoAssembly* LoadedAssembly = nullptr; // NOLINT
 
@@ -539,50 +717,59 @@ namespace UnrealSharp::Mono
                 return { LoadedAssembly, mono_assembly_get_image(LoadedAssembly)};
             }
         }
-#if PLATFORM_MAC || PLATFORM_WINDOWS || PLATFORM_LINUX
-        else if(bIsDebuggerAvailable)
+        else if (bUseMappedAssemblies)
         {
-            // create temp files for them
-            const FString SourceAssemblyPath = AbsoluteAssemblyPath;
-            const FString SourcePdbPath = FPaths::ChangeExtension(AbsoluteAssemblyPath, TEXT("pdb"));
-
-            const FString TempFileName = FString::Printf(TEXT("%s%s.%s"), *UnrealSharpTempFilePrefix, *AsmName, *FGuid::NewGuid().ToString());
-            FString IntermediateDirectory = FUnrealSharpPaths::GetUnrealSharpIntermediateDir();
+            const FMonoAssemblyCache Cache = StaticLoadMappedAssembly(AbsoluteAssemblyPath, GetImageName(AbsoluteAssemblyPath));
 
-            const FString IntermediateDllPath = FPaths::Combine(IntermediateDirectory, TempFileName + TEXT(".dll"));
-            const FString IntermediatePdbPath = FPaths::Combine(IntermediateDirectory, TempFileName + TEXT(".pdb"));
+            if (Cache.IsValid())
+            {
+                return Cache;
+            }
 
-            IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+            US_LOG_WARN(TEXT("Failed to map assembly '%s', fallback to load it into memory."), *AbsoluteAssemblyPath);
+        }
+#if PLATFORM_MAC || PLATFORM_WINDOWS || PLATFORM_LINUX
+        else if(bIsDebuggerAvailable)
+        {
+            // load from shadow copy so the assembly can be rebuilt, mono finds pdb next to it
+            FMonoShadowCopyCache::FOptions Options;
+            Options.bAllowHardLink = GetDefault<UUnrealSharpSettings>()->bUseHardLinkShadowCopies;
 
-            PlatformFile.CopyFile(*IntermediateDllPath, *SourceAssemblyPath);
-            PlatformFile.CopyFile(*IntermediatePdbPath, *SourcePdbPath);
+            const FString IntermediateDllPath = FMonoShadowCopyCache::Acquire(AsmName, { AbsoluteAssemblyPath, FPaths::ChangeExtension(AbsoluteAssemblyPath, TEXT("pdb")) }, Options);
 
             LoadedAssembly = mono_assembly_open(TCHAR_TO_ANSI(*IntermediateDllPath), &Status);
             if (LoadedAssembly)
             {
-                US_LOG(TEXT("Loaded assembly from path temp path '%s'."), *IntermediateDllPath);
+                US_LOG(TEXT("Loaded assembly from shadow copy '%s'."), *IntermediateDllPath);
 
                 return { LoadedAssembly, mono_assembly_get_image(LoadedAssembly) };
             }
         }
 #endif
 
-        const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*AbsoluteAssemblyPath));
-        if (!Reader)
+        // read on worker thread when the module is started
+        TArray64<uint8> Content;
+
+        if (!FMonoAssemblyPrefetcher::Take(AbsoluteAssemblyPath, Content) && !FFileHelper::LoadFileToArray(Content, *AbsoluteAssemblyPath))
         {
             US_LOG_ERROR(TEXT("Failed to read assembly from path '%s'."), *AbsoluteAssemblyPath);
             
             return {};
         }
 
-        const uint32 Size = Reader->TotalSize();
-        void* Data = FMemory::Malloc(Size);
+        if (Content.Num() > MAX_int32)
+        {
+            US_LOG_ERROR(TEXT("Assembly '%s' is too large."), *AbsoluteAssemblyPath);
 
-        US_SCOPED_EXIT(FMemory::Free(Data););
+            return {};
+        }
+
+        void* Data = Content.GetData();
+        const uint32 Size = (uint32)Content.Num();
 
-        Reader->Serialize(Data, Size);
+        const FString ImageName = GetImageName(AbsoluteAssemblyPath);
 
-        MonoImage* LoadedImage = mono_image_open_from_data_with_name((char*)Data, Size, true, &Status, false, TCHAR_TO_UTF8(*AsmName)); // NOLINT
+        MonoImage* LoadedImage = mono_image_open_from_data_with_name((char*)Data, Size, true, &Status, false, TCHAR_TO_UTF8(*ImageName)); // NOLINT
 
         if (!LoadedImage)
         {
@@ -591,7 +778,7 @@ namespace UnrealSharp::Mono
             return {};
         }
 
-        LoadedAssembly = mono_assembly_load_from_full(LoadedImage, TCHAR_TO_UTF8(*AsmName), &Status, 0);
+        LoadedAssembly = mono_assembly_load_from_full(LoadedImage, TCHAR_TO_UTF8(*ImageName), &Status, 0);
         if (!LoadedAssembly)
         {
             US_LOG_ERROR(TEXT("Failed to load image from path '%s'."), *AbsoluteAssemblyPath);
@@ -604,6 +791,139 @@ namespace UnrealSharp::Mono
         return { LoadedAssembly, mono_assembly_get_image(LoadedAssembly) };
     }
 
+    FMonoRuntime::FMonoAssemblyCache FMonoRuntime::StaticLoadMappedAssembly(const FString& InAssemblyPath, const FString& InAssemblyName)
+    {
+        const FMappedAssemblyFile* AssemblyFile = MapAssemblyFile(InAssemblyPath);
+
+        if (AssemblyFile == nullptr || AssemblyFile->GetSize() > MAX_int32)
+        {
+            UnmapAssemblyFile(AssemblyFile);
+            return {};
+        }
+
+        MonoImageOpenStatus Status;
+
+        // need_copy = false, mono will read the image from the mapping directly
+        MonoImage* LoadedImage = mono_image_open_from_data_with_name((char*)AssemblyFile->GetData(), (uint32)AssemblyFile->GetSize(), false, &Status, false, TCHAR_TO_UTF8(*InAssemblyName)); // NOLINT
+
+        if (!LoadedImage)
+        {
+            US_LOG_ERROR(TEXT("Failed to load image from mapped file '%s'."), *InAssemblyPath);
+
+            UnmapAssemblyFile(AssemblyFile);
+            return {};
+        }
+
+        // the image has no file for mono to find pdb by itself, so register the symbols before the assembly is loaded.
+        const FMappedAssemblyFile* PdbFile = nullptr;
+
+        if (bIsDebuggerAvailable)
+        {
+            const FString PdbPath = FPaths::ChangeExtension(InAssemblyPath, TEXT("pdb"));
+
+            PdbFile = FPaths::FileExists(PdbPath) ? MapAssemblyFile(PdbPath) : nullptr;
+
+            if (PdbFile != nullptr && PdbFile->GetSize() > MAX_int32)
+            {
+                UnmapAssemblyFile(PdbFile);
+                PdbFile = nullptr;
+            }
+
+            if (PdbFile != nullptr)
+            {
+                mono_debug_open_image_from_memory(LoadedImage, PdbFile->GetData(), (int)PdbFile->GetSize());
+            }
+        }
+
+        MonoAssembly* LoadedAssembly = mono_assembly_load_from_full(LoadedImage, TCHAR_TO_UTF8(*InAssemblyName), &Status, 0);
+
+        if (!LoadedAssembly)
+        {
+            US_LOG_ERROR(TEXT("Failed to load assembly from mapped file '%s'."), *InAssemblyPath);
+
+            // the image is not referenced by any assembly, so the mappings can be dropped after it is closed
+            if (bIsDebuggerAvailable)
+            {
+                mono_debug_close_image(LoadedImage);
+            }
+
+            mono_image_close(LoadedImage);
+            UnmapAssemblyFile(PdbFile);
+            UnmapAssemblyFile(AssemblyFile);
+            return {};
+        }
+
+        US_LOG(TEXT("Loaded assembly from mapped file '%s'."), *InAssemblyPath);
+
+        return { LoadedAssembly, mono_assembly_get_image(LoadedAssembly) };
+    }
+
+    FString FMonoRuntime::GetImageName(const FString& InAssemblyPath)
+    {
+        // AOT image is named as UnrealSharp.UnrealEngine.dll.so, mono finds it by image name + module extension
+        return AotImageDirectory.IsEmpty() ? FPaths::GetBaseFilename(InAssemblyPath) : FPaths::GetCleanFilename(InAssemblyPath);
+    }
+
+    void FMonoRuntime::ReportAotImage(const FString& InAssemblyPath)
+    {
+        if (AotImageDirectory.IsEmpty())
+        {
+            return;
+        }
+
+        const FString AotImagePath = FPaths::Combine(AotImageDirectory, FPaths::GetCleanFilename(InAssemblyPath) + TEXT(".") + FPlatformProcess::GetModuleExtension());
+
+        if (FPaths::FileExists(AotImagePath))
+        {
+            ++AotImageHitCount;
+
+            US_LOG(TEXT("Found mono AOT image '%s'."), *AotImagePath);
+        }
+        else
+        {
+            ++AotImageMissCount;
+
+            if (bIsFullAotMode)
+            {
+                US_LOG_ERROR(TEXT("Missing mono AOT image '%s', its methods can't be executed in full AOT mode."), *AotImagePath);
+            }
+            else
+            {
+                US_LOG_WARN(TEXT("Missing mono AOT image '%s', its methods will be compiled by JIT."), *AotImagePath);
+            }
+        }
+    }
+
+    const FMonoRuntime::FMappedAssemblyFile* FMonoRuntime::MapAssemblyFile(const FString& InFilePath)
+    {
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+        TUniquePtr<FMappedAssemblyFile> MappedFile = MakeUnique<FMappedAssemblyFile>();
+        MappedFile->Handle.Reset(PlatformFile.OpenMapped(*InFilePath));
+
+        if (!MappedFile->Handle || MappedFile->Handle->GetFileSize() <= 0)
+        {
+            return nullptr;
+        }
+
+        MappedFile->Region.Reset(MappedFile->Handle->MapRegion(0, MappedFile->Handle->GetFileSize()));
+
+        if (!MappedFile->Region)
+        {
+            return nullptr;
+        }
+
+        return MappedAssemblyFiles.Add_GetRef(MoveTemp(MappedFile)).Get();
+    }
+
+    void FMonoRuntime::UnmapAssemblyFile(const FMappedAssemblyFile* InFile)
+    {
+        if (InFile != nullptr)
+        {
+            MappedAssemblyFiles.RemoveAll([InFile](const TUniquePtr<FMappedAssemblyFile>& MappedFile) { return MappedFile.Get() == InFile; });
+        }
+    }
+
     FMonoRuntime::FMonoAssemblyCache FMonoRuntime::LoadAssembly(const FString& InAssemblyName)
     {
         const FString* AssemblyNamePtr = &InAssemblyName;
@@ -624,7 +944,7 @@ namespace UnrealSharp::Mono
 
         const FString TargetPath = SearchLibrary(*AssemblyNamePtr);
 
-        if (!FPaths::FileExists(*TargetPath))
+        if (TargetPath.IsEmpty())
         {
             US_LOG_ERROR(TEXT("Failed find assembly:%s"), **AssemblyNamePtr);
             return FMonoAssemblyCache();
@@ -632,6 +952,11 @@ namespace UnrealSharp::Mono
 
         const auto Cache = StaticLoadAssembly(TargetPath);
 
+        if (Cache.IsValid())
+        {
+            ReportAotImage(TargetPath);
+        }
+
         AssemblyCaches.Add(*AssemblyNamePtr, Cache);
 
         return Cache;
@@ -726,7 +1051,7 @@ namespace UnrealSharp::Mono
         }
         else
         {
-            LogException(Exception);
+            LogException(Exception, InMethod);
 
             return nullptr;
         }
@@ -750,7 +1075,7 @@ namespace UnrealSharp::Mono
         }
         else
         {
-            LogException(Exception);
+            LogException(Exception, mono_object_get_class(InDelegate));
 
             return nullptr;
         }
@@ -765,6 +1090,8 @@ namespace UnrealSharp::Mono
             return TSharedPtr<ICSharpMethod>();
         }
 
+        FCSharpStartupProfile::Record(FCSharpStartupProfile::EEntryKind::Method, InAssemblyName, InFullyQualifiedMethodName);
+
         TSharedPtr<FMonoMethod> MethodPtr = MakeShared<FMonoMethod>(Method);
 
         return MethodPtr;
@@ -782,6 +1109,11 @@ namespace UnrealSharp::Mono
             return TSharedPtr<ICSharpMethod>();
         }
 
+        if (FCSharpStartupProfile::IsRecording())
+        {
+            FCSharpStartupProfile::Record(FCSharpStartupProfile::EEntryKind::Method, UTF8_TO_TCHAR(mono_image_get_name(mono_class_get_image(((FMonoType*)InType)->GetClass()))), InFullyQualifiedMethodName); // NOLINT
+        }
+
         TSharedPtr<FMonoMethod> MethodPtr = MakeShared<FMonoMethod>(Method);
 
         return MethodPtr;
@@ -803,6 +1135,8 @@ namespace UnrealSharp::Mono
             return TSharedPtr<ICSharpType>();
         }
 
+        FCSharpStartupProfile::Record(FCSharpStartupProfile::EEntryKind::Type, InAssemblyName, InNamespace.IsEmpty() ? InName : InNamespace + TEXT(".") + InName);
+
         TSharedPtr<FMonoType> TypePtr = MakeShared<FMonoType>(Class);
 
         return TypePtr;
@@ -842,8 +1176,23 @@ namespace UnrealSharp::Mono
         return Result;
     }
 
+    bool FMonoRuntime::IsAssemblyChanged() const
+    {
+        for (const auto& Pair : LoadedAssemblyTimeStamps)
+        {
+            if (IFileManager::Get().GetTimeStamp(*Pair.Key) != Pair.Value)
+            {
+                US_LOG(TEXT("Assembly %s is changed after it is loaded."), *Pair.Key);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     void FMonoRuntime::ExecuteGarbageCollect(bool bFully)
     {
+        // measured by OnGCEvent like automatic collections
         if (bFully)
         {
             mono_gc_collect(mono_gc_max_generation());
@@ -29,12 +29,15 @@
 
 #if WITH_MONO
 #include "MonoRuntime/Mono.h"
+#include "MonoRuntime/MonoAssemblyIndex.h"
+#include "Async/MappedFileHandle.h"
 
 namespace UnrealSharp::Mono
 {
     class FMonoProfilerService;
     class FMonoObjectTable;
     class FPropertyMarshallerCollection;
+    class FMonoJitPrewarmer;
 
     class FMonoRuntime : public FCSharpRuntimeBase, public FRefCountBase
     {
@@ -46,6 +49,13 @@ namespace UnrealSharp::Mono
         virtual void                                    ShutdownInternal() override;
         virtual const FName&                            GetRuntimeType() const override;
 
+    protected:
+        virtual bool                                    CanReload() const override;
+        virtual bool                                    ReloadInternal() override;
+        virtual void                                    PrewarmAsync(TArray<FCSharpStartupProfile::FEntry>&& InEntries) override;
+
+    public:
+
         virtual TSharedPtr<ICSharpMethod>               LookupMethod(const FString& InAssemblyName, const FString& InFullyQualifiedMethodName) override;        
         virtual TSharedPtr<ICSharpMethod>               LookupMethod(ICSharpType* InType, const FString& InFullyQualifiedMethodName) override;
 
@@ -58,6 +68,7 @@ namespace UnrealSharp::Mono
         virtual TSharedPtr<ICSharpGCHandle>             CreateCSharpGCHandle(void* InCSharpObject, bool bInWeakReference) override;
         virtual void                                    ExecuteGarbageCollect(bool bFully) override;
         virtual TSharedPtr<ICSharpLibraryAccessor>      CreateCSharpLibraryAccessor() override; 
+        virtual bool                                    IsAssemblyChanged() const override;
 
     public:
         virtual uint32                                  AddRef() const override{ return FRefCountBase::AddRef(); }  // NOLINT
@@ -73,13 +84,15 @@ namespace UnrealSharp::Mono
         MonoMethod*                                     LoadMethod(MonoClass* InClass, const char* InFullyQualifiedMethodName);
         MonoMethod*                                     LoadMethod(const TCHAR* AssemblyName, const char* InFullyQualifiedMethodName);
                 
-        void                                            LogException(MonoObject* InException);
+        void                                            LogException(MonoObject* InException, const void* InSite = nullptr);
 
         static void                                     MonoStringToFString(FString& Result, MonoString* InString);
         static FName                                    MonoStringToFName(MonoString* InString);
         static void                                     SendErrorToMessageLog(FText InError);
     private:
+        void                                            LoadCoreClrLibrary();
         void                                            InitDebugger();
+        void                                            InitAot();
         bool                                            InitDomain();
         void                                            InitLogger();                    
 
@@ -87,6 +100,8 @@ namespace UnrealSharp::Mono
         static void                                     InitLibrarySearchPaths();
         static void                                     MonoLog(const char* InDomainName, const char* InLogLevel, const char* InMessage, mono_bool InFatal, void* InUserData);
         static void                                     MonoPrintf(const char* InString, mono_bool bIsStdout); // NOLINT
+        // ::MonoProfiler, the member MonoProfiler hides the type name
+        static void                                     OnGCEvent(::MonoProfiler* InProfiler, MonoProfilerGCEvent InEvent, uint32_t InGeneration, mono_bool bIsSerial);
 
         struct FMonoAssemblyCache
         {
@@ -96,9 +111,24 @@ namespace UnrealSharp::Mono
             bool IsValid() const { return Assembly != nullptr && Image != nullptr; }
         };
 
+        // a read only file mapping, mono reads the image from it directly so it must live as long as the image
+        struct FMappedAssemblyFile
+        {
+            TUniquePtr<IMappedFileHandle> Handle;
+            TUniquePtr<IMappedFileRegion> Region;
+
+            const uint8* GetData() const { return Region->GetMappedPtr(); }
+            int64 GetSize() const { return Region->GetMappedSize(); }
+        };
+
         static MonoAssembly*                            OnAssemblyLoaded(MonoAssemblyName* InAssemblyName, char** InAssemblies, void* InUserData);
-        static FString                                  SearchLibrary(const FString& InName);
+        static FString                                  SearchLibrary(const FString& InName, const FString& InCulture = FString());
         static FMonoAssemblyCache                       StaticLoadAssembly(const FString& InAssemblyPath);
+        static FMonoAssemblyCache                       StaticLoadMappedAssembly(const FString& InAssemblyPath, const FString& InAssemblyName);
+        static FString                                  GetImageName(const FString& InAssemblyPath);
+        static void                                     ReportAotImage(const FString& InAssemblyPath);
+        static const FMappedAssemblyFile*               MapAssemblyFile(const FString& InFilePath);
+        static void                                     UnmapAssemblyFile(const FMappedAssemblyFile* InFile);
 
         FMonoAssemblyCache                              LoadAssembly(const FString& InAssemblyName);
 
@@ -109,9 +139,18 @@ namespace UnrealSharp::Mono
         
         TUniquePtr<FPropertyMarshallerCollection>       MarshallerCollectionPtr;
         TUniquePtr<FMonoProfilerService>                MonoProfiler;
+        TUniquePtr<FMonoJitPrewarmer>                   JitPrewarmer;
 
         bool                                            bUseTempCoreClrLibrary = false;
+        FString                                         CoreClrShadowCopyPath;
         static bool                                     bIsDebuggerAvailable;    
+        static bool                                     bUseMappedAssemblies;
+        static FString                                  AotImageDirectory;
+        static int32                                    AotImageHitCount;
+        static int32                                    AotImageMissCount;
+        static bool                                     bIsFullAotMode;
+        static TArray<TUniquePtr<FMappedAssemblyFile>>  MappedAssemblyFiles;
+        static TMap<FString, FDateTime>                 LoadedAssemblyTimeStamps;
         
 #if PLATFORM_MAC
         TArray<void*>                                   ExtraLibraryHandles;
@@ -120,6 +159,7 @@ namespace UnrealSharp::Mono
         static FString                                  NativeLibraryPath;
         static FString                                  ManagedLibraryPath;
         static TArray<FString>                          LibrarySearchPaths;
+        static FMonoAssemblyIndex                       AssemblyIndex;
     };
 }
 #endif
@@ -0,0 +1,419 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "MonoRuntime/MonoShadowCopyCache.h"
+
+#if WITH_MONO && (PLATFORM_MAC || PLATFORM_WINDOWS || PLATFORM_LINUX)
+#include "Misc/UnrealSharpLog.h"
+#include "Misc/UnrealSharpPaths.h"
+#include "Misc/SecureHash.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include "Windows/WindowsHWrapper.h"
+#include "Windows/HideWindowsPlatformTypes.h"
+#else
+#include <unistd.h>
+#include <dlfcn.h>
+#endif
+
+namespace UnrealSharp::Mono
+{
+    FCriticalSection FMonoShadowCopyCache::CriticalSection;
+    TMap<FString, FMonoShadowCopyCache::FSourceHash> FMonoShadowCopyCache::SourceHashes;
+    TSet<FString> FMonoShadowCopyCache::AcquiredEntries;
+    bool FMonoShadowCopyCache::bIsInitialized = false;
+    bool FMonoShadowCopyCache::bIsManifestDirty = false;
+
+    // records size and timestamp of files in the entry, its own timestamp is the last used time of the entry
+    static const TCHAR* EntryFileName = TEXT(".entry");
+    static const TCHAR* ManifestFileName = TEXT("Manifest.txt");
+    static const TCHAR* TempDirectorySuffix = TEXT(".tmp");
+
+    // an entry locked by another process can't be replaced, try next instance
+    static constexpr int MaxEntryInstanceCount = 16;
+
+    void FMonoShadowCopyCache::Initialize(int InMaxAgeDays)
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        if (bIsInitialized)
+        {
+            return;
+        }
+
+        bIsInitialized = true;
+
+        IFileManager::Get().MakeDirectory(*GetCacheDirectory(), true);
+
+        LoadManifest();
+
+        if (InMaxAgeDays > 0)
+        {
+            CollectGarbage(InMaxAgeDays);
+        }
+    }
+
+    FString FMonoShadowCopyCache::GetCacheDirectory()
+    {
+        return FPaths::Combine(FUnrealSharpPaths::GetUnrealSharpIntermediateDir(), TEXT("ShadowCopies"));
+    }
+
+    FString FMonoShadowCopyCache::Acquire(const FString& InEntryName, const TArray<FString>& InSourceFiles, const FOptions& InOptions)
+    {
+        check(!InSourceFiles.IsEmpty());
+
+        FScopeLock Lock(&CriticalSection);
+
+        TArray<FString> SourceFiles;
+        FMD5 KeyHash;
+
+        for (int i = 0; i < InSourceFiles.Num(); ++i)
+        {
+            FString Hash = GetFileHash(InSourceFiles[i]);
+
+            if (Hash.IsEmpty())
+            {
+                checkf(i > 0, TEXT("Failed hash file %s"), *InSourceFiles[i]);
+                continue;
+            }
+
+            FTCHARToUTF8 Converter(*(FPaths::GetCleanFilename(InSourceFiles[i]) + Hash));
+            KeyHash.Update((const uint8*)Converter.Get(), Converter.Length()); // NOLINT
+
+            SourceFiles.Add(InSourceFiles[i]);
+        }
+
+        if (bIsManifestDirty)
+        {
+            SaveManifest();
+        }
+
+        FMD5Hash Key;
+        Key.Set(KeyHash);
+
+        const FString BaseDirectory = FPaths::Combine(GetCacheDirectory(), InEntryName + TEXT(".") + LexToString(Key).Left(16));
+
+        for (int Instance = 0; Instance < MaxEntryInstanceCount; ++Instance)
+        {
+            const FString EntryDirectory = Instance == 0 ? BaseDirectory : FString::Printf(TEXT("%s.%d"), *BaseDirectory, Instance);
+
+            // the loader returns the instance already loaded from the same path, even if its runtime was shut down
+            if (InOptions.bExclusive && (AcquiredEntries.Contains(EntryDirectory) || IsLibraryLoaded(FPaths::Combine(EntryDirectory, FPaths::GetCleanFilename(SourceFiles[0])))))
+            {
+                continue;
+            }
+
+            if (IsEntryValid(EntryDirectory))
+            {
+                TouchEntry(EntryDirectory);
+            }
+            else if (!CreateEntry(EntryDirectory, SourceFiles, InOptions.bAllowHardLink))
+            {
+                continue;
+            }
+
+            AcquiredEntries.Add(EntryDirectory);
+
+            return FPaths::Combine(EntryDirectory, FPaths::GetCleanFilename(SourceFiles[0]));
+        }
+
+        if (InOptions.bExclusive)
+        {
+            if (FString UniquePath = CreateUniqueCopy(InEntryName, SourceFiles[0]); !UniquePath.IsEmpty())
+            {
+                US_LOG_WARN(TEXT("All shadow copies of %s are in use, load it from %s."), *SourceFiles[0], *UniquePath);
+
+                return UniquePath;
+            }
+        }
+
+        US_LOG_ERROR(TEXT("Failed create shadow copy for %s, load it directly."), *SourceFiles[0]);
+
+        return SourceFiles[0];
+    }
+
+    void FMonoShadowCopyCache::Release(const FString& InPath)
+    {
+        FScopeLock Lock(&CriticalSection);
+
+        AcquiredEntries.Remove(FPaths::GetPath(InPath));
+    }
+
+    FString FMonoShadowCopyCache::CreateUniqueCopy(const FString& InEntryName, const FString& InSourceFile)
+    {
+        // never reused, deleted as an unfinished entry by next garbage collection
+        const FString Directory = FPaths::Combine(GetCacheDirectory(), InEntryName + TEXT(".") + FGuid::NewGuid().ToString() + TempDirectorySuffix);
+        const FString Destination = FPaths::Combine(Directory, FPaths::GetCleanFilename(InSourceFile));
+
+        if (!IFileManager::Get().MakeDirectory(*Directory, true) || !LinkOrCopyFile(Destination, InSourceFile, false))
+        {
+            IFileManager::Get().DeleteDirectory(*Directory, false, true);
+            return FString();
+        }
+
+        return Destination;
+    }
+
+    bool FMonoShadowCopyCache::IsLibraryLoaded(const FString& InPath)
+    {
+        const FString FullPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*InPath);
+
+#if PLATFORM_WINDOWS
+        return ::GetModuleHandleW(*FullPath.Replace(TEXT("/"), TEXT("\\"))) != nullptr;
+#else
+        // RTLD_NOLOAD only returns a handle of a library already loaded
+        void* Handle = ::dlopen(TCHAR_TO_UTF8(*FullPath), RTLD_LAZY | RTLD_NOLOAD);
+
+        if (Handle != nullptr)
+        {
+            ::dlclose(Handle);
+        }
+
+        return Handle != nullptr;
+#endif
+    }
+
+    FString FMonoShadowCopyCache::GetFileHash(const FString& InPath)
+    {
+        const FFileStatData StatData = IFileManager::Get().GetStatData(*InPath);
+
+        if (!StatData.bIsValid || StatData.bIsDirectory)
+        {
+            return FString();
+        }
+
+        if (const FSourceHash* Cached = SourceHashes.Find(InPath); Cached != nullptr && Cached->Size == StatData.FileSize && Cached->TimeStamp == StatData.ModificationTime)
+        {
+            return Cached->Hash;
+        }
+
+        const FMD5Hash Hash = FMD5Hash::HashFile(*InPath);
+
+        if (!Hash.IsValid())
+        {
+            return FString();
+        }
+
+        SourceHashes.Add(InPath, { StatData.FileSize, StatData.ModificationTime, LexToString(Hash) });
+        bIsManifestDirty = true;
+
+        return LexToString(Hash);
+    }
+
+    bool FMonoShadowCopyCache::IsEntryValid(const FString& InEntryDirectory)
+    {
+        TArray<FString> Lines;
+        if (!FFileHelper::LoadFileToStringArray(Lines, *FPaths::Combine(InEntryDirectory, EntryFileName)) || Lines.IsEmpty())
+        {
+            return false;
+        }
+
+        // a hard linked file is changed with its source, and a copy may be changed by someone else
+        for (const FString& Line : Lines)
+        {
+            TArray<FString> Fields;
+            if (Line.ParseIntoArray(Fields, TEXT("\t")) != 3)
+            {
+                return false;
+            }
+
+            const FFileStatData StatData = IFileManager::Get().GetStatData(*FPaths::Combine(InEntryDirectory, Fields[0]));
+
+            if (!StatData.bIsValid || StatData.FileSize != FCString::Atoi64(*Fields[1]) || StatData.ModificationTime.GetTicks() != FCString::Atoi64(*Fields[2]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool FMonoShadowCopyCache::CreateEntry(const FString& InEntryDirectory, const TArray<FString>& InSourceFiles, bool bAllowHardLink)
+    {
+        IFileManager& FileManager = IFileManager::Get();
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+        // build it in a temp directory, so other processes never see a partial entry
+        const FString TempDirectory = InEntryDirectory + TEXT(".") + FGuid::NewGuid().ToString() + TempDirectorySuffix;
+
+        if (!FileManager.MakeDirectory(*TempDirectory, true))
+        {
+            return false;
+        }
+
+        TArray<FString> Lines;
+
+        for (const FString& SourceFile : InSourceFiles)
+        {
+            const FString FileName = FPaths::GetCleanFilename(SourceFile);
+            const FString Destination = FPaths::Combine(TempDirectory, FileName);
+
+            if (!LinkOrCopyFile(Destination, SourceFile, bAllowHardLink))
+            {
+                US_LOG_WARN(TEXT("Failed copy %s to %s."), *SourceFile, *Destination);
+                FileManager.DeleteDirectory(*TempDirectory, false, true);
+                return false;
+            }
+
+            const FFileStatData StatData = FileManager.GetStatData(*Destination);
+            Lines.Add(FString::Printf(TEXT("%s\t%lld\t%lld"), *FileName, StatData.FileSize, StatData.ModificationTime.GetTicks()));
+        }
+
+        FFileHelper::SaveStringArrayToFile(Lines, *FPaths::Combine(TempDirectory, EntryFileName));
+
+        // replace the invalid one, fails if it is used by another process
+        if (FileManager.DirectoryExists(*InEntryDirectory))
+        {
+            FileManager.DeleteDirectory(*InEntryDirectory, false, true);
+        }
+
+        if (!PlatformFile.MoveFile(*InEntryDirectory, *TempDirectory))
+        {
+            FileManager.DeleteDirectory(*TempDirectory, false, true);
+
+            // created by another process at the same time
+            return IsEntryValid(InEntryDirectory);
+        }
+
+        US_LOG(TEXT("Created shadow copy %s."), *InEntryDirectory);
+
+        return true;
+    }
+
+    bool FMonoShadowCopyCache::LinkOrCopyFile(const FString& InDestination, const FString& InSource, bool bAllowHardLink)
+    {
+        if (bAllowHardLink)
+        {
+            const FString Destination = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*InDestination);
+            const FString Source = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*InSource);
+
+#if PLATFORM_WINDOWS
+            if (::CreateHardLinkW(*Destination, *Source, nullptr))
+            {
+                return true;
+            }
+#else
+            if (::link(TCHAR_TO_UTF8(*Source), TCHAR_TO_UTF8(*Destination)) == 0)
+            {
+                return true;
+            }
+#endif
+            // different volumes or not supported by the file system
+        }
+
+        return FPlatformFileManager::Get().GetPlatformFile().CopyFile(*InDestination, *InSource);
+    }
+
+    void FMonoShadowCopyCache::TouchEntry(const FString& InEntryDirectory)
+    {
+        IFileManager::Get().SetTimeStamp(*FPaths::Combine(InEntryDirectory, EntryFileName), FDateTime::UtcNow());
+    }
+
+    void FMonoShadowCopyCache::CollectGarbage(int InMaxAgeDays)
+    {
+        IFileManager& FileManager = IFileManager::Get();
+
+        const FString CacheDirectory = GetCacheDirectory();
+        const FDateTime ExpireTime = FDateTime::UtcNow() - FTimespan::FromDays(InMaxAgeDays);
+
+        TArray<FString> Directories;
+        FileManager.FindFiles(Directories, *FPaths::Combine(CacheDirectory, TEXT("*")), false, true);
+
+        int DeletedCount = 0;
+
+        for (const FString& Directory : Directories)
+        {
+            const FString EntryDirectory = FPaths::Combine(CacheDirectory, Directory);
+            const FDateTime LastUsedTime = FileManager.GetTimeStamp(*FPaths::Combine(EntryDirectory, EntryFileName));
+
+            // entries in use by other processes can't be deleted on windows, just skip them
+            if ((LastUsedTime == FDateTime::MinValue() || LastUsedTime < ExpireTime || Directory.EndsWith(TempDirectorySuffix)) &&
+                FileManager.DeleteDirectory(*EntryDirectory, false, true))
+            {
+                ++DeletedCount;
+            }
+        }
+
+        // forget sources deleted
+        const int SourceCount = SourceHashes.Num();
+
+        for (auto It = SourceHashes.CreateIterator(); It; ++It)
+        {
+            if (!FileManager.FileExists(*It.Key()))
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        if (SourceHashes.Num() != SourceCount)
+        {
+            SaveManifest();
+        }
+
+        if (DeletedCount > 0)
+        {
+            US_LOG(TEXT("Deleted %d shadow copies not used in %d days."), DeletedCount, InMaxAgeDays);
+        }
+    }
+
+    void FMonoShadowCopyCache::LoadManifest()
+    {
+        SourceHashes.Empty();
+
+        TArray<FString> Lines;
+        FFileHelper::LoadFileToStringArray(Lines, *FPaths::Combine(GetCacheDirectory(), ManifestFileName));
+
+        // Path Size TimeStamp Hash
+        for (const FString& Line : Lines)
+        {
+            if (TArray<FString> Fields; Line.ParseIntoArray(Fields, TEXT("\t")) == 4)
+            {
+                SourceHashes.Add(Fields[0], { FCString::Atoi64(*Fields[1]), FDateTime(FCString::Atoi64(*Fields[2])), Fields[3] });
+            }
+        }
+
+        bIsManifestDirty = false;
+    }
+
+    void FMonoShadowCopyCache::SaveManifest()
+    {
+        TArray<FString> Lines;
+        Lines.Reserve(SourceHashes.Num());
+
+        for (const auto& [Path, SourceHash] : SourceHashes)
+        {
+            Lines.Add(FString::Printf(TEXT("%s\t%lld\t%lld\t%s"), *Path, SourceHash.Size, SourceHash.TimeStamp.GetTicks(), *SourceHash.Hash));
+        }
+
+        FFileHelper::SaveStringArrayToFile(Lines, *FPaths::Combine(GetCacheDirectory(), ManifestFileName));
+
+        bIsManifestDirty = false;
+    }
+}
+#endif
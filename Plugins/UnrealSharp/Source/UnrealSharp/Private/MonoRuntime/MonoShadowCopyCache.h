@@ -0,0 +1,91 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#if WITH_MONO && (PLATFORM_MAC || PLATFORM_WINDOWS || PLATFORM_LINUX)
+namespace UnrealSharp::Mono
+{
+    /*
+    * Content addressed cache of shadow copies on desktop platforms.
+    * coreclr library in editor and assemblies loaded for debugger are not loaded from their original paths, 
+    * otherwise the library can't be initialized again and assemblies can't be rebuilt while the game is running.
+    * Files of an entry are stored with their original names in a directory named by the hash of their contents, 
+    * so an assembly and its pdb stay side by side, and unchanged files are reused by next editor start instead of being copied again.
+    * Content hashes are cached by file size + timestamp, an entry is verified by size + timestamp of its files before reused.
+    */
+    class FMonoShadowCopyCache
+    {
+    public:
+        struct FOptions
+        {
+            // the entry is never returned twice in this process, coreclr must be a different file to be loaded as a new library instance
+            bool                bExclusive = false;
+
+            // use hard links instead of copies when the file system supports it
+            bool                bAllowHardLink = false;
+        };
+
+        // load hash manifest and delete entries not used in InMaxAgeDays once per process, entries are never deleted if InMaxAgeDays <= 0
+        static void             Initialize(int InMaxAgeDays);
+
+        // return path of the cached copy of InSourceFiles[0], or InSourceFiles[0] itself if the entry can't be created
+        // missing files except the first one are ignored, eg: pdb
+        // exclusive entries fall back to a unique temp copy when all instances are in use
+        static FString          Acquire(const FString& InEntryName, const TArray<FString>& InSourceFiles, const FOptions& InOptions);
+
+        // called when the owner of a path returned by Acquire shuts down, the entry is reused once its library is unloaded
+        static void             Release(const FString& InPath);
+
+        static FString          GetCacheDirectory();
+
+    private:
+        struct FSourceHash
+        {
+            int64               Size = 0;
+            FDateTime           TimeStamp;
+            FString             Hash;
+        };
+
+        static FString          GetFileHash(const FString& InPath);
+        static bool             IsEntryValid(const FString& InEntryDirectory);
+        static bool             CreateEntry(const FString& InEntryDirectory, const TArray<FString>& InSourceFiles, bool bAllowHardLink);
+        static bool             LinkOrCopyFile(const FString& InDestination, const FString& InSource, bool bAllowHardLink);
+        static FString          CreateUniqueCopy(const FString& InEntryName, const FString& InSourceFile);
+        static bool             IsLibraryLoaded(const FString& InPath);
+        static void             TouchEntry(const FString& InEntryDirectory);
+        static void             CollectGarbage(int InMaxAgeDays);
+        static void             LoadManifest();
+        static void             SaveManifest();
+
+    private:
+        static FCriticalSection                 CriticalSection;
+        static TMap<FString, FSourceHash>       SourceHashes;
+        static TSet<FString>                    AcquiredEntries;
+        static bool                             bIsInitialized;
+        static bool                             bIsManifestDirty;
+    };
+}
+#endif
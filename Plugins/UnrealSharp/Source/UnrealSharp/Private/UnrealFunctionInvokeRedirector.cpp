@@ -32,6 +32,8 @@
 #include "ICSharpObjectTable.h"
 #include "Misc/StackMemory.h"
 #include "Misc/ScopedCSharpMethodInvocation.h"
+#include "Misc/UnrealSharpTrace.h"
+#include "Misc/UnrealSharpStats.h"
 
 namespace UnrealSharp
 {
@@ -256,6 +258,12 @@ namespace UnrealSharp
     {
         check(Invocation);
 
+        US_INTEROP_SCOPE(STAT_UnrealSharp_CallCSharp);
+        INC_DWORD_STAT(STAT_UnrealSharp_CallCSharpCount);
+        const FInteropFunctionTraceScope FunctionTraceScope(Function, TraceEventId, TraceCallCount);
+
+        US_TRACE_EVENT(VeryVerbose, UnrealFunctionRedirect, Function, Context);
+
         US_SCOPED_CSHARP_METHOD_INVOCATION(Invocation);
 
         // We need to copy the unreal data separately, because the order of function parameters in C# and the order in the UFunction stack may be different.
@@ -278,15 +286,19 @@ namespace UnrealSharp
         const FStackMemory TempParameterMemory = { TempParameterPointers, TempParameterSize };
         const FStackMemory UnrealParameterReferenceMemory = { UnrealParameterReferencePointers, ParameterSize };
 
-        Linker.BeginInvoke(
-            Invocation.Get(), 
-            ParameterMemory,
-            TempParameterMemory,
-            UnrealParameterReferenceMemory,
-            Context, 
-            Stack, 
-            RESULT_PARAM
-        );
+        {
+            US_INTEROP_SCOPE(STAT_UnrealSharp_MarshalToCSharp);
+
+            Linker.BeginInvoke(
+                Invocation.Get(), 
+                ParameterMemory,
+                TempParameterMemory,
+                UnrealParameterReferenceMemory,
+                Context, 
+                Stack, 
+                RESULT_PARAM
+            );
+        }
 
         US_SCOPED_EXIT(Linker.FinishInvoke(ParameterMemory));
         
@@ -128,6 +128,10 @@ namespace UnrealSharp
         const FCSharpFunctionData*                                           FunctionData;
         TSharedPtr<ICSharpMethodInvocation>                                  Invocation;                
         FUnrealFunctionMarshallerLinker                                      Linker;
+
+        // Unreal Insights event of this function, see FInteropFunctionTraceScope
+        uint32                                                               TraceEventId = 0;
+        uint32                                                               TraceCallCount = 0;
     };
 }
 
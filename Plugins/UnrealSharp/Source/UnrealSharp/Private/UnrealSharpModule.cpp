@@ -24,16 +24,40 @@
     Project URL: https://github.com/bodong1987/UnrealSharp
 */
 #include "UnrealSharpModule.h"
+#include "Misc/UnrealFieldResolver.h"
+#include "ICSharpRuntime.h"
+#include "Classes/UnrealSharpSettings.h"
+#include "Misc/UnrealSharpPaths.h"
+#include "MonoRuntime/MonoAssemblyPrefetcher.h"
 
 IMPLEMENT_MODULE(FUnrealSharpModule, UnrealSharp);
 
 void FUnrealSharpModule::StartupModule()
 {    
+    UnrealSharp::FUnrealFieldResolver::Get().Startup();
+
+#if WITH_MONO && !WITH_EDITOR
+    if (const UUnrealSharpSettings* Settings = GetDefault<UUnrealSharpSettings>(); Settings->bPrefetchAssemblies)
+    {
+        // mapped assemblies are only read to warm file cache
+        UnrealSharp::Mono::FMonoAssemblyPrefetcher::Start(UnrealSharp::FUnrealSharpPaths::GetUnrealSharpManagedLibraryDir(), !Settings->bUseMemoryMappedAssemblies);
+    }
+#endif
+
+    // a runtime kept alive between PIE sessions is not referenced by any game instance
+    EnginePreExitHandle = FCoreDelegates::OnEnginePreExit.AddStatic(&UnrealSharp::FCSharpRuntimeFactory::ShutdownKeptAliveCSharpRuntime);
 }
 
 void FUnrealSharpModule::ShutdownModule()
 {
-    
+    FCoreDelegates::OnEnginePreExit.Remove(EnginePreExitHandle);
+    UnrealSharp::FCSharpRuntimeFactory::ShutdownKeptAliveCSharpRuntime();
+
+#if WITH_MONO
+    UnrealSharp::Mono::FMonoAssemblyPrefetcher::Reset();
+#endif
+
+    UnrealSharp::FUnrealFieldResolver::Get().Shutdown();
 }
 
 UnrealSharp::FUnrealInteropFunctions* FUnrealSharpModule::GetInteropFunctions()
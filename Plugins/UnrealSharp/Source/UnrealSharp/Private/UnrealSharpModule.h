@@ -38,5 +38,6 @@ public:
 
 private:
     UnrealSharp::FUnrealInteropFunctions  InteropFunctions;
+    FDelegateHandle                       EnginePreExitHandle;
 };
 
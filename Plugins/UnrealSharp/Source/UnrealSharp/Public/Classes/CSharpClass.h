@@ -152,6 +152,9 @@ public:
     // find C# function
     const FCSharpFunctionData*              FindCSharpFunction(const FName& InName) const;
 
+    // get all C# functions
+    const TMap<FName, FCSharpFunctionData>& GetCSharpFunctions() const { return CSharpFunctions; }
+
     // redirect all C# UFunction to C# runtime 
     void                                    RedirectAllCSharpFunctions();
 
@@ -161,9 +164,13 @@ public:
     // get redirection data cache for UFunction*
     FCSharpFunctionRedirectionData*         GetCSharpFunctionRedirection(const UFunction* InFunction);
 
+    // create invoke redirector of a redirected function before it is called, return false if it is not redirected
+    bool                                    BindCSharpFunction(const UFunction* InFunction);
+
 private:
     // call C# method
     static void                             CallCSharpFunction(UObject* Context, FFrame& TheStack, RESULT_DECL);
+    void                                    CreateCSharpFunctionInvoker(FCSharpFunctionRedirectionData& InData);
     static void                             StaticConstructor(const FObjectInitializer& ObjectInitializer);
     static void                             StaticClassConstructor(UCSharpClass* InCSharpClass, const FObjectInitializer& ObjectInitializer);
 
@@ -29,6 +29,35 @@
 #include "Engine/DeveloperSettings.h"
 #include "UnrealSharpSettings.generated.h"
 
+/*
+* How mono uses the AOT images generated by UnrealSharpTool(-m aot)
+*/
+UENUM()
+enum class EUnrealSharpMonoAotMode : uint8
+{
+    // JIT all methods
+    Disabled,
+
+    // use AOT images if they are found, other methods are compiled by JIT
+    Normal,
+
+    // use AOT images only, methods which are not AOT compiled can't be executed
+    Full
+};
+
+UENUM()
+enum class EUnrealSharpJitPrewarmMode : uint8
+{
+    // methods are compiled when they are called first time
+    Disabled,
+
+    // compile all C# methods of UFUNCTION in background
+    UFunctions,
+
+    // bind and compile what is recorded in Managed/<Configuration>/UnrealSharp.StartupProfile.txt, see bRecordStartupProfile
+    Profile
+};
+
 /**
  * About the configuration of Unreal Sharp. 
  * For export configuration, please refer to USharpBindingGenSettings
@@ -100,6 +129,84 @@ public:
     UPROPERTY(EditAnywhere, config, Category = "Debugger|Mono")
     int MonoLogLevel = 10;        
 
+    /*
+    * Map UnrealSharp assemblies into memory read-only and let mono use the mapping directly, no private copy is made. 
+    * The mapped pages can be shared by all processes that load the same files, this saves memory when running many servers on one machine. 
+    * It is ignored in the editor, because assemblies must stay unlocked so that they can be rebuilt.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime|Mono")
+    bool bUseMemoryMappedAssemblies = true;
+
+    /*
+    * Load mono AOT images from $(UnrealProjectDirectory)Managed/$(Configuration)/AOT, 
+    * they can be generated by UnrealSharpTool with -m aot after C# codes are compiled. 
+    * It is ignored when the debugger is available, because debugging requires interpreter mode.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime|Mono")
+    EUnrealSharpMonoAotMode MonoAotMode = EUnrealSharpMonoAotMode::Disabled;
+
+    /*
+    * Only the first C# exception of the same type, call site and message is logged with its stack trace, 
+    * repeated ones are counted and summarized at most once in this interval(seconds).
+    * Use UnrealSharp.DumpExceptionStatistics to print the counters.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime|Mono")
+    float ExceptionReportInterval = 10.0f;
+
+    /*
+    * coreclr library in editor and assemblies loaded for debugger are shadow copied into Intermediate/UnrealSharp/ShadowCopies, 
+    * unchanged files are reused by next start. Copies not used in these days are deleted at startup, 0 means never.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime|Mono")
+    int ShadowCopyMaxAgeDays = 7;
+
+    /*
+    * Shadow copy assemblies loaded for debugger with hard links instead of copies when the file system supports it.
+    * A link shares content with its source, enable it only if your build replaces output files instead of writing them in place, 
+    * otherwise the build may fail with a sharing violation while the assembly is loaded.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime|Mono")
+    bool bUseHardLinkShadowCopies = false;
+
+    /*
+    * Keep the C# runtime alive when a PIE session ends, the next session reuses the initialized runtime, loaded assemblies and JIT codes. 
+    * Proxy objects of the ended session are disconnected, but static states of C# codes are kept. 
+    * The runtime is restarted if any UnrealSharp assembly is rebuilt.
+    * Only used in editor.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime")
+    bool bKeepRuntimeAliveBetweenPIESessions = false;
+
+    /*
+    * Read UnrealSharp assemblies on worker threads when the module is started, the engine keeps loading until the runtime is created.
+    * Only used in game.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime|Mono")
+    bool bPrefetchAssemblies = true;
+
+    /*
+    * After C# main is invoked, compile C# methods on a background thread, so the first calls of them don't pay for JIT in game.
+    * Not used if MonoAotMode is Full.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime|Mono")
+    EUnrealSharpJitPrewarmMode JitPrewarmMode = EUnrealSharpJitPrewarmMode::Disabled;
+
+    /*
+    * Record the first use of C# methods, types, struct factories and function redirectors, 
+    * the startup profile is saved when the runtime shuts down or by UnrealSharp.SaveStartupProfile.
+    * Play a typical session with it, then ship the profile with JitPrewarmMode Profile.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime")
+    bool bRecordStartupProfile = false;
+
+    /*
+    * Strings not longer than this and passed from native to C# repeatedly on game thread share one C# string object, 
+    * so property names, tags and the like are not allocated on every call. 0 means disabled.
+    * Use UnrealSharp.DumpInternedStrings to print them.
+    */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime|Mono")
+    int MaxInternedStringLength = 32;
+
     /*
     * Whether to support Blueprint binding. 
     * When this feature is turned on, bindings for blueprint types will be automatically generated. 
@@ -44,5 +44,8 @@ namespace UnrealSharp
 
         // get internal C# object
         virtual void*                   GetObject() const = 0;
+
+        // raw value of the handle, the same as GCHandle.ToIntPtr in C#
+        virtual void*                   GetHandleValue() const = 0;
     };
 }
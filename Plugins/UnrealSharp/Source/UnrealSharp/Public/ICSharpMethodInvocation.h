@@ -34,6 +34,7 @@ namespace UnrealSharp
     * Exception class interface executed by C# code. 
     * When calling a C# method, if this object is provided, 
     * then you can get the exception details from this object [only when an exception occurs]
+    * Message and stack trace are built on the first access, use the fingerprint to identify an exception cheaply.
     */
     class UNREALSHARP_API ICSharpMethodInvocationException
     {
@@ -46,6 +47,9 @@ namespace UnrealSharp
 
         // Get Stack trace
         virtual const FString&                GetStackTrace() const = 0;
+
+        // Get a hash of exception type, call site and message, same exceptions thrown repeatedly have the same fingerprint
+        virtual uint32                        GetFingerprint() const = 0;
     };
 
     /*
@@ -27,6 +27,8 @@
 
 namespace UnrealSharp
 {
+    struct FCSharpObjectHandleSlotTable;
+
     /*
     * Used to save the mapping of UnrealObject (UObject*) to C# Object, and also create a proxy for UObject* on the C# side. 
     * It is also responsible for the coordination of the memory management of Unreal Object and the memory management of C# objects.     
@@ -52,5 +54,17 @@ namespace UnrealSharp
         * which is obtained by invoke the GetNativePtr method of the C# UObject class.
         */
         virtual UObject*                        GetUnrealObject(void* InCSharpObject) = 0;        
+
+        /*
+        * Disconnect all C# proxy objects from their UObject*.
+        * It is used when a play session ends but the runtime is kept alive for the next session.
+        */
+        virtual void                            Reset() = 0;
+
+        // get all UObject* which have a C# proxy object
+        virtual void                            GetObjects(TArray<UObject*>& OutObjects) const = 0;
+
+        // get the GC handle slots of proxy objects shared with C#
+        virtual const FCSharpObjectHandleSlotTable* GetHandleSlotTable() const = 0;
     };
 }
@@ -39,6 +39,23 @@ namespace UnrealSharp
     class IPropertyMarshaller;
     class ICSharpObjectTable;
     class ICSharpLibraryAccessor;
+    class FCSharpAsyncLoadManager;
+
+    // result of ICSharpRuntime::HotReload
+    struct FCSharpHotReloadReport
+    {
+        // total seconds of the reload, include rebinding objects
+        double                                          Seconds = 0.0;
+
+        // live objects bound to new C# proxy objects
+        int32                                           ReboundObjectCount = 0;
+
+        // objects destroyed before they are rebound
+        int32                                           LostObjectCount = 0;
+
+        // the old runtime was shut down but the new one failed to start, the runtime can't be used any more
+        bool                                            bIsRuntimeLost = false;
+    };
 
     /*
     * This represents a C# runtime, which may be CoreCLR, Mono, or of course a virtual machine implemented by yourself.
@@ -96,6 +113,24 @@ namespace UnrealSharp
 
         // get C# object table
         virtual ICSharpObjectTable*                     GetObjectTable() = 0;        
+
+        // get manager of asynchronous loads requested by C#
+        virtual FCSharpAsyncLoadManager*                GetAsyncLoadManager() = 0;
+
+        // reset states of current play session, the runtime itself is kept alive for the next session
+        virtual void                                    ResetSession() = 0;
+
+        // check if any UnrealSharp assembly is changed on disk after it is loaded, the runtime must be restarted to use it
+        virtual bool                                    IsAssemblyChanged() const = 0;
+
+        /*
+        * Reload all assemblies without restarting the game. 
+        * The managed runtime is recreated, all cached C# types, methods, struct factories and function redirectors are invalidated,
+        * then a new C# proxy object is created for each UObject which had one.
+        * Static states of C# codes are lost, states saved in unreal properties are kept.
+        * It must be called in game thread when no C# code is running.
+        */
+        virtual bool                                    HotReload(FCSharpHotReloadReport& OutReport) = 0;
     };
 
     /*
@@ -109,11 +144,21 @@ namespace UnrealSharp
         static TRefCountPtr<ICSharpRuntime>             RetainCSharpRuntime();
 
         // release C# runtime and decrease reference counter
+        // in editor, the last reference may keep the runtime alive for next PIE session, see bKeepRuntimeAliveBetweenPIESessions
         static void                                     ReleaseCSharpRuntime(TRefCountPtr<ICSharpRuntime>&& InRuntime);
 
+        // shutdown the runtime kept alive between PIE sessions
+        static void                                     ShutdownKeptAliveCSharpRuntime();
+
+        // hot reload assemblies of the running runtime, a runtime kept alive is released so next session loads new assemblies
+        static bool                                     HotReloadCSharpRuntime();
+
         // check is global C# runtime exists!
         static bool                                     IsGlobalCSharpRuntimeValid();
 
+        // check is global C# runtime exists and used by a session, it is false while the runtime is kept alive between PIE sessions
+        static bool                                     IsGlobalCSharpRuntimeActive();
+
         // get global instance
         // it need IsGlobalCSharpRuntimeValid() == true
         // It does not increment the reference count, so you need to ensure its safety yourself
@@ -0,0 +1,93 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/CSharpStructures.h"
+
+namespace UnrealSharp
+{
+    class ICSharpRuntime;
+    class ICSharpMethodInvocation;
+
+    /*
+    * Load soft object paths asynchronously for C#.
+    * Every request is identified by an id, C# is notified by AsyncLoadManager.OnAsyncLoadCompleted when a request is completed, 
+    * then it takes the loaded objects and releases the request. 
+    * Paths are copied when the request is made, so the soft object pointers may be destroyed while loading.
+    */
+    class UNREALSHARP_API FCSharpAsyncLoadManager : FNoncopyable
+    {
+    public:
+        enum class ERequestState : int32
+        {
+            Invalid,
+            Pending,
+            Completed,
+            Canceled
+        };
+
+        FCSharpAsyncLoadManager(ICSharpRuntime* InRuntime);
+        ~FCSharpAsyncLoadManager();
+
+        // return id of the request, 0 if nothing to load
+        int32                                       RequestAsyncLoad(TArray<FSoftObjectPath>&& InPaths, int32 InPriority);
+        ERequestState                               GetState(int32 InRequestId, float* OutProgress) const;
+
+        // resolve the loaded objects in the order of requested paths, return count of loaded objects
+        int32                                       GetLoadedObjects(int32 InRequestId, UObject** OutObjects, int32 InCount) const;
+
+        void                                        Cancel(int32 InRequestId);
+        void                                        Release(int32 InRequestId);
+
+        // cancel and release all requests, then C# cancels all tasks waiting for them, called when a session is ended
+        void                                        CancelAll();
+
+        const FCSharpAsyncLoadStatistics&           GetStatistics() const { return Statistics; }
+        void                                        DumpStatistics() const;
+
+    private:
+        void                                        OnRequestCompleted(int32 InRequestId);
+
+        struct FRequest
+        {
+            TArray<FSoftObjectPath>                 Paths;
+            TSharedPtr<FStreamableHandle>           Handle;
+            double                                  StartTime = 0.0;
+            ERequestState                           State = ERequestState::Pending;
+        };
+
+    private:
+        ICSharpRuntime*                             Runtime;
+        FStreamableManager                          StreamableManager;
+        TMap<int32, FRequest>                       Requests;
+        int32                                       NextRequestId = 1;
+        FCSharpAsyncLoadStatistics                  Statistics;
+        TSharedPtr<ICSharpMethodInvocation>         CompletedInvocation;
+        TSharedPtr<ICSharpMethodInvocation>         AllCanceledInvocation;
+    };
+}
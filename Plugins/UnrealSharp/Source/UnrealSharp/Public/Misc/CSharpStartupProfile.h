@@ -0,0 +1,85 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+namespace UnrealSharp
+{
+    /*
+    * Startup profile records the first use of C# methods, C# types, struct factories and C# function redirectors in a session.
+    * Next runtime started with JitPrewarmMode Profile binds struct factories and redirectors in the profile on game thread, 
+    * then resolves and compiles the methods and types on a background thread, 
+    * so only the codes a session really uses are warmed, in the order they were used.
+    * One entry in a line: Kind<Tab>AssemblyName<Tab>Name
+    *   M : method, Name is fully qualified method name, eg: UnrealSharp.GameScripts.MyActor:ReceiveBeginPlay ()
+    *   T : type, Name is full name of C# type
+    *   S : struct factory, Name is path name of UScriptStruct, AssemblyName is empty
+    *   R : redirector, Name is path name of UFunction, AssemblyName is empty
+    */
+    class UNREALSHARP_API FCSharpStartupProfile
+    {
+    public:
+        enum class EEntryKind : uint8
+        {
+            Method,
+            Type,
+            StructFactory,
+            Redirector
+        };
+
+        struct FEntry
+        {
+            EEntryKind          Kind = EEntryKind::Method;
+            FString             AssemblyName;
+            FString             Name;
+        };
+
+        static bool             IsRecording() { return bIsRecording; }
+        static void             StartRecording();
+        static void             StopRecording();
+
+        // only the first use of an entry is kept
+        static void             Record(EEntryKind InKind, const FString& InAssemblyName, const FString& InName)
+        {
+            if (bIsRecording)
+            {
+                RecordInternal(InKind, InAssemblyName, InName);
+            }
+        }
+
+        // save entries recorded since StartRecording
+        static bool             Save(const FString& InFilePath);
+        static bool             Load(const FString& InFilePath, TArray<FEntry>& OutEntries);
+
+    private:
+        static void             RecordInternal(EEntryKind InKind, const FString& InAssemblyName, const FString& InName);
+
+    private:
+        static FCriticalSection CriticalSection;
+        static TArray<FEntry>   Entries;
+        static TSet<FString>    RecordedKeys;
+        static bool             bIsRecording;
+    };
+}
@@ -27,6 +27,8 @@
 
 #include "CoreMinimal.h"
 
+class FProperty;
+
 namespace UnrealSharp
 {
     // C# FText
@@ -57,6 +59,30 @@ namespace UnrealSharp
         void* ObjectPtr = nullptr;
     };
 
+    /*
+    * GC handles of C# proxy objects, indexed by the GUObjectArray index of their UObject. 
+    * It is shared with C#, so C# can get the proxy of a UObject* without an interop call if the proxy already exists. 
+    * Slots are grouped in chunks, a chunk is allocated when the first object in its range gets a proxy, so its address never changes.
+    */
+    struct FCSharpObjectHandleSlotTable
+    {
+        void***                         Chunks = nullptr;
+        int32                           NumChunks = 0;
+        int32                           ChunkShift = 16;
+        // offset of the GUObjectArray index in UObject, -1 means the table can't be used from C#
+        int32                           InternalIndexOffset = -1;
+    };
+
+    // statistics of asynchronous loads requested by C#, shared with C#
+    struct FCSharpAsyncLoadStatistics
+    {
+        int32                           PendingCount = 0;
+        int32                           CompletedCount = 0;
+        int32                           CanceledCount = 0;
+        double                          TotalLoadSeconds = 0.0;
+        double                          MaxLoadSeconds = 0.0;
+    };
+
     /*
     * Through this structure, you can obtain the Key and Value pointers of a Map at one time, which can reduce one interactive function call.
     */
@@ -66,6 +92,17 @@ namespace UnrealSharp
         void* ValueAddressPointer;
     };
 
+    /*
+    * Through this structure, C# can obtain the property pointer, offset and size of many properties at one time, 
+    * which is used to bind the generated property meta cache with a single interactive function call.
+    */
+    struct FPropertyMetaCache
+    {
+        const FProperty* PropertyPointer = nullptr;
+        int Offset = -1;
+        int Size = 0;
+    };
+
     // platform definition
     enum class EUnrealSharpPlatform : uint8
     {
@@ -94,6 +131,7 @@ namespace UnrealSharp
         EUnrealSharpPlatform            Platform;
         EUnrealSharpBuildConfiguration  Configuration;
         bool                            bWithEditor;
+        uint32                          InteropFunctionTableLayoutHash;
 
     public:
         // get C++ build info
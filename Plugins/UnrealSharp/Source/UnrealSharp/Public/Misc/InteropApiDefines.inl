@@ -39,6 +39,8 @@ DECLARE_UNREAL_SHARP_INTEROP_API(FCSharpObjectMarshalValue, GetActorWorld, (cons
 DECLARE_UNREAL_SHARP_INTEROP_API(FCSharpObjectMarshalValue, GetActorGameInstance, (const AActor* InActor));
 DECLARE_UNREAL_SHARP_INTEROP_API(FCSharpObjectMarshalValue, SpawnActorByTransform, (UWorld* InWorld, UClass* InClass, const void* InTransformPtr, int InTransformSize));
 DECLARE_UNREAL_SHARP_INTEROP_API(FCSharpObjectMarshalValue, SpawnActor, (UWorld* InWorld, UClass* InClass, const FVector* InLocation, const FRotator* InRotation));
+DECLARE_UNREAL_SHARP_INTEROP_API(int, SpawnActorsDeferred, (UWorld* InWorld, UClass* InClass, const void* InTransformsPtr, int InTransformSize, int InCount, AActor** OutActors));
+DECLARE_UNREAL_SHARP_INTEROP_API(void, FinishSpawningActors, (AActor** InActors, const void* InTransformsPtr, int InTransformSize, int InCount));
 
 
 // Array Interop Utils
@@ -54,9 +56,12 @@ DECLARE_UNREAL_SHARP_INTEROP_API(int, FindIndexOfArrayElement, (const void* InAd
 DECLARE_UNREAL_SHARP_INTEROP_API(FCSharpObjectMarshalValue, GetDefaultObjectOfClass, (const UClass* InClass));
 DECLARE_UNREAL_SHARP_INTEROP_API(const UClass*, GetClassPointerOfUnrealObject, (const UObject* InObject));
 DECLARE_UNREAL_SHARP_INTEROP_API(const UField*, LoadUnrealField, (const char* InCSharpFieldPathName));
+DECLARE_UNREAL_SHARP_INTEROP_API(int, LoadUnrealFields, (const char* InCSharpFieldPathNames, const UField** OutFields, int InCount));
 DECLARE_UNREAL_SHARP_INTEROP_API(bool, CheckUClassIsChildOf, (const UClass* InTestClass, const UClass* InTestBaseClass));
 DECLARE_UNREAL_SHARP_INTEROP_API(const UClass*, GetSuperClass, (const UClass* InClass));
 DECLARE_UNREAL_SHARP_INTEROP_API(const FProperty*, GetProperty, (const UStruct* InStruct, const char* InCSharpPropertyName));
+DECLARE_UNREAL_SHARP_INTEROP_API(int, GetPropertyMetaCaches, (const UStruct* InStruct, const char* InCSharpPropertyNames, FPropertyMetaCache* OutMetaCaches, int InCount));
+DECLARE_UNREAL_SHARP_INTEROP_API(const UStruct*, LoadStructPropertyMetaCaches, (const char* InCSharpStructPathName, const char* InCSharpPropertyNames, FPropertyMetaCache* OutMetaCaches, int InCount));
 DECLARE_UNREAL_SHARP_INTEROP_API(const UFunction*, GetFunction, (const UClass* InClass, const char* InCSharpFunctionName));
 DECLARE_UNREAL_SHARP_INTEROP_API(int, GetStructSize, (const UStruct* InStruct));
 DECLARE_UNREAL_SHARP_INTEROP_API(void, InitializeStructData, (const UStruct* InStruct, const void* InAddressOfStructData));
@@ -115,6 +120,7 @@ DECLARE_UNREAL_SHARP_INTEROP_API(void, DoNotCreateNestedDefaultSubobjectOfObject
 DECLARE_UNREAL_SHARP_INTEROP_API(const UObject*, GetDefaultUnrealObjectOfClass, (const UClass* InClass));
 DECLARE_UNREAL_SHARP_INTEROP_API(UObject*, GetUnrealObjectOfCSharpObject, (const void* InCSharpObject));
 DECLARE_UNREAL_SHARP_INTEROP_API(FCSharpObjectMarshalValue, GetCSharpObjectOfUnrealObject, (const UObject* InObject));
+DECLARE_UNREAL_SHARP_INTEROP_API(const FCSharpObjectHandleSlotTable*, GetCSharpObjectHandleSlotTable, ());
 DECLARE_UNREAL_SHARP_INTEROP_API(FCSharpObjectMarshalValue, GetOuterOfUnrealObject, (const UObject* InObject));
 DECLARE_UNREAL_SHARP_INTEROP_API(const TCHAR*, GetNameOfUnrealObject, (const UObject* InObject));
 DECLARE_UNREAL_SHARP_INTEROP_API(const TCHAR*, GetPathNameOfUnrealObject, (const UObject* InObject));
@@ -167,6 +173,12 @@ DECLARE_UNREAL_SHARP_INTEROP_API(UObject*, GetUnrealObjectPointerOfSoftObjectPtr
 DECLARE_UNREAL_SHARP_INTEROP_API(FSoftObjectPath*, GetObjectIdPointerOfSoftObjectPtr, (FSoftObjectPtr* InSoftObjectPtr));
 DECLARE_UNREAL_SHARP_INTEROP_API(UObject*, LoadSynchronousSoftObjectPtr, (FSoftObjectPtr* InSoftObjectPtr));
 DECLARE_UNREAL_SHARP_INTEROP_API(void, CopySoftObjectPtr, (FSoftObjectPtr* InDestination, const FSoftObjectPtr* InSource));
+DECLARE_UNREAL_SHARP_INTEROP_API(int, RequestAsyncLoadSoftObjectPtrs, (const FSoftObjectPtr** InSoftObjectPtrs, int InCount, int InPriority));
+DECLARE_UNREAL_SHARP_INTEROP_API(int, GetAsyncLoadState, (int InRequestId, float* OutProgress));
+DECLARE_UNREAL_SHARP_INTEROP_API(int, GetAsyncLoadedObjects, (int InRequestId, UObject** OutObjects, int InCount));
+DECLARE_UNREAL_SHARP_INTEROP_API(void, CancelAsyncLoad, (int InRequestId));
+DECLARE_UNREAL_SHARP_INTEROP_API(void, ReleaseAsyncLoad, (int InRequestId));
+DECLARE_UNREAL_SHARP_INTEROP_API(void, GetAsyncLoadStatistics, (FCSharpAsyncLoadStatistics* OutStatistics));
 
 // String Interop Utils
 DECLARE_UNREAL_SHARP_INTEROP_API(const TCHAR*, GetCSharpMarshalString, (const FString* InStringPtr));
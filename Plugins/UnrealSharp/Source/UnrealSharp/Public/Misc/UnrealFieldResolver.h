@@ -0,0 +1,90 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+namespace UnrealSharp
+{
+    /*
+    * Resolve and cache the UField and FProperty lookups requested by C#.
+    * Generated bindings load fields by path and find properties by name from many static constructors,
+    * this resolver groups batched requests by package and caches all results,
+    * so repeated lookups are only a hash lookup.
+    * All caches are invalidated after hot reload or blueprint reinstancing, 
+    * fields replaced by newer versions and property tables of relinked structs(eg: recompiled user defined structs) are never returned.
+    * It must be used in game thread, like LoadObject and StaticFindObjectFast called by it.
+    */
+    class UNREALSHARP_API FUnrealFieldResolver
+    {
+    public:
+        // get global instance
+        static FUnrealFieldResolver&                            Get();
+
+        // bind engine delegates used to invalidate caches
+        void                                                    Startup();
+
+        // unbind engine delegates and clear all caches
+        void                                                    Shutdown();
+
+        // find or load field by path, such as /Script/Engine.Actor
+        const UField*                                           ResolveField(const FString& InFieldPath);
+
+        // find or load fields by paths, fields in the same package are resolved together
+        void                                                    ResolveFields(const TArray<FString>& InFieldPaths, TArray<const UField*>& OutFields);
+
+        // find property by C# property name
+        const FProperty*                                        FindProperty(const UStruct* InStruct, const FName& InPropertyName);
+
+        // clear all caches
+        void                                                    Invalidate();
+
+    private:
+        // get name->property table of struct
+        const TMap<FName, const FProperty*>&                    GetPropertyTable(const UStruct* InStruct);
+
+        const UField*                                           FindCachedField(const FString& InFieldPath) const;
+
+        static const UField*                                    LoadField(const FString& InFieldPath);
+
+    private:
+        struct FPropertyTable
+        {
+            TWeakObjectPtr<const UStruct>                       Struct;
+
+            // properties are recreated when the struct is relinked
+            const FProperty*                                    PropertyLink = nullptr;
+            TMap<FName, const FProperty*>                       Properties;
+        };
+
+        TMap<FString, TWeakObjectPtr<const UField>>             FieldCache;
+        TMap<const UStruct*, FPropertyTable>                    PropertyCache;
+
+        FDelegateHandle                                         ReloadCompleteHandle;
+        FDelegateHandle                                         PostGarbageCollectHandle;
+#if WITH_EDITOR
+        FDelegateHandle                                         ObjectsReplacedHandle;
+#endif
+    };
+}
@@ -30,6 +30,27 @@ namespace UnrealSharp
     class FUnrealInteropFunctions;
     struct FUnrealSharpBuildInfo;
 
+    /*
+    * All interactive functions declared in InteropApiDefines.inl, stored by ordinal.
+    * C# receives the pointer of this table and reads function pointers by fixed offsets, 
+    * so there is no string conversion or hash lookup when binding these functions.
+    * @warning :
+    *    The order of InteropApiDefines.inl is part of the layout, C# must be synced with it.
+    *    The layout hash is validated in ValidateUnrealSharpBuildInfo.
+    */
+    struct UNREALSHARP_API FUnrealInteropFunctionTable
+    {
+#define DECLARE_UNREAL_SHARP_INTEROP_API(returnType, name, parameters) \
+        void* name = nullptr
+
+#include "Misc/InteropApiDefines.inl"
+
+#undef DECLARE_UNREAL_SHARP_INTEROP_API
+
+        // hash of all function names in declaration order, C# calculate it in the same way
+        static uint32                       GetLayoutHash();
+    };
+
     /*
     * This data carries all the key information used for interactive communication between C++ and C#. 
     * Subsequent operations can be combined or used by these basic information.
@@ -48,6 +69,9 @@ namespace UnrealSharp
         // log message
         void*                               LogMessageFunctionPointerFunc;
 
+        // built-in interop function table
+        const FUnrealInteropFunctionTable*  FunctionTable;
+
 
         // engine versions
         // C# will check this for Compatibility testing
@@ -60,6 +84,8 @@ namespace UnrealSharp
     * To exchange function containers, we map interactive function pointers through strings. 
     * On the C# side, we access these interactive functions through delegate* unmanaged, that is, C# function pointers, 
     * and bind them through function names at runtime.
+    * Built-in functions are stored in FUnrealInteropFunctionTable and accessed by ordinal,
+    * names are only used for the functions registered at runtime, such as generated fast invoke functions.
     * @see also: https://learn.microsoft.com/en-us/dotnet/csharp/language-reference/proposals/csharp-9.0/function-pointers
     * @warning : 
     *    All interactive function names must be globally unique, otherwise conflicts will occur, 
@@ -83,6 +109,9 @@ namespace UnrealSharp
         // remove interop function
         void                                RemoveInteropFunction(const FString& InFunctionName);
 
+        // get built-in interop function table
+        const FUnrealInteropFunctionTable&  GetFunctionTable() const { return FunctionTable; }
+
     private:                           
         // setup base interop functions
         void                                SetupBaseInteropFunctions();
@@ -105,6 +134,7 @@ namespace UnrealSharp
         
     private:
         TMap<FString, void*>                InteropFunctions;
+        FUnrealInteropFunctionTable         FunctionTable;
     };
 
 #define US_ADD_GLOBAL_INTEROP_FUNCTION(InteropFunctionsName, FunctionName) \
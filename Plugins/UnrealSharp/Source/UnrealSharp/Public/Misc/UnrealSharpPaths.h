@@ -46,6 +46,9 @@ namespace UnrealSharp
         // get managed library directory
         static FString              GetUnrealSharpManagedLibraryDir();
 
+        // startup profile recorded by FCSharpStartupProfile
+        static FString              GetStartupProfilePath();
+
         // Gets the default unreal CPP database file path.
         static FString              GetDefaultUnrealCppDatabaseFilePath();
 
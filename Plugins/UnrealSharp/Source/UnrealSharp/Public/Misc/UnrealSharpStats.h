@@ -0,0 +1,75 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/*
+* Profile interop crossings.
+* stat UnrealSharp : cycle counters and counters of all crossings.
+* Unreal Insights  : start with -trace=cpu,UnrealSharp, C++ to C# calls are also reported per UFunction, 
+*                    one of UnrealSharp.TraceFunctionSampleRate calls of each function is reported.
+*/
+UE_TRACE_CHANNEL_EXTERN(UnrealSharpChannel, UNREALSHARP_API);
+
+DECLARE_STATS_GROUP(TEXT("UnrealSharp"), STATGROUP_UnrealSharp, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("C++ To C# Call"), STAT_UnrealSharp_CallCSharp, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("C++ To C# Marshal"), STAT_UnrealSharp_MarshalToCSharp, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("C# Method Invoke"), STAT_UnrealSharp_CSharpMethodInvoke, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("C# To C++ Call"), STAT_UnrealSharp_CallUnreal, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("C# Proxy Create"), STAT_UnrealSharp_ProxyCreate, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("C# Garbage Collect"), STAT_UnrealSharp_GarbageCollect, STATGROUP_UnrealSharp, UNREALSHARP_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("C++ To C# Calls"), STAT_UnrealSharp_CallCSharpCount, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("C# To C++ Calls"), STAT_UnrealSharp_CallUnrealCount, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("C# Proxies Created"), STAT_UnrealSharp_ProxyCreateCount, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("C# Proxies Destroyed"), STAT_UnrealSharp_ProxyDestroyCount, STATGROUP_UnrealSharp, UNREALSHARP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("C# Proxies Alive"), STAT_UnrealSharp_ProxyAliveCount, STATGROUP_UnrealSharp, UNREALSHARP_API);
+
+// cycle counter visible in both stat UnrealSharp and Unreal Insights
+#define US_INTEROP_SCOPE(Stat) \
+    SCOPE_CYCLE_COUNTER(Stat); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, UnrealSharpChannel)
+
+namespace UnrealSharp
+{
+    /*
+    * Report a sampled Insights event named by the UFunction.
+    * The event type is registered on the first sampled call and cached by the caller.
+    */
+    class UNREALSHARP_API FInteropFunctionTraceScope : FNoncopyable
+    {
+    public:
+        FInteropFunctionTraceScope(const UFunction* InFunction, uint32& InOutEventId, uint32& InOutCallCount);
+        ~FInteropFunctionTraceScope();
+
+    private:
+        bool                bActive = false;
+    };
+}
@@ -0,0 +1,135 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#include "Misc/UnrealSharpLog.h"
+
+/*
+* Interop tracing.
+* UNREALSHARP_TRACE_LEVEL is the highest level compiled in, trace points above it are removed by the compiler.
+* Below it, the level is checked at runtime against the console variable UnrealSharp.TraceLevel (default 0),
+* so a disabled trace point costs one integer compare and never evaluates its arguments.
+*   0 : nothing
+*   1 : rare events, eg: garbage collection, object table cleanup
+*   2 : object table and marshaller events
+*   3 : every method invocation
+* Events are fixed size records written to a ring buffer without allocation, 
+* they are formatted only by UnrealSharp.DumpInteropTrace.
+*/
+#ifndef UNREALSHARP_TRACE_LEVEL
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+#define UNREALSHARP_TRACE_LEVEL 0
+#else
+#define UNREALSHARP_TRACE_LEVEL 3
+#endif
+#endif
+
+namespace UnrealSharp
+{
+    enum class EInteropTraceLevel : int32
+    {
+        None = 0,
+        Basic = 1,
+        Verbose = 2,
+        VeryVerbose = 3
+    };
+
+    enum class EInteropTraceEvent : uint8
+    {
+        // Value: microseconds spent on breaking connections and C# garbage collection
+        GarbageCollect,
+
+        // Subject: C# object
+        ObjectConnectionBreak,
+
+        // Subject: UObject*, Detail: C# object
+        ObjectProxyCreate,
+
+        // Subject: C# object, Detail: UObject*
+        ObjectToUnreal,
+
+        // Subject: UObject*, Detail: C# object
+        ObjectToCSharp,
+
+        // Subject: destination address, Detail: C# object
+        SoftObjectToUnreal,
+
+        // Subject: C# method, Detail: actual method after virtual dispatch
+        CSharpMethodInvoke,
+
+        // Subject: UFunction*, Detail: UObject*
+        UnrealFunctionInvoke,
+
+        // Subject: UFunction*, Detail: UObject*
+        UnrealFunctionRedirect
+    };
+
+    struct FInteropTraceRecord
+    {
+        uint64                          Cycles;
+        const void*                     Subject;
+        const void*                     Detail;
+        int64                           Value;
+        uint32                          ThreadId;
+        EInteropTraceEvent              Event;
+    };
+
+    class UNREALSHARP_API FInteropTrace
+    {
+    public:
+        static inline bool              IsEnabled(EInteropTraceLevel InLevel)
+        {
+            return RuntimeLevel >= static_cast<int32>(InLevel);
+        }
+
+        static void                     Record(EInteropTraceEvent InEvent, const void* InSubject, const void* InDetail, int64 InValue = 0);
+
+        // write recorded events to log, newest last
+        static void                     Dump();
+
+        static const TCHAR*             GetEventName(EInteropTraceEvent InEvent);
+
+    public:
+        static int32                    RuntimeLevel;
+    };
+}
+
+#if UNREALSHARP_TRACE_LEVEL > 0
+#define US_TRACE_ENABLED(Level) \
+    (static_cast<int32>(UnrealSharp::EInteropTraceLevel::Level) <= UNREALSHARP_TRACE_LEVEL && UnrealSharp::FInteropTrace::IsEnabled(UnrealSharp::EInteropTraceLevel::Level))
+
+// record an event, arguments are evaluated only when enabled
+#define US_TRACE_EVENT(Level, Event, Subject, ...) \
+    do { if (US_TRACE_ENABLED(Level)) { UnrealSharp::FInteropTrace::Record(UnrealSharp::EInteropTraceEvent::Event, Subject, ##__VA_ARGS__); } } while(0)
+
+// log a formatted text, arguments are evaluated only when enabled
+#define US_TRACE_LOG(Level, Format, ...) \
+    do { if (US_TRACE_ENABLED(Level)) { UE_LOG(UnrealSharpLog, Log, Format, ##__VA_ARGS__); } } while(0)
+#else
+#define US_TRACE_ENABLED(Level) false
+#define US_TRACE_EVENT(Level, Event, Subject, ...)
+#define US_TRACE_LOG(Level, Format, ...)
+#endif
@@ -38,6 +38,7 @@
 #include "Kismet2/EnumEditorUtils.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "BlueprintCompilationManager.h"
 #include "UserDefinedStructure/UserDefinedStructEditorData.h"
 #include "CSharpBlueprintGeneratorUtils.h"
 #include "CSharpBlueprintGeneratorDatabase.h"
@@ -64,35 +65,111 @@ namespace UnrealSharp
 
     void FCSharpBlueprintGenerator::Process()
     {
+        const double StartTime = FPlatformTime::Seconds();
+
+        // unchanged types are Completed already, changed types and their dependents need update
+        TArray<FCSharpGeneratedTypeInfo*> PendingTypes = Database->GetTypesInDependencyOrder();
+        const int TotalCount = PendingTypes.Num();
+
+        PendingTypes.RemoveAll([](const FCSharpGeneratedTypeInfo* InInfo)
+        {
+            return InInfo->State == ECSharpGeneratedTypeState::Completed;
+        });
+
+        if (PendingTypes.IsEmpty())
+        {
+            US_LOG(TEXT("All %d C# generated types are up to date."), TotalCount);
+            return;
+        }
+
+        US_LOG(TEXT("Regenerate %d of %d C# generated types."), PendingTypes.Num(), TotalCount);
+
         // process enum first
-        Database->Accept([US_LAMBDA_CAPTURE_THIS](FCSharpGeneratedTypeInfo& InInfo)
+        for (FCSharpGeneratedTypeInfo* Info : PendingTypes)
         {
-            if (InInfo.State != ECSharpGeneratedTypeState::Completed && Cast<UCSharpEnum>(InInfo.Field) != nullptr)
+            if (Cast<UCSharpEnum>(Info->Field) != nullptr && ProcessEnum(Info))
             {
-                if (ProcessEnum(&InInfo))
-                {
-                    InInfo.State = ECSharpGeneratedTypeState::Completed;
-                }
+                Info->State = ECSharpGeneratedTypeState::Completed;
             }
-        });
+        }
 
-        // process struct
-        Database->Accept([US_LAMBDA_CAPTURE_THIS](const FCSharpGeneratedTypeInfo& InInfo)
+        // process struct, dependencies order makes sure inner structs are compiled before outer structs
+        for (FCSharpGeneratedTypeInfo* Info : PendingTypes)
         {
-            if (InInfo.State != ECSharpGeneratedTypeState::Completed && Cast<UCSharpStruct>(InInfo.Field) != nullptr)
+            if (Cast<UCSharpStruct>(Info->Field) != nullptr && ProcessStruct(Info))
             {
-                ProcessStruct(&InInfo);
+                Info->State = ECSharpGeneratedTypeState::Completed;
             }
-        });
+        }
 
         // process class
-        Database->Accept([US_LAMBDA_CAPTURE_THIS](FCSharpGeneratedTypeInfo& InInfo)
+        ProcessClasses(PendingTypes.FilterByPredicate([](const FCSharpGeneratedTypeInfo* InInfo)
         {
-            if (InInfo.State != ECSharpGeneratedTypeState::Completed && Cast<UCSharpClass>(InInfo.Field) != nullptr)
+            return Cast<UCSharpClass>(InInfo->Field) != nullptr;
+        }));
+
+        SavePackages();
+
+        US_LOG(TEXT("Regenerate C# generated types done, %.3f seconds."), FPlatformTime::Seconds() - StartTime);
+    }
+
+    void FCSharpBlueprintGenerator::ProcessClasses(const TArray<FCSharpGeneratedTypeInfo*>& InClassInfos)
+    {
+        // child blueprint need the compiled class of its parent to find functions to override,
+        // so classes are grouped by inheritance depth, each group is compiled in one batch.
+        TMap<const FCSharpGeneratedTypeInfo*, int> Depths;
+        TArray<TArray<FCSharpGeneratedTypeInfo*>> Groups;
+
+        for (FCSharpGeneratedTypeInfo* Info : InClassInfos)
+        {
+            const TSharedPtr<FClassTypeDefinition> ClassType = StaticCastSharedPtr<FClassTypeDefinition>(Info->Definition);
+            const FCSharpGeneratedTypeInfo* SuperInfo = Database->FindTypeByCppName(ClassType->SuperName);
+
+            // super class is in front of this class, so its depth is known if it needs update.
+            const int* SuperDepthPtr = SuperInfo != nullptr ? Depths.Find(SuperInfo) : nullptr;
+            const int Depth = SuperDepthPtr != nullptr ? *SuperDepthPtr + 1 : 0;
+
+            Depths.Add(Info, Depth);
+
+            if (Groups.Num() <= Depth)
             {
-                ProcessClass(&InInfo);
+                Groups.SetNum(Depth + 1);
             }
-        });
+
+            Groups[Depth].Add(Info);
+        }
+
+        for (const TArray<FCSharpGeneratedTypeInfo*>& Group : Groups)
+        {
+            for (FCSharpGeneratedTypeInfo* Info : Group)
+            {
+                if (ProcessClass(Info))
+                {
+                    FBlueprintCompilationManager::QueueForCompilation(Info->Blueprint);
+
+                    Info->State = ECSharpGeneratedTypeState::Completed;
+                }
+            }
+
+            FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+        }
+    }
+
+    void FCSharpBlueprintGenerator::SavePackages()
+    {
+        FSavePackageArgs Args;
+        Args.TopLevelFlags = RF_Public | RF_Standalone;
+
+        for (const FCSharpGeneratedTypeInfo* Info : PendingSaveTypes)
+        {
+            UObject* Asset = Info->Blueprint != nullptr ? static_cast<UObject*>(Info->Blueprint) : static_cast<UObject*>(Info->Field);
+
+            UPackage::SavePackage(Asset->GetOutermost(), Asset, *Info->FilePath, Args);
+        }
+
+        US_LOG(TEXT("Saved %d C# generated packages."), PendingSaveTypes.Num());
+
+        PendingSaveTypes.Empty();
     }
 
     bool FCSharpBlueprintGenerator::ProcessEnum(const FCSharpGeneratedTypeInfo* InInfo) // NOLINT
@@ -102,7 +179,6 @@ namespace UnrealSharp
 
         US_LOG(TEXT("Process C# Enum : %s"), *InInfo->Definition->CSharpFullName);
 
-        UPackage* Package = InInfo->Field->GetOutermost();
         UCSharpEnum* Enum = Cast<UCSharpEnum>(InInfo->Field);
         const TSharedPtr<FEnumTypeDefinition> EnumType = StaticCastSharedPtr<FEnumTypeDefinition>(InInfo->Definition);
         check(Enum);
@@ -137,10 +213,7 @@ namespace UnrealSharp
 
         FAssetRegistryModule::AssetCreated(Enum);
 
-        FSavePackageArgs Args;
-        Args.TopLevelFlags = RF_Public | RF_Standalone;
-
-        UPackage::SavePackage(Package, Enum, *InInfo->FilePath, Args);
+        PendingSaveTypes.Add(InInfo);
 
         return true;
     }
@@ -153,7 +226,6 @@ namespace UnrealSharp
 
         US_LOG(TEXT("Process C# Struct : %s"), *InInfo->Definition->CSharpFullName);
 
-        UPackage* Package = InInfo->Field->GetOutermost();
         UCSharpStruct* Struct = Cast<UCSharpStruct>(InInfo->Field);
         const TSharedPtr<FScriptStructTypeDefinition> StructType = StaticCastSharedPtr<FScriptStructTypeDefinition>(InInfo->Definition);
         check(Struct);
@@ -176,10 +248,7 @@ namespace UnrealSharp
 
         FAssetRegistryModule::AssetCreated(Struct);
 
-        FSavePackageArgs Args;
-        Args.TopLevelFlags = RF_Public | RF_Standalone;
-
-        UPackage::SavePackage(Package, Struct, *InInfo->FilePath, Args);
+        PendingSaveTypes.Add(InInfo);
 
         return true;
     }
@@ -189,8 +258,6 @@ namespace UnrealSharp
         check(InInfo->Blueprint && InInfo->Field);
 
         US_LOG(TEXT("Process C# Class : %s"), *InInfo->Definition->CSharpFullName);
-                
-        UPackage* Package = InInfo->Field->GetOutermost();
 
         UCSharpClass* Class = Cast<UCSharpClass>(InInfo->Field);
         check(Class);
@@ -241,13 +308,10 @@ namespace UnrealSharp
 
         FAssetRegistryModule::AssetCreated(InInfo->Blueprint);
 
+        // compiled in batch by ProcessClasses
         FBlueprintEditorUtils::MarkBlueprintAsModified(InInfo->Blueprint);
-        FKismetEditorUtilities::CompileBlueprint(InInfo->Blueprint);
-
-        FSavePackageArgs Args;
-        Args.TopLevelFlags = RF_Public | RF_Standalone;
 
-        UPackage::SavePackage(Package, InInfo->Blueprint, *InInfo->FilePath, Args);
+        PendingSaveTypes.Add(InInfo);
         
         return true;
     }
@@ -33,6 +33,7 @@
 #include "PropertyDefinition.h"
 #include "ObjectTools.h"
 #include "ClassTypeDefinition.h"
+#include "FunctionTypeDefinition.h"
 #include "Misc/UnrealSharpLog.h"
 #include "Misc/ScopedExit.h"
 #include "Misc/UnrealSharpUtils.h"
@@ -391,6 +392,138 @@ namespace UnrealSharp
         PrepareTypeStates();
 
         PrepareTypes();
+
+        PropagateTypeStates();
+    }
+
+    void FCSharpBlueprintGeneratorDatabase::PropagateTypeStates()
+    {
+        // a type must be regenerated with its dependencies, eg: child blueprint of a changed class, 
+        // visit in dependency order, so the state is passed through the whole dependency chain.
+        for (FCSharpGeneratedTypeInfo* Info : GetTypesInDependencyOrder())
+        {
+            if (Info->State != ECSharpGeneratedTypeState::Completed)
+            {
+                continue;
+            }
+
+            TArray<FCSharpGeneratedTypeInfo*> Dependencies;
+            GetDependencies(*Info, Dependencies);
+
+            const FCSharpGeneratedTypeInfo* const* ChangedDependencyPtr = Dependencies.FindByPredicate([](const FCSharpGeneratedTypeInfo* InDependency)
+            {
+                return InDependency->State != ECSharpGeneratedTypeState::Completed;
+            });
+
+            if (ChangedDependencyPtr != nullptr)
+            {
+                US_LOG(TEXT("C# type %s need update, because %s is changed."), *Info->CppName, *(*ChangedDependencyPtr)->CppName);
+
+                Info->State = ECSharpGeneratedTypeState::NeedUpdate;
+
+                CleanCSharpBlueprintType(CppNameToTypeInfoCaches.FindChecked(Info->CppName), Info->Definition);
+            }
+        }
+    }
+
+    TArray<FCSharpGeneratedTypeInfo*> FCSharpBlueprintGeneratorDatabase::GetTypesInDependencyOrder() const
+    {
+        TArray<FCSharpGeneratedTypeInfo*> Result;
+        Result.Reserve(NameToTypeInfoCaches.Num());
+
+        TSet<const FCSharpGeneratedTypeInfo*> VisitedTypes;
+
+        // depth first, dependencies can't be circular: struct can't contain itself by value, class can't inherit from itself.
+        TFunction<void(FCSharpGeneratedTypeInfo*)> Visit = [&](FCSharpGeneratedTypeInfo* InInfo)
+        {
+            bool bIsAlreadyVisited = false;
+            VisitedTypes.Add(InInfo, &bIsAlreadyVisited);
+
+            if (bIsAlreadyVisited)
+            {
+                return;
+            }
+
+            TArray<FCSharpGeneratedTypeInfo*> Dependencies;
+            GetDependencies(*InInfo, Dependencies);
+
+            for (FCSharpGeneratedTypeInfo* Dependency : Dependencies)
+            {
+                Visit(Dependency);
+            }
+
+            Result.Add(InInfo);
+        };
+
+        for (auto& Pair : NameToTypeInfoCaches)
+        {
+            Visit(Pair.Value.Get());
+        }
+
+        return Result;
+    }
+
+    void FCSharpBlueprintGeneratorDatabase::GetDependencies(const FCSharpGeneratedTypeInfo& InInfo, TArray<FCSharpGeneratedTypeInfo*>& OutDependencies) const
+    {
+        if (!InInfo.Definition || InInfo.Definition->IsEnum())
+        {
+            return;
+        }
+
+        if (InInfo.Definition->IsClass())
+        {
+            const FClassTypeDefinition* ClassDefinition = static_cast<const FClassTypeDefinition*>(InInfo.Definition.Get());
+
+            if (const auto* SuperInfoPtr = CppNameToTypeInfoCaches.Find(ClassDefinition->SuperName))
+            {
+                OutDependencies.AddUnique(SuperInfoPtr->Get());
+            }
+
+            for (auto& Function : ClassDefinition->Functions)
+            {
+                for (auto& Property : Function.Properties)
+                {
+                    GetPropertyDependencies(Property, OutDependencies);
+                }
+            }
+        }
+
+        for (auto& Property : static_cast<const FStructTypeDefinition*>(InInfo.Definition.Get())->Properties)
+        {
+            GetPropertyDependencies(Property, OutDependencies);
+        }
+
+        OutDependencies.RemoveAll([&InInfo](const FCSharpGeneratedTypeInfo* InDependency) { return InDependency == &InInfo; });
+    }
+
+    void FCSharpBlueprintGeneratorDatabase::GetPropertyDependencies(const FPropertyDefinition& InPropertyDefinition, TArray<FCSharpGeneratedTypeInfo*>& OutDependencies) const
+    {
+        // only value types are hard dependencies, object references between classes can be circular
+        if (InPropertyDefinition.ReferenceType == EReferenceType::UserType)
+        {
+            const auto* InfoPtr = NameToTypeInfoCaches.Find(InPropertyDefinition.TypeName);
+
+            if (InfoPtr != nullptr && ((*InfoPtr)->IsStruct() || (*InfoPtr)->IsEnum()))
+            {
+                OutDependencies.AddUnique(InfoPtr->Get());
+            }
+        }
+
+        for (auto& InnerProperty : InPropertyDefinition.InnerProperties)
+        {
+            if (InnerProperty)
+            {
+                GetPropertyDependencies(*InnerProperty, OutDependencies);
+            }
+        }
+
+        if (InPropertyDefinition.SignatureFunction)
+        {
+            for (auto& Property : InPropertyDefinition.SignatureFunction->Properties)
+            {
+                GetPropertyDependencies(Property, OutDependencies);
+            }
+        }
     }
 
     void FCSharpBlueprintGeneratorDatabase::Accept(const TFunction<void(FCSharpGeneratedTypeInfo&)>& InVisitor)
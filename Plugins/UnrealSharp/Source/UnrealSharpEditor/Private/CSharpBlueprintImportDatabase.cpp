@@ -156,6 +156,11 @@ namespace UnrealSharp
         return true;
     }
 
+    void FCSharpBlueprintImportDatabase::LoadFromRecords(TArray<TKeyValuePair<FString, uint32>>&& InRecords)
+    {
+        Records = MoveTemp(InRecords);
+    }
+
     uint32 FCSharpBlueprintImportDatabase::CalcFileCrc32(const TCHAR* InFilePath)
     {
         TArray<uint8> FileData;
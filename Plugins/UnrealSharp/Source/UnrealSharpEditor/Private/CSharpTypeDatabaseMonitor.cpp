@@ -0,0 +1,242 @@
+/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#include "CSharpTypeDatabaseMonitor.h"
+#include "CSharpBlueprintImportDatabase.h"
+#include "DirectoryWatcherModule.h"
+#include "Async/Async.h"
+#include "Misc/UnrealSharpLog.h"
+
+namespace UnrealSharp
+{
+    static const TCHAR* TypeDatabaseFileExtension = TEXT(".tdb");
+
+    FCSharpTypeDatabaseMonitor::FCSharpTypeDatabaseMonitor(const FString& InDirectoryPath) :
+        DirectoryPath(FPaths::ConvertRelativePathToFull(InDirectoryPath))
+    {
+        FPaths::NormalizeDirectoryName(DirectoryPath);
+    }
+
+    FCSharpTypeDatabaseMonitor::~FCSharpTypeDatabaseMonitor()
+    {
+        Stop();
+    }
+
+    void FCSharpTypeDatabaseMonitor::Start()
+    {
+        if (IsWatching())
+        {
+            return;
+        }
+
+        if (!FPaths::DirectoryExists(DirectoryPath))
+        {
+            US_LOG_WARN(TEXT("C# type database directory is not exists, can't watch it: %s"), *DirectoryPath);
+            return;
+        }
+
+        FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+        IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get();
+
+        if (DirectoryWatcher == nullptr ||
+            !DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+                DirectoryPath,
+                IDirectoryWatcher::FDirectoryChanged::CreateSP(this, &FCSharpTypeDatabaseMonitor::OnDirectoryChanged),
+                WatcherHandle
+            ))
+        {
+            US_LOG_WARN(TEXT("Failed watch C# type database directory: %s"), *DirectoryPath);
+            WatcherHandle.Reset();
+        }
+    }
+
+    void FCSharpTypeDatabaseMonitor::Stop()
+    {
+        if (!IsWatching())
+        {
+            return;
+        }
+
+        // DirectoryWatcher may be unloaded before us when the editor is shutting down
+        if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+        {
+            if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+            {
+                DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(DirectoryPath, WatcherHandle);
+            }
+        }
+
+        WatcherHandle.Reset();
+    }
+
+    void FCSharpTypeDatabaseMonitor::ResetBaseline(const FCSharpBlueprintImportDatabase& InImportDatabase)
+    {
+        BaselineCrcs.Empty();
+        FileStates.Empty();
+
+        for (auto& Record : InImportDatabase.GetRecords())
+        {
+            BaselineCrcs.Add(Record.Key, Record.Value);
+
+            // imported files are hashed already, only size and time are needed here
+            const FFileStatData StatData = IFileManager::Get().GetStatData(*FPaths::Combine(DirectoryPath, Record.Key));
+
+            if (StatData.bIsValid)
+            {
+                FFileState& State = FileStates.Add(Record.Key);
+                State.Size = StatData.FileSize;
+                State.ModificationTime = StatData.ModificationTime;
+                State.Crc = Record.Value;
+                State.bHasCrc = true;
+            }
+        }
+
+        bReimportRequired = false;
+
+        RefreshReimportState();
+    }
+
+    bool FCSharpTypeDatabaseMonitor::GetCurrentDatabase(FCSharpBlueprintImportDatabase& OutDatabase) const
+    {
+        TArray<TKeyValuePair<FString, uint32>> Records;
+        Records.Reserve(FileStates.Num());
+
+        for (auto& [FileName, State] : FileStates)
+        {
+            if (!State.bHasCrc)
+            {
+                return false;
+            }
+
+            Records.Emplace(FileName, State.Crc);
+        }
+
+        OutDatabase.LoadFromRecords(MoveTemp(Records));
+
+        return true;
+    }
+
+    void FCSharpTypeDatabaseMonitor::OnDirectoryChanged(const TArray<FFileChangeData>& InChanges)
+    {
+        TSet<FString> ChangedFiles;
+
+        for (const FFileChangeData& Change : InChanges)
+        {
+            if (Change.Filename.EndsWith(TypeDatabaseFileExtension, ESearchCase::IgnoreCase))
+            {
+                ChangedFiles.Add(FPaths::GetCleanFilename(Change.Filename));
+            }
+        }
+
+        for (const FString& FileName : ChangedFiles)
+        {
+            OnFileChanged(FileName);
+        }
+    }
+
+    void FCSharpTypeDatabaseMonitor::OnFileChanged(const FString& InFileName)
+    {
+        const FString FilePath = FPaths::Combine(DirectoryPath, InFileName);
+        const FFileStatData StatData = IFileManager::Get().GetStatData(*FilePath);
+
+        if (!StatData.bIsValid)
+        {
+            // deleted
+            FileStates.Remove(InFileName);
+            RefreshReimportState();
+            return;
+        }
+
+        FFileState& State = FileStates.FindOrAdd(InFileName);
+
+        if (State.bHasCrc && State.Size == StatData.FileSize && State.ModificationTime == StatData.ModificationTime)
+        {
+            return;
+        }
+
+        State.Size = StatData.FileSize;
+        State.ModificationTime = StatData.ModificationTime;
+        State.bHasCrc = false;
+
+        // the file may be changed again before hashing is finished, only the latest result is accepted
+        const int32 Version = ++State.Version;
+
+        Async(EAsyncExecution::ThreadPool, [WeakThis = AsShared().ToWeakPtr(), FilePath, InFileName, Version]()
+        {
+            const uint32 Crc = FCSharpBlueprintImportDatabase::CalcFileCrc32(*FilePath);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, InFileName, Version, Crc]()
+            {
+                if (const TSharedPtr<FCSharpTypeDatabaseMonitor> This = WeakThis.Pin())
+                {
+                    This->OnFileHashed(InFileName, Version, Crc);
+                }
+            });
+        });
+    }
+
+    void FCSharpTypeDatabaseMonitor::OnFileHashed(const FString& InFileName, int32 InVersion, uint32 InCrc)
+    {
+        FFileState* State = FileStates.Find(InFileName);
+
+        if (State == nullptr || State->Version != InVersion)
+        {
+            return;
+        }
+
+        State->Crc = InCrc;
+        State->bHasCrc = true;
+
+        RefreshReimportState();
+    }
+
+    void FCSharpTypeDatabaseMonitor::RefreshReimportState()
+    {
+        bool bRequired = FileStates.Num() != BaselineCrcs.Num();
+
+        for (auto& [FileName, State] : FileStates)
+        {
+            const uint32* BaselineCrc = BaselineCrcs.Find(FileName);
+
+            // files which are still being hashed are not counted until the result arrives
+            if (BaselineCrc == nullptr || (State.bHasCrc && State.Crc != *BaselineCrc))
+            {
+                bRequired = true;
+                break;
+            }
+        }
+
+        const bool bIsNewRequest = bRequired && !bReimportRequired;
+
+        bReimportRequired = bRequired;
+
+        if (bIsNewRequest)
+        {
+            US_LOG(TEXT("C# type database is changed, reimport is required."));
+
+            ReimportRequiredEvent.Broadcast();
+        }
+    }
+}
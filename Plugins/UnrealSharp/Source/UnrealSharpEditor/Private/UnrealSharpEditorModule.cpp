@@ -32,9 +32,12 @@
 #include "Modules/ModuleManager.h"
 #include "Misc/UnrealSharpPaths.h"
 #include "Interfaces/IMainFrameModule.h"
+#include "Framework/Application/SlateApplication.h"
 #include "CSharpBlueprintImportDatabase.h"
+#include "CSharpTypeDatabaseMonitor.h"
 #include "ProfilingDebugging/ScopedTimers.h"
 #include "TypeValidation.h"
+#include "SharpBindingGenSettings.h"
 #include "Classes/UnrealSharpSettings.h"
 #include "ICSharpRuntime.h"
 
@@ -95,8 +98,13 @@ void FUnrealSharpEditorModule::StartupModule()
 
     AddExportDatabaseMenu();
 
+    TypeDatabaseMonitor = MakeShared<UnrealSharp::FCSharpTypeDatabaseMonitor>(UnrealSharp::FUnrealSharpPaths::GetUnrealSharpManagedLibraryDir());
+
     RefreshCSharpImportBlueprintAssets(true);
 
+    TypeDatabaseMonitor->OnReimportRequired().AddRaw(this, &FUnrealSharpEditorModule::OnTypeDatabaseReimportRequired);
+    TypeDatabaseMonitor->Start();
+
     PreBeginPIEHandle = FEditorDelegates::PreBeginPIE.AddRaw(this, &FUnrealSharpEditorModule::OnPreBeginPIE);
     EndPIEHandle = FEditorDelegates::EndPIE.AddRaw(this, &FUnrealSharpEditorModule::OnEndPIE);
 
@@ -111,6 +119,16 @@ void FUnrealSharpEditorModule::ShutdownModule()
 
     PreBeginPIEHandle.Reset();
     EndPIEHandle.Reset();    
+
+    FCoreDelegates::OnEndFrame.Remove(DelayReimportCheckHandle);
+    DelayReimportCheckHandle.Reset();
+
+    if (TypeDatabaseMonitor)
+    {
+        TypeDatabaseMonitor->OnReimportRequired().RemoveAll(this);
+        TypeDatabaseMonitor->Stop();
+        TypeDatabaseMonitor.Reset();
+    }
 }
 
 void FUnrealSharpEditorModule::AddExportDatabaseMenu()
@@ -218,6 +236,11 @@ void FUnrealSharpEditorModule::DoExportDatabase(const FString& InDatabaseFilePat
     else
     {
         US_LOG(TEXT("Type Database File saved successfully : %s"), *InDatabaseFilePath);
+
+        if (GetDefault<USharpBindingGenSettings>()->bExportJsonTypeDatabase)
+        {
+            Document->SaveToJsonFile(*(InDatabaseFilePath + TEXT(".json")));
+        }
     }
 }
 
@@ -337,7 +360,12 @@ bool FUnrealSharpEditorModule::IsReimportRequired(TSharedPtr<UnrealSharp::FCShar
         FScopedDurationTimeLogger RecordCheckDirectory(TEXT("refresh import database"));
 
         OutImportDatabase->LoadFromFile(*ImportDatabasePath);
-        OutNewDataBase->LoadFromDirectory(*ManagedDirectory);
+
+        // changed files are hashed by the monitor in background already, the directory is only scanned when it is not watching
+        if (!TypeDatabaseMonitor || !TypeDatabaseMonitor->IsWatching() || !TypeDatabaseMonitor->GetCurrentDatabase(*OutNewDataBase))
+        {
+            OutNewDataBase->LoadFromDirectory(*ManagedDirectory);
+        }
     }
 
     return *OutNewDataBase != *OutImportDatabase;
@@ -345,7 +373,7 @@ bool FUnrealSharpEditorModule::IsReimportRequired(TSharedPtr<UnrealSharp::FCShar
 
 void FUnrealSharpEditorModule::RefreshCSharpImportBlueprintAssets(bool bForceRecreate)
 {    
-    if (UnrealSharp::FCSharpRuntimeFactory::IsGlobalCSharpRuntimeValid())
+    if (UnrealSharp::FCSharpRuntimeFactory::IsGlobalCSharpRuntimeActive())
     {
         US_LOG_WARN(TEXT("Not allowed to update C# imported assets during game play"));
         return;
@@ -358,6 +386,9 @@ void FUnrealSharpEditorModule::RefreshCSharpImportBlueprintAssets(bool bForceRec
         US_LOG(TEXT("C# database is changed, reimport them now."));
         FScopedDurationTimeLogger RecordCheckDirectory(TEXT("reimport C# types"));
 
+        // the runtime kept alive references types being reimported, next session starts a new one
+        UnrealSharp::FCSharpRuntimeFactory::ShutdownKeptAliveCSharpRuntime();
+
         if (ForceReloadCSharpTypes())
         {
             if (bForceRecreate)
@@ -376,6 +407,12 @@ void FUnrealSharpEditorModule::RefreshCSharpImportBlueprintAssets(bool bForceRec
             ImportDatabase->SaveToFile(*ImportDatabasePath);
         }
     }
+
+    // the crc of imported files become the baseline of the monitor, a failed reimport keeps the old baseline
+    if (ImportDatabase && TypeDatabaseMonitor)
+    {
+        TypeDatabaseMonitor->ResetBaseline(*ImportDatabase);
+    }
 }
 
 bool FUnrealSharpEditorModule::ForceReloadCSharpTypes() // NOLINT
@@ -432,7 +469,13 @@ void FUnrealSharpEditorModule::OnMainFrameCreationFinished(TSharedPtr<SWindow> I
 
 void FUnrealSharpEditorModule::OnMainFrameWindowActivated()
 {
-    if (UnrealSharp::FCSharpRuntimeFactory::IsGlobalCSharpRuntimeValid())
+    // the monitor hashes changed files in background, so the full check is only needed when it reports a change
+    if (TypeDatabaseMonitor && TypeDatabaseMonitor->IsWatching() && !TypeDatabaseMonitor->IsReimportRequired())
+    {
+        return;
+    }
+
+    if (UnrealSharp::FCSharpRuntimeFactory::IsGlobalCSharpRuntimeActive())
     {
         TSharedPtr<UnrealSharp::FCSharpBlueprintImportDatabase> ImportDatabase, NewDatabase;
 
@@ -449,4 +492,25 @@ void FUnrealSharpEditorModule::OnHandleDelayReimport()
     this->RefreshCSharpImportBlueprintAssets();
 
     FCoreDelegates::OnEndFrame.RemoveAll(this);
+    DelayReimportCheckHandle.Reset();
+}
+
+void FUnrealSharpEditorModule::OnTypeDatabaseReimportRequired()
+{
+    // the hash may be finished after the window is activated, the change should not wait for the next focus change
+    if (!FSlateApplication::IsInitialized() || !FSlateApplication::Get().IsActive() || DelayReimportCheckHandle.IsValid())
+    {
+        return;
+    }
+
+    // the monitor reports it while reimporting too, so check it later
+    DelayReimportCheckHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FUnrealSharpEditorModule::OnHandleDelayReimportCheck);
+}
+
+void FUnrealSharpEditorModule::OnHandleDelayReimportCheck()
+{
+    FCoreDelegates::OnEndFrame.Remove(DelayReimportCheckHandle);
+    DelayReimportCheckHandle.Reset();
+
+    OnMainFrameWindowActivated();
 }
@@ -62,6 +62,9 @@ namespace UnrealSharp
         bool            ProcessDelegate(FCSharpGeneratedTypeInfo* InInfo, const FPropertyDefinition& InPropertyDefinition);
         bool            ProcessAutoAttachComponent(FCSharpGeneratedTypeInfo* InInfo, const FClassTypeDefinition* InClassTypeDefinition, const FPropertyDefinition& InPropertyDefinition, TSet<FName>& InProcessedNames);
 
+        void            ProcessClasses(const TArray<FCSharpGeneratedTypeInfo*>& InClassInfos);
+        void            SavePackages();
+
     private:
         TSharedPtr<FTypeDefinitionDocument>                             Document;
         TSortedMap<FString, TSharedPtr<FEnumTypeDefinition>>            EnumTypes;
@@ -69,5 +72,8 @@ namespace UnrealSharp
         TSortedMap<FString, TSharedPtr<FClassTypeDefinition>>           ClassTypes;
 
         TUniquePtr<FCSharpBlueprintGeneratorDatabase>                   Database;
+
+        // generated assets are saved together after all types are processed
+        TArray<const FCSharpGeneratedTypeInfo*>                         PendingSaveTypes;
     };
 }
@@ -75,6 +75,10 @@ namespace UnrealSharp
 
         void                                    Accept(const TFunction<void(FCSharpGeneratedTypeInfo&)>& InVisitor);
 
+        // all types sorted by dependencies, super class and the struct/enum types used by properties come first
+        TArray<FCSharpGeneratedTypeInfo*>       GetTypesInDependencyOrder() const;
+        void                                    GetDependencies(const FCSharpGeneratedTypeInfo& InInfo, TArray<FCSharpGeneratedTypeInfo*>& OutDependencies) const;
+
         FCSharpGeneratedTypeInfo*               FindTypeByName(const FString& InName);
         const FCSharpGeneratedTypeInfo*         FindTypeByName(const FString& InName) const;
 
@@ -94,6 +98,8 @@ namespace UnrealSharp
         void                                    LoadExistsInfo();
         void                                    PrepareTypeStates();
         void                                    PrepareTypes();        
+        void                                    PropagateTypeStates();
+        void                                    GetPropertyDependencies(const FPropertyDefinition& InPropertyDefinition, TArray<FCSharpGeneratedTypeInfo*>& OutDependencies) const;
         void                                    CleanCSharpBlueprintType(const TSharedPtr<FCSharpGeneratedTypeInfo>& InTypeInfo, const TSharedPtr<FBaseTypeDefinition>& InTypeDefinition);
 
         void                                    NewCSharpBlueprintClassIfNeed(UPackage* InPackage, const TSharedPtr<FClassTypeDefinition>& InClassDefinition, const TSharedPtr<FCSharpGeneratedTypeInfo>& InTypeInfo);
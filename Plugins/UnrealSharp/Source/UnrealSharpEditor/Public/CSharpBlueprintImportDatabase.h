@@ -38,11 +38,14 @@ namespace UnrealSharp
         bool                LoadFromFile(const TCHAR* InFilePath);
         bool                SaveToFile(const TCHAR* InFilePath);
         bool                LoadFromDirectory(const TCHAR* InDirectoryPath);
+        void                LoadFromRecords(TArray<TKeyValuePair<FString, uint32>>&& InRecords);
 
         bool                IsEqualTo(const FCSharpBlueprintImportDatabase& InDatabase) const;
 
         void                Reset();
 
+        const TArray<TKeyValuePair<FString, uint32>>& GetRecords() const { return Records; }
+
         bool operator == (const FCSharpBlueprintImportDatabase& InOther) const;
         bool operator != (const FCSharpBlueprintImportDatabase& InOther) const;
 
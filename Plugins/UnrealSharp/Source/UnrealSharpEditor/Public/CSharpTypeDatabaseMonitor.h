@@ -0,0 +1,84 @@
+/*
+    MIT License
+
+    Copyright (c) 2024 UnrealSharp
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealSharp
+*/
+#pragma once
+
+#include "IDirectoryWatcher.h"
+
+namespace UnrealSharp
+{
+    class FCSharpBlueprintImportDatabase;
+
+    /*
+    * Watches C# type database files(*.tdb) with DirectoryWatcher, instead of reading and hashing all of them every time the editor gains focus.
+    * The size and modification time of each file is recorded, only files that are really touched are hashed on a background thread, 
+    * and a reimport is requested when their crc differs from the imported ones.
+    */
+    class UNREALSHARPEDITOR_API FCSharpTypeDatabaseMonitor : public TSharedFromThis<FCSharpTypeDatabaseMonitor>
+    {
+    public:
+        DECLARE_MULTICAST_DELEGATE(FOnReimportRequired);
+
+        FCSharpTypeDatabaseMonitor(const FString& InDirectoryPath);
+        ~FCSharpTypeDatabaseMonitor();
+
+        void                            Start();
+        void                            Stop();
+
+        // called after importing, crc of imported files are the new baseline
+        void                            ResetBaseline(const FCSharpBlueprintImportDatabase& InImportDatabase);
+
+        bool                            IsWatching() const { return WatcherHandle.IsValid(); }
+        bool                            IsReimportRequired() const { return bReimportRequired; }
+
+        // build the database of current files from the crc hashed in background, fails if some files are still being hashed
+        bool                            GetCurrentDatabase(FCSharpBlueprintImportDatabase& OutDatabase) const;
+
+        FOnReimportRequired&            OnReimportRequired() { return ReimportRequiredEvent; }
+
+    private:
+        struct FFileState
+        {
+            int64                       Size = -1;
+            FDateTime                   ModificationTime;
+            uint32                      Crc = 0;
+            bool                        bHasCrc = false;
+            int32                       Version = 0;
+        };
+
+        void                            OnDirectoryChanged(const TArray<FFileChangeData>& InChanges);
+        void                            OnFileChanged(const FString& InFileName);
+        void                            OnFileHashed(const FString& InFileName, int32 InVersion, uint32 InCrc);
+        void                            RefreshReimportState();
+
+    private:
+        FString                         DirectoryPath;
+        FDelegateHandle                 WatcherHandle;
+        TMap<FString, FFileState>       FileStates;
+        TMap<FString, uint32>           BaselineCrcs;
+        bool                            bReimportRequired = false;
+        FOnReimportRequired             ReimportRequiredEvent;
+    };
+}
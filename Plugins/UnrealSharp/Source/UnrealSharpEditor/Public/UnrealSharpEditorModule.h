@@ -30,6 +30,7 @@
 namespace UnrealSharp
 {
     class FCSharpBlueprintImportDatabase;
+    class FCSharpTypeDatabaseMonitor;
     enum class ETypeValidationFlags;
 
     enum class EUnrealTypeDatabaseExportFlags
@@ -76,9 +77,13 @@ private:
     void                        OnMainFrameCreationFinished(TSharedPtr<SWindow> InRootWindow, bool bIsRunningStartupDialog);
     void                        OnMainFrameWindowActivated();
     void                        OnHandleDelayReimport();
+    void                        OnTypeDatabaseReimportRequired();
+    void                        OnHandleDelayReimportCheck();
 private:
     FDelegateHandle             PreBeginPIEHandle, EndPIEHandle; // NOLINT
+    FDelegateHandle             DelayReimportCheckHandle;
     FString                     ImportDatabasePath;    
+    TSharedPtr<UnrealSharp::FCSharpTypeDatabaseMonitor> TypeDatabaseMonitor;
     bool                        bNeedReimportWhenPlaying = false;
 };
 
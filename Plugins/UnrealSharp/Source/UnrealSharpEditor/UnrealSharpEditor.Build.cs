@@ -52,6 +52,7 @@ public class UnrealSharpEditor : ModuleRules
                 "UnrealSharp",
                 "AssetRegistry",
                 "BlueprintGraph",
+                "Kismet",
                 "AssetTools",
                 "MainFrame",
                 "Json"
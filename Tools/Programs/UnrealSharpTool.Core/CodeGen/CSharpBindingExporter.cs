@@ -1,4 +1,7 @@
 ﻿using System.Diagnostics;
+using System.Security.Cryptography;
+using System.Text;
+using System.Text.RegularExpressions;
 using UnrealSharp.Utils.Misc;
 using UnrealSharpTool.Core.Generation;
 using UnrealSharpTool.Core.TypeInfo;
@@ -17,6 +20,22 @@ public class CSharpBindingExporter
     /// </summary>
     public readonly BindingContext Context;
 
+    /// <summary>
+    /// Gets or sets a value indicating whether to export all types even if they are not changed since last export.
+    /// </summary>
+    /// <value><c>true</c> if force export; otherwise, <c>false</c>.</value>
+    public bool ForceExport { get; set; }
+
+    /// <summary>
+    /// The type hashes
+    /// </summary>
+    private readonly Dictionary<BaseTypeDefinition, byte[]> _typeHashes = new();
+
+    /// <summary>
+    /// The identifier regex, used to find dependency types in C++ type names, eg: TArray&lt;TObjectPtr&lt;UObject&gt;&gt;
+    /// </summary>
+    private static readonly Regex IdentifierRegex = new("[A-Za-z_][A-Za-z0-9_]*", RegexOptions.Compiled);
+
     /// <summary>
     /// Initializes a new instance of the <see cref="CSharpBindingExporter"/> class.
     /// </summary>
@@ -36,53 +55,188 @@ public class CSharpBindingExporter
         var totalCount = 0;
         var skipCount = 0;
         var writeCount = 0;
+        var upToDateCount = 0;
 
         foreach(var projectWithTypes in Context.ProjectTypeMapping)
         {
             var exportRootDirectory = Path.Combine(Context.UnrealProjectDirectory, $"GameScripts/Game/{projectWithTypes.Key}/Bindings/{Context.SchemaType}");
+            var manifestPath = Path.Combine(Context.UnrealProjectDirectory, $"Intermediate/UnrealSharp/{projectWithTypes.Key}.{Context.SchemaType}.manifest.json");
+            var manifest = BindingExportManifest.Load(manifestPath, exportRootDirectory);
 
-            using var exportScope = new ScopedExporter(Context.UnrealProjectDirectory, exportRootDirectory);
-    
-            foreach (var type in projectWithTypes.Value)
+            using (var exportScope = new ScopedExporter(Context.UnrealProjectDirectory, exportRootDirectory))
             {
-                var exportDirectory = Path.Combine(exportRootDirectory, type.PackageName!);
+                // walk the export directory to find expired files when force export
+                exportScope.Manifest = ForceExport ? null : manifest;
 
-                var exporter = CreateExporter(exportDirectory, type);
-
-                if (exporter == null)
+                foreach (var type in projectWithTypes.Value)
                 {
-                    Logger.LogWarning($"Skip export type: {type}");
-                    continue;
+                    var exportDirectory = Path.Combine(exportRootDirectory, type.PackageName!);
+
+                    var exporter = CreateExporter(exportDirectory, type);
+
+                    if (exporter == null)
+                    {
+                        Logger.LogWarning($"Skip export type: {type}");
+                        continue;
+                    }
+
+                    ++totalCount;
+
+                    exportScope.AddFile(exporter.TargetFile);
+
+                    var fingerprint = ComputeFingerprint(type);
+
+                    if (!ForceExport && manifest.IsUpToDate(exporter.TargetFile, fingerprint))
+                    {
+                        ++upToDateCount;
+                        continue;
+                    }
+
+                    var result = exporter.Export();
+
+                    switch (result)
+                    {
+                        case ECodeWriterSaveResult.Failure:
+                            throw new Exception($"Failed Export {type} to path: {exporter.TargetFile}.");
+                        case ECodeWriterSaveResult.IgnoreWhenNoChanges:
+                            ++skipCount;
+                            break;
+                        case ECodeWriterSaveResult.Success:
+                            ++writeCount;
+                            break;
+                    }
+
+                    if(!Debugger.IsAttached && result == ECodeWriterSaveResult.Success)
+                    {
+                        Logger.Log($"  Export: {exporter.TargetFile}");
+                    }
+
+                    manifest.Record(exporter.TargetFile, fingerprint);
                 }
+            }
+
+            manifest.Save(manifestPath);
+        }
+
+        Logger.Log($"Finish export C# binding codes, process {totalCount} files, write {writeCount} files, skip {skipCount} files[no changes], skip {upToDateCount} files[same fingerprint].");
+
+        return true;
+    }
+
+    /// <summary>
+    /// Computes the fingerprint of a type.
+    /// The generated code of a type depends on the type itself, the types it references and the export context,
+    /// so all of them are included.
+    /// </summary>
+    /// <param name="type">The type.</param>
+    /// <returns>System.String.</returns>
+    protected virtual string ComputeFingerprint(BaseTypeDefinition type)
+    {
+        using var hash = IncrementalHash.CreateHash(HashAlgorithmName.SHA256);
+
+        hash.AppendData(Encoding.UTF8.GetBytes($"{CoreVersion.GeneratorVersion}|{Context.SchemaType}|{Context.UnrealVersion}|{Context.Document.DocumentAttributes}"));
+        hash.AppendData(GetTypeHash(type));
+
+        if (type is ClassTypeDefinition classType)
+        {
+            hash.AppendData(BitConverter.GetBytes(classType.IsNativeBindingSuperType));
+
+            foreach (var function in classType.Functions.Where(Context.IsFastInvokeFunction))
+            {
+                hash.AppendData(Encoding.UTF8.GetBytes($"fast:{function.Name}"));
+            }
+        }
+
+        foreach (var dependency in GetDependencyTypes(type))
+        {
+            hash.AppendData(Encoding.UTF8.GetBytes($"{dependency.CppName}|{Context.Document.IsFastAccessStructType(dependency.CppName!)}"));
+            hash.AppendData(GetTypeHash(dependency));
+        }
 
-                ++totalCount;
+        return Convert.ToHexString(hash.GetHashAndReset());
+    }
 
-                var result = exporter.Export();
+    /// <summary>
+    /// Gets the type hash.
+    /// </summary>
+    /// <param name="type">The type.</param>
+    /// <returns>System.Byte[].</returns>
+    private byte[] GetTypeHash(BaseTypeDefinition type)
+    {
+        if (!_typeHashes.TryGetValue(type, out var hash))
+        {
+            hash = TypeDefinitionBinarySerializer.ComputeTypeHash(type);
+            _typeHashes.Add(type, hash);
+        }
+
+        return hash;
+    }
 
-                switch (result)
+    /// <summary>
+    /// Gets the types referenced by super class, interfaces, properties and function parameters, in name order.
+    /// </summary>
+    /// <param name="type">The type.</param>
+    /// <returns>IEnumerable&lt;BaseTypeDefinition&gt;.</returns>
+    private IEnumerable<BaseTypeDefinition> GetDependencyTypes(BaseTypeDefinition type)
+    {
+        var names = new SortedSet<string>(StringComparer.Ordinal);
+
+        if (type is ClassTypeDefinition classType)
+        {
+            names.Add(classType.SuperName);
+            names.UnionWith(classType.Interfaces);
+
+            foreach (var function in classType.Functions)
+            {
+                CollectDependencyNames(function.Properties, names);
+            }
+        }
+
+        if (type is StructTypeDefinition structType)
+        {
+            CollectDependencyNames(structType.Properties, names);
+        }
+
+        foreach (var name in names)
+        {
+            var dependency = Context.FindType(name);
+
+            if (dependency != null && dependency != type)
+            {
+                yield return dependency;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Collects the dependency names.
+    /// </summary>
+    /// <param name="properties">The properties.</param>
+    /// <param name="names">The names.</param>
+    private static void CollectDependencyNames(IEnumerable<PropertyDefinition> properties, SortedSet<string> names)
+    {
+        foreach (var property in properties)
+        {
+            foreach (var typeName in new[] { property.CppTypeName, property.MetaClass })
+            {
+                if (string.IsNullOrEmpty(typeName))
                 {
-                    case ECodeWriterSaveResult.Failure:
-                        throw new Exception($"Failed Export {type} to path: {exporter.TargetFile}.");
-                    case ECodeWriterSaveResult.IgnoreWhenNoChanges:
-                        ++skipCount;
-                        break;
-                    case ECodeWriterSaveResult.Success:
-                        ++writeCount;
-                        break;
+                    continue;
                 }
 
-                if(!Debugger.IsAttached && result == ECodeWriterSaveResult.Success)
+                foreach (Match match in IdentifierRegex.Matches(typeName))
                 {
-                    Logger.Log($"  Export: {exporter.TargetFile}");
+                    names.Add(match.Value);
                 }
-
-                exportScope.AddFile(exporter.TargetFile);
             }
-        }
 
-        Logger.Log($"Finish export C# binding codes, process {totalCount} files, write {writeCount} files, skip {skipCount} files[no changes].");
+            CollectDependencyNames(property.InnerProperties, names);
 
-        return true;
+            if (property.SignatureFunction != null)
+            {
+                CollectDependencyNames(property.SignatureFunction.Properties, names);
+            }
+        }
     }
 
     /// <summary>
@@ -533,7 +533,11 @@ public class ClassTypeExporter : StructTypeExporter
         {
             if(usage.HasFlag(ELocalUsageScenarioType.Delegate))
             {
-                Writer.Write($"MetaInteropUtils.BindFunctionPropertyMetaCache(typeof({name}), StaticClass(), \"{typeDefinition.Name}\");");
+                WriteBindPropertyMetaCaches(
+                    typeDefinition, 
+                    properties, 
+                    (propertyNames, count) => $"MetaInteropUtils.LoadFunctionPropertyMetaCaches(StaticClass(), \"{typeDefinition.Name}\", {propertyNames}, {count})"
+                    );
             }
             else
             {
@@ -542,7 +546,11 @@ public class ClassTypeExporter : StructTypeExporter
         }
         else if (properties.Any())
         {
-            Writer.Write($"MetaInteropUtils.BindPropertyMetaCache(typeof({name}), StaticClass().GetNativePtr());");
+            WriteBindPropertyMetaCaches(
+                typeDefinition, 
+                properties, 
+                (propertyNames, count) => $"MetaInteropUtils.LoadClassPropertyMetaCaches(ref Z_{ClassType.Name}Class, {ClassType.Name}Path, {propertyNames}, {count})"
+                );
         }
     }
 
@@ -391,7 +391,11 @@ public class ScriptStructTypeExporter : StructTypeExporter
         }
         else if(properties.Any())
         {
-            Writer.Write($"MetaInteropUtils.LoadStructPropertyMetaCache(typeof({name}), {typeDefinition.Name}Path);");
+            WriteBindPropertyMetaCaches(
+                typeDefinition, 
+                properties, 
+                (propertyNames, count) => $"MetaInteropUtils.LoadStructPropertyMetaCaches({typeDefinition.Name}Path, {propertyNames}, {count})"
+                );
         }
     }
     #endregion
@@ -265,7 +265,38 @@ public abstract class StructTypeExporter : BaseTypeExporter
     {
         if (typeDefinition.IsFunction)
         {
-            Writer.Write($"MetaInteropUtils.LoadFunctionMetaCache(typeof({name}), ref {typeDefinition.Name}Invocation, StaticClass(), \"{typeDefinition.Name}\");");
+            WriteBindPropertyMetaCaches(
+                typeDefinition, 
+                properties, 
+                (propertyNames, count) => $"MetaInteropUtils.LoadFunctionMetaCaches(ref {typeDefinition.Name}Invocation, StaticClass(), \"{typeDefinition.Name}\", {propertyNames}, {count})"
+                );
+        }
+    }
+
+    /// <summary>
+    /// Writes the code to bind all property meta fields without reflection.
+    /// all property pointers and offsets are queried by one interop call and assigned to the fields directly.
+    /// </summary>
+    /// <param name="typeDefinition">The type definition.</param>
+    /// <param name="properties">The properties.</param>
+    /// <param name="loadExpression">The load expression, accept the packed property names and the count of properties.</param>
+    protected void WriteBindPropertyMetaCaches(StructTypeDefinition typeDefinition, IEnumerable<PropertyDefinition> properties, Func<string, int, string> loadExpression)
+    {
+        var boundProperties = properties.Where(property => property.Name!.IsValidCSharpIdentifier()).ToList();
+        var propertyNames = string.Join(";", boundProperties.Select(x => x.Name));
+
+        Writer.Write($"var __metaCaches = {loadExpression($"\"{propertyNames}\"", boundProperties.Count)};");
+
+        for (var i = 0; i < boundProperties.Count; ++i)
+        {
+            var property = boundProperties[i];
+
+            Writer.Write($"{property.Name}_Offset = (short)__metaCaches[{i}].Offset;");
+
+            if (typeDefinition.IsFunction || ShouldWritePropertyField(typeDefinition, property))
+            {
+                Writer.Write($"{property.Name}_Property = __metaCaches[{i}].PropertyPointer;");
+            }
         }
     }
     #endregion
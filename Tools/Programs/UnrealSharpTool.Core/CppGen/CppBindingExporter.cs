@@ -1,4 +1,5 @@
 ﻿using System.Text;
+using System.Text.RegularExpressions;
 using UnrealSharp.Utils.Extensions;
 using UnrealSharp.Utils.Misc;
 using UnrealSharpTool.Core.CodeGen;
@@ -8,6 +9,38 @@ using UnrealSharpTool.Core.Utils;
 
 namespace UnrealSharpTool.Core.CppGen;
 
+/// <summary>
+/// Class CppBindingExportGroup.
+/// All classes exported to one generated translation unit.
+/// </summary>
+public class CppBindingExportGroup
+{
+    /// <summary>
+    /// The name of this group, used as file name suffix and register function suffix, eg: Engine_3
+    /// </summary>
+    public readonly string Name;
+
+    /// <summary>
+    /// The classes and their exportable functions, sorted by class name.
+    /// </summary>
+    public readonly List<KeyValuePair<ClassTypeDefinition, List<FunctionTypeDefinition>>> Classes = [];
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="CppBindingExportGroup"/> class.
+    /// </summary>
+    /// <param name="name">The name.</param>
+    public CppBindingExportGroup(string name)
+    {
+        Name = name;
+    }
+
+    /// <summary>
+    /// Gets the function count.
+    /// </summary>
+    /// <value>The function count.</value>
+    public int FunctionCount => Classes.Sum(x => x.Value.Count);
+}
+
 public class CppBindingExporter
 {
     /// <summary>
@@ -19,9 +52,13 @@ public class CppBindingExporter
     public readonly Dictionary<ClassTypeDefinition, List<FunctionTypeDefinition>> ClassToFunctionMapping = new();
     public readonly HashSet<FunctionTypeDefinition> ExportableFunctions = [];
     public readonly List<FunctionTypeDefinition> UnsupportedFunctions = [];
-    public readonly List<List<KeyValuePair<ClassTypeDefinition, List<FunctionTypeDefinition>>>> ExportGroupList =
-        [];
+    public readonly List<CppBindingExportGroup> ExportGroupList = [];
 
+    /// <summary>
+    /// The expected function count in one file.
+    /// Classes are distributed into files by module and the hash of class name, so adding or removing functions
+    /// only dirties the file containing the class, this value only decides the bucket count of each module.
+    /// </summary>
     public const int MaxCountInOneFile = 800;
     public const string FolderName = "UnrealSharpBinding";
     public const string FileNameTemplate = "UnrealSharpInvokeBinding";
@@ -63,13 +100,11 @@ public class CppBindingExporter
             scopedExporter.Extensions = [".h", ".cpp", ".inl", ".cxx"];
             scopedExporter.OnDeleteFileDelegate = _ => { ++DeleteFileCount; };
 
-            for (var index = 0; index < ExportGroupList.Count; ++index)
+            foreach (var target in ExportGroupList)
             {
-                var target = ExportGroupList[index];
-
-                var implementWriter = new CppBindingCodeWriter($"{RootDirectory}/Details/{FileNameTemplate}_{index}.cpp");
+                var implementWriter = new CppBindingCodeWriter($"{RootDirectory}/Details/{FileNameTemplate}_{target.Name}.cpp");
 
-                WriteImplement(implementWriter, target, index);
+                WriteImplement(implementWriter, target);
 
                 if (implementWriter.Save() == ECodeWriterSaveResult.Success)
                 {
@@ -147,13 +182,24 @@ public class CppBindingExporter
         return "";
     }
 
-    private static List<string> GetIncludes(IEnumerable<ClassTypeDefinition> classes)
+    private static List<string> GetIncludes(CppBindingExportGroup group)
     {
-        var includes = new HashSet<string>();
+        var includes = new HashSet<string>
+        {
+            "CoreMinimal.h",
+            "Misc/UnrealInteropFunctions.h"
+        };
 
-        foreach (var item in classes)
+        // US_STRING_TO_TCHAR is the only thing generated codes need from CSharpStructures.h
+        if (group.Classes.Any(x => x.Value.Any(f => f.Properties.Any(p => p.IsString))))
         {
-            var inc = GetClassTypeIncludePath(item);
+            includes.Add("Misc/CSharpStructures.h");
+        }
+
+        // only headers of classes in this file, parameter types are already visible through them
+        foreach (var item in group.Classes)
+        {
+            var inc = GetClassTypeIncludePath(item.Key);
 
             if(inc.IsNotNullOrEmpty())
             {
@@ -162,7 +208,7 @@ public class CppBindingExporter
         }
 
         var list = includes.ToList();
-        list.Sort();
+        list.Sort(StringComparer.Ordinal);
         return list;
     }
 
@@ -221,15 +267,14 @@ public class CppBindingExporter
     #endregion
 
     #region Implement Write
-    private void WriteImplement(CppBindingCodeWriter writer, List<KeyValuePair<ClassTypeDefinition, List<FunctionTypeDefinition>>> targets, int index)
+    private void WriteImplement(CppBindingCodeWriter writer, CppBindingExportGroup group)
     {
+        var targets = group.Classes;
+
         // disable resharper warnings for generated codes.
         writer.Write("// ReSharper disable all");
-        writer.Write("#include \"CoreMinimal.h\"");
-        writer.Write("#include \"Misc/UnrealInteropFunctions.h\"");
-        writer.Write("#include \"Misc/CSharpStructures.h\"");
 
-        var includes = GetIncludes(targets.Select(x => x.Key));
+        var includes = GetIncludes(group);
         foreach (var i in includes)
         {
             writer.Write($"#include \"{i}\"");
@@ -267,7 +312,7 @@ public class CppBindingExporter
             writer.WriteNewLine();
 
             writer.WriteCommonComment("Export register function");
-            writer.Write($"void RegisterFastInvokeApis_{index}(FUnrealInteropFunctions* InInteropFunctions)");
+            writer.Write($"void RegisterFastInvokeApis_{group.Name}(FUnrealInteropFunctions* InInteropFunctions)");
             {
                 using var functionScope = new ScopedCodeWriter(writer);
 
@@ -390,9 +435,9 @@ public class CppBindingExporter
             using var scopedCodeWriter = new ScopedCodeWriter(writer);
 
             {
-                for (var i = 0; i < ExportGroupList.Count; ++i)
+                foreach (var group in ExportGroupList)
                 {
-                    writer.Write($"extern void RegisterFastInvokeApis_{i}(FUnrealInteropFunctions* InInteropFunctions);");
+                    writer.Write($"extern void RegisterFastInvokeApis_{group.Name}(FUnrealInteropFunctions* InInteropFunctions);");
                 }
             }                
 
@@ -402,9 +447,9 @@ public class CppBindingExporter
             {
                 using var registerScope = new ScopedCodeWriter(writer);
 
-                for(var i = 0; i < ExportGroupList.Count; ++i)
+                foreach (var group in ExportGroupList)
                 {
-                    writer.Write($"RegisterFastInvokeApis_{i}(InInteropFunctions);");
+                    writer.Write($"RegisterFastInvokeApis_{group.Name}(InInteropFunctions);");
                 }
             }
         }
@@ -460,22 +505,56 @@ public class CppBindingExporter
                 if(supportedFunctionOfClass.Count > 0)
                 {
                     ClassToFunctionMapping.Add(classType, supportedFunctionOfClass);
+                }
+            }
+        }
 
-                    if (ExportGroupList.Count <= 0 || ExportGroupList.Last().Sum(x=>x.Value.Count) + supportedFunctionOfClass.Count > MaxCountInOneFile)
-                    {
-                        ExportGroupList.Add([]);
-                    }
+        BuildExportGroups();
+    }
 
-                    var batchedList = ExportGroupList.Last();
+    /// <summary>
+    /// Distribute classes into files.
+    /// Each module owns its own files, and a class always goes to bucket [hash(class name) % bucket count],
+    /// the bucket count is a power of two decided by the function count of the module,
+    /// so the file of a class only changes when the module grows or shrinks across a power of two.
+    /// </summary>
+    private void BuildExportGroups()
+    {
+        var modules = ClassToFunctionMapping.GroupBy(x => GetModuleName(x.Key)).OrderBy(x => x.Key, StringComparer.Ordinal);
 
-                    Logger.Assert(batchedList.Sum(x => x.Value.Count) < MaxCountInOneFile);
+        foreach (var module in modules)
+        {
+            var functionCount = module.Sum(x => x.Value.Count);
+            var bucketCount = 1;
 
-                    batchedList.Add(new KeyValuePair<ClassTypeDefinition, List<FunctionTypeDefinition>>(classType, supportedFunctionOfClass));
-                }
+            while (bucketCount * MaxCountInOneFile < functionCount)
+            {
+                bucketCount *= 2;
+            }
+
+            var groups = new CppBindingExportGroup?[bucketCount];
+
+            foreach (var pair in module.OrderBy(x => x.Key.CppName, StringComparer.Ordinal))
+            {
+                var bucket = (int)(pair.Key.CppName!.GetDeterministicHashCode() % (uint)bucketCount);
+
+                groups[bucket] ??= new CppBindingExportGroup(bucketCount > 1 ? $"{module.Key}_{bucket}" : module.Key);
+                groups[bucket]!.Classes.Add(pair);
             }
+
+            ExportGroupList.AddRange(groups.Where(x => x != null).Select(x => x!));
         }
     }
 
+    private static string GetModuleName(ClassTypeDefinition classTypeDefinition)
+    {
+        var packageName = classTypeDefinition.PackageName ?? "";
+        var moduleName = packageName[(packageName.LastIndexOf('/') + 1)..];
+
+        // the name is used in file name and C++ function name
+        return Regex.Replace(moduleName, @"[^A-Za-z0-9_]", "_");
+    }
+
     public bool IsCppExportableFunction(ClassTypeDefinition classTypeDefinition, FunctionTypeDefinition function)
     {
         return function.IsPublic &&
@@ -15,17 +15,19 @@ internal class RoslynDebugInformation : IDebugInformation
     public readonly List<CSharpSourceFile> SourceFiles = [];
     public readonly Dictionary<string, RoslynSymbolInfo> Symbols = new();
                         
-    public RoslynDebugInformation(IEnumerable<string> sourceFiles)
+    public RoslynDebugInformation(IEnumerable<string> sourceFiles) :
+        this(sourceFiles.Where(x => x.IsFileExists()).Select(x => new CSharpSourceFile(x, "")))
     {
-        foreach(var file in sourceFiles)
+    }
+
+    // use parsed files directly
+    public RoslynDebugInformation(IEnumerable<CSharpSourceFile> sourceFiles)
+    {
+        foreach(var sourceFile in sourceFiles)
         {
-            if(file.IsFileExists())
-            {
-                var sourceFile = new CSharpSourceFile(file, "");
-                SourceFiles.Add(sourceFile);
+            SourceFiles.Add(sourceFile);
 
-                BuildSymbolDictionary(sourceFile);
-            }
+            BuildSymbolDictionary(sourceFile);
         }
     }
 
@@ -0,0 +1,268 @@
+﻿using System.Collections.Concurrent;
+using System.Security.Cryptography;
+using System.Text;
+using Microsoft.CodeAnalysis;
+using Microsoft.CodeAnalysis.CSharp;
+using Newtonsoft.Json;
+using UnrealSharp.Utils.Extensions.IO;
+using UnrealSharp.Utils.Misc;
+using UnrealSharpTool.Core.Utils;
+
+namespace UnrealSharpTool.Core.TypeInfo.Roslyn;
+
+/// <summary>
+/// Class RoslynTypeDefinitionCacheInfo.
+/// Saved beside the cached document.
+/// </summary>
+internal class RoslynTypeDefinitionCacheInfo
+{
+    /// <summary>
+    /// Gets or sets the key of the inputs.
+    /// </summary>
+    /// <value>The key.</value>
+    public string Key { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the classes whose super type is a native binding type.
+    /// This flag is not saved in type database, so it is saved here.
+    /// </summary>
+    /// <value>The native binding super type classes.</value>
+    public List<string> NativeBindingSuperTypeClasses { get; set; } = [];
+}
+
+/// <summary>
+/// Class RoslynTypeDefinitionCache.
+/// Avoid repeated work of RoslynTypeDefinitionDocumentFactory:
+///   the generated document is saved in Intermediate/UnrealSharp and reused until any input changes.
+///   syntax trees, metadata references and compilations are kept in memory, 
+///   so a long-lived process(-m server) only parses changed files and updates the compilation incrementally.
+/// </summary>
+internal static class RoslynTypeDefinitionCache
+{
+    /// <summary>
+    /// The source files
+    /// </summary>
+    private static readonly ConcurrentDictionary<string, CSharpSourceFile> SourceFiles = new();
+
+    /// <summary>
+    /// The references
+    /// </summary>
+    private static readonly ConcurrentDictionary<string, (DateTime LastWriteTime, PortableExecutableReference Reference)> References = new();
+
+    /// <summary>
+    /// The compilations, key is project name
+    /// </summary>
+    private static readonly ConcurrentDictionary<string, CSharpCompilation> Compilations = new();
+
+    #region Memory Cache
+    /// <summary>
+    /// Gets the source file, the cached syntax tree is used if the file is not changed.
+    /// </summary>
+    /// <param name="filePath">The file path.</param>
+    /// <param name="projectName">Name of the project.</param>
+    /// <returns>CSharpSourceFile.</returns>
+    public static CSharpSourceFile GetSourceFile(string filePath, string projectName)
+    {
+        var key = $"{projectName}|{filePath.CanonicalPath()}";
+
+        if (SourceFiles.TryGetValue(key, out var cached) && cached.IsUpToDate())
+        {
+            return cached;
+        }
+
+        var sourceFile = new CSharpSourceFile(filePath, projectName, cached);
+
+        SourceFiles[key] = sourceFile;
+
+        return sourceFile;
+    }
+
+    /// <summary>
+    /// Gets the source files, files are parsed in parallel.
+    /// </summary>
+    /// <param name="filePaths">The file paths.</param>
+    /// <param name="projectName">Name of the project.</param>
+    /// <returns>List&lt;CSharpSourceFile&gt;.</returns>
+    public static List<CSharpSourceFile> GetSourceFiles(IEnumerable<string> filePaths, string projectName)
+    {
+        return filePaths.AsParallel().AsOrdered().Select(x => GetSourceFile(x, projectName)).ToList();
+    }
+
+    /// <summary>
+    /// Gets the metadata reference, the loaded reference is used if the file is not changed.
+    /// </summary>
+    /// <param name="filePath">The file path.</param>
+    /// <returns>PortableExecutableReference.</returns>
+    public static PortableExecutableReference GetReference(string filePath)
+    {
+        var lastWriteTime = File.GetLastWriteTimeUtc(filePath);
+
+        if (References.TryGetValue(filePath, out var cached) && cached.LastWriteTime == lastWriteTime)
+        {
+            return cached.Reference;
+        }
+
+        var reference = MetadataReference.CreateFromFile(filePath);
+
+        References[filePath] = (lastWriteTime, reference);
+
+        return reference;
+    }
+
+    /// <summary>
+    /// Gets the compilation.
+    /// If there is a compilation of this project with the same references, 
+    /// only changed syntax trees are replaced, so Roslyn can reuse the results of unchanged trees.
+    /// </summary>
+    /// <param name="projectName">Name of the project.</param>
+    /// <param name="trees">The trees.</param>
+    /// <param name="references">The references.</param>
+    /// <param name="options">The options.</param>
+    /// <returns>CSharpCompilation.</returns>
+    public static CSharpCompilation GetCompilation(string projectName, IReadOnlyList<SyntaxTree> trees, IReadOnlyList<MetadataReference> references, CSharpCompilationOptions options)
+    {
+        CSharpCompilation compilation;
+
+        if (Compilations.TryGetValue(projectName, out var previous) && previous.References.SequenceEqual(references))
+        {
+            var newTrees = trees.ToHashSet();
+            var oldTrees = previous.SyntaxTrees.ToHashSet();
+
+            compilation = previous
+                .RemoveSyntaxTrees(previous.SyntaxTrees.Where(x => !newTrees.Contains(x)))
+                .AddSyntaxTrees(trees.Where(x => !oldTrees.Contains(x)));
+        }
+        else
+        {
+            compilation = CSharpCompilation.Create("Compilation", trees, references, options);
+        }
+
+        Compilations[projectName] = compilation;
+
+        return compilation;
+    }
+    #endregion
+
+    #region Document Cache
+    /// <summary>
+    /// Computes the document key, it changes if any source file, reference or the generator changes.
+    /// </summary>
+    /// <param name="projectName">Name of the project.</param>
+    /// <param name="sourceFiles">The source files.</param>
+    /// <param name="references">The references.</param>
+    /// <returns>System.String.</returns>
+    public static string ComputeDocumentKey(string projectName, IEnumerable<CSharpSourceFile> sourceFiles, IEnumerable<PortableExecutableReference> references)
+    {
+        var builder = new StringBuilder();
+
+        builder.AppendLine(CoreVersion.GeneratorVersion);
+        builder.AppendLine(projectName);
+
+        foreach (var sourceFile in sourceFiles)
+        {
+            builder.AppendLine($"{sourceFile.ProjectName}|{sourceFile.FilePath.CanonicalPath()}|{sourceFile.ContentHash}");
+        }
+
+        foreach (var reference in references)
+        {
+            var fileInfo = new FileInfo(reference.FilePath!);
+
+            builder.AppendLine($"{fileInfo.FullName}|{fileInfo.Length}|{fileInfo.LastWriteTimeUtc.Ticks}");
+        }
+
+        return Convert.ToHexString(SHA256.HashData(Encoding.UTF8.GetBytes(builder.ToString())));
+    }
+
+    /// <summary>
+    /// Loads the cached document.
+    /// </summary>
+    /// <param name="unrealProjectDirectory">The unreal project directory.</param>
+    /// <param name="projectName">Name of the project.</param>
+    /// <param name="key">The key.</param>
+    /// <returns>TypeDefinitionDocument?, null if there is no cached document of this key.</returns>
+    public static TypeDefinitionDocument? LoadDocument(string unrealProjectDirectory, string projectName, string key)
+    {
+        GetCachePaths(unrealProjectDirectory, projectName, out var documentPath, out var infoPath);
+
+        if (!documentPath.IsFileExists() || !infoPath.IsFileExists())
+        {
+            return null;
+        }
+
+        try
+        {
+            var info = JsonConvert.DeserializeObject<RoslynTypeDefinitionCacheInfo>(File.ReadAllText(infoPath));
+
+            if (info == null || info.Key != key)
+            {
+                return null;
+            }
+
+            var document = new TypeDefinitionDocument();
+
+            if (!document.LoadFromFile(documentPath))
+            {
+                return null;
+            }
+
+            foreach (var name in info.NativeBindingSuperTypeClasses)
+            {
+                if (document.GetDefinition(name) is ClassTypeDefinition classType)
+                {
+                    classType.IsNativeBindingSuperType = true;
+                }
+            }
+
+            return document;
+        }
+        catch (Exception e)
+        {
+            Logger.LogWarning("Failed load cached type definition document {0}: {1}", documentPath, e.Message);
+            return null;
+        }
+    }
+
+    /// <summary>
+    /// Saves the document to cache.
+    /// </summary>
+    /// <param name="unrealProjectDirectory">The unreal project directory.</param>
+    /// <param name="projectName">Name of the project.</param>
+    /// <param name="key">The key.</param>
+    /// <param name="document">The document.</param>
+    public static void SaveDocument(string unrealProjectDirectory, string projectName, string key, TypeDefinitionDocument document)
+    {
+        GetCachePaths(unrealProjectDirectory, projectName, out var documentPath, out var infoPath);
+
+        try
+        {
+            var info = new RoslynTypeDefinitionCacheInfo
+            {
+                Key = key,
+                NativeBindingSuperTypeClasses = document.Types.OfType<ClassTypeDefinition>().Where(x => x.IsNativeBindingSuperType).Select(x => x.CppName!).ToList()
+            };
+
+            document.SaveToFile(documentPath);
+            File.WriteAllText(infoPath, JsonConvert.SerializeObject(info, Formatting.Indented));
+        }
+        catch (Exception e)
+        {
+            Logger.LogWarning("Failed save cached type definition document {0}: {1}", documentPath, e.Message);
+        }
+    }
+
+    /// <summary>
+    /// Gets the cache paths.
+    /// </summary>
+    /// <param name="unrealProjectDirectory">The unreal project directory.</param>
+    /// <param name="projectName">Name of the project.</param>
+    /// <param name="documentPath">The document path.</param>
+    /// <param name="infoPath">The information path.</param>
+    private static void GetCachePaths(string unrealProjectDirectory, string projectName, out string documentPath, out string infoPath)
+    {
+        var intermediatePath = Path.Combine(unrealProjectDirectory, "Intermediate/UnrealSharp");
+
+        documentPath = Path.Combine(intermediatePath, $"{projectName}.Bindings.Defs.cache.tdb");
+        infoPath = Path.Combine(intermediatePath, $"{projectName}.Bindings.Defs.cache.json");
+    }
+    #endregion
+}
@@ -1,4 +1,6 @@
 ﻿using System.Diagnostics;
+using System.Security.Cryptography;
+using System.Text;
 using Microsoft.CodeAnalysis;
 using Microsoft.CodeAnalysis.CSharp;
 using Microsoft.CodeAnalysis.CSharp.Syntax;
@@ -33,6 +35,18 @@ internal class CSharpSourceFile
     /// The project name
     /// </summary>
     public readonly string ProjectName;
+    /// <summary>
+    /// The SHA256 of the file content
+    /// </summary>
+    public readonly string ContentHash;
+    /// <summary>
+    /// The file length
+    /// </summary>
+    public readonly long Length;
+    /// <summary>
+    /// The last write time in UTC
+    /// </summary>
+    public readonly DateTime LastWriteTime;
 
     /// <summary>
     /// Gets the compilation.
@@ -50,16 +64,53 @@ internal class CSharpSourceFile
     /// </summary>
     /// <param name="filePath">The file path.</param>
     /// <param name="projectName">Name of the project.</param>
-    public CSharpSourceFile(string filePath, string projectName)
+    public CSharpSourceFile(string filePath, string projectName) :
+        this(filePath, projectName, null)
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="CSharpSourceFile"/> class.
+    /// </summary>
+    /// <param name="filePath">The file path.</param>
+    /// <param name="projectName">Name of the project.</param>
+    /// <param name="previous">The previous version of this file, its syntax tree is reused if the content is not changed.</param>
+    public CSharpSourceFile(string filePath, string projectName, CSharpSourceFile? previous)
     {
         FilePath = filePath;
         ProjectName = projectName;
+        LastWriteTime = File.GetLastWriteTimeUtc(filePath);
 
-        FileText = File.ReadAllText(FilePath);
+        var bytes = File.ReadAllBytes(FilePath);
+
+        Length = bytes.Length;
+        ContentHash = Convert.ToHexString(SHA256.HashData(bytes));
+
+        if (previous != null && previous.ContentHash == ContentHash)
+        {
+            FileText = previous.FileText;
+            Tree = previous.Tree;
+            return;
+        }
+
+        using var reader = new StreamReader(new MemoryStream(bytes), Encoding.UTF8, true);
+
+        FileText = reader.ReadToEnd();
 
         Tree = CSharpSyntaxTree.ParseText(FileText);            
     }
 
+    /// <summary>
+    /// Determines whether the file on disk is still the file loaded by this instance.
+    /// </summary>
+    /// <returns><c>true</c> if the file is not changed; otherwise, <c>false</c>.</returns>
+    public bool IsUpToDate()
+    {
+        var fileInfo = new FileInfo(FilePath);
+
+        return fileInfo.Exists && fileInfo.Length == Length && fileInfo.LastWriteTimeUtc == LastWriteTime;
+    }
+
     /// <summary>
     /// Converts to string.
     /// </summary>
@@ -136,7 +187,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
         {
             var files = Directory.EnumerateFiles(projectDirectory, "*.cs", SearchOption.AllDirectories);
 
-            return files.Select(x => new CSharpSourceFile(x, projectName));
+            return RoslynTypeDefinitionCache.GetSourceFiles(files, projectName);
         }
 
         return [];
@@ -156,7 +207,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
         {
             var files = Directory.EnumerateFiles(projectDirectory, "*.cs", SearchOption.AllDirectories);
 
-            return files.Select(x => new CSharpSourceFile(x, projectName));
+            return RoslynTypeDefinitionCache.GetSourceFiles(files, projectName);
         }
 
         return [];
@@ -175,7 +226,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
         {
             var files = Directory.EnumerateFiles(projectDirectory, "*.cs", SearchOption.AllDirectories);
 
-            return files.Select(x => new CSharpSourceFile(x, "UnrealSharp.UnrealEngine"));
+            return RoslynTypeDefinitionCache.GetSourceFiles(files, "UnrealSharp.UnrealEngine");
         }
 
         return [];
@@ -200,7 +251,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
             {
                 var files = Directory.EnumerateFiles(projectDirectory, "*.cs", SearchOption.AllDirectories);
 
-                result.AddRange(files.Select(x => new CSharpSourceFile(x, projectName)));
+                result.AddRange(RoslynTypeDefinitionCache.GetSourceFiles(files, projectName));
             }
         }
 
@@ -227,7 +278,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
         }
 
         return [
-            new CSharpSourceFile(globalUsingFile, "Helper")
+            RoslynTypeDefinitionCache.GetSourceFile(globalUsingFile, "Helper")
         ];
     }
 
@@ -400,7 +451,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
 
                 if (dllPath.IsFileExists())
                 {
-                    references.Add(MetadataReference.CreateFromFile(dllPath));
+                    references.Add(RoslynTypeDefinitionCache.GetReference(dllPath));
                     bFound = true;
                     break;
                 }
@@ -446,7 +497,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
 
             if (latestFile != null)
             {
-                return [MetadataReference.CreateFromFile(latestFile)];
+                return [RoslynTypeDefinitionCache.GetReference(latestFile)];
             }
         }
 
@@ -455,7 +506,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
 
             if (unrealSharpUtilsDllPath.IsFileExists())
             {
-                return [MetadataReference.CreateFromFile(unrealSharpUtilsDllPath)];
+                return [RoslynTypeDefinitionCache.GetReference(unrealSharpUtilsDllPath)];
             }
 
             Logger.Ensure<FileNotFoundException>(unrealSharpUtilsDllPath.IsFileExists(), "UnrealSharp.Utils.dll is not exists. Please build UnrealSharp.sln first.");
@@ -500,6 +551,16 @@ internal static class RoslynTypeDefinitionDocumentFactory
 
         var references = GetAllReferences(cSharpCodeBasedGenerateOptions);
 
+        // definition sources are not changed since last generation, the result must be the same
+        var documentKey = RoslynTypeDefinitionCache.ComputeDocumentKey(projectName, allFiles, references);
+
+        if (!cSharpCodeBasedGenerateOptions.NoCache &&
+            RoslynTypeDefinitionCache.LoadDocument(cSharpCodeBasedGenerateOptions.UnrealProjectDirectory, projectName, documentKey) is { } cachedDocument)
+        {
+            Logger.Log("Definition sources of {0} are not changed, use cached type definition document.", projectName);
+            return cachedDocument;
+        }
+
         var treeMaps = new Dictionary<SyntaxTree, CSharpSourceFile>();
         allFiles.ForEach(x => treeMaps.Add(x.Tree, x));
 
@@ -515,7 +576,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
         );
 
         // for syntax tree maps            
-        var compilation = CSharpCompilation.Create("Compilation", allFiles.Select(x=>x.Tree), references, options);
+        var compilation = RoslynTypeDefinitionCache.GetCompilation(projectName, allFiles.Select(x => x.Tree).ToList(), references, options);
             
         LogCompilationDiagnostics(compilation, treeMaps);
 
@@ -523,7 +584,14 @@ internal static class RoslynTypeDefinitionDocumentFactory
 
         var tempOutputFile = GenerateTempOutputFile(cSharpCodeBasedGenerateOptions, projectName, compilation, treeMaps);
 
-        return GenerateDocumentFromAssembly(cSharpCodeBasedGenerateOptions, allFiles, tempOutputFile);
+        var document = GenerateDocumentFromAssembly(cSharpCodeBasedGenerateOptions, allFiles, tempOutputFile);
+
+        if (document != null)
+        {
+            RoslynTypeDefinitionCache.SaveDocument(cSharpCodeBasedGenerateOptions.UnrealProjectDirectory, projectName, documentKey, document);
+        }
+
+        return document;
     }
 
     /// <summary>
@@ -545,7 +613,7 @@ internal static class RoslynTypeDefinitionDocumentFactory
 
         localAssemblySearchOptions.CustomSearchDirectories.Add(Path.Combine(options.UnrealProjectDirectory, "Managed"));
 
-        var newDebugInformation = new RoslynDebugInformation(allFiles.Select(x => x.FilePath));
+        var newDebugInformation = new RoslynDebugInformation(allFiles);
 
         var document = MonoTypeDefinitionDocumentFactory.LoadFromAssemblies(
             [assemblyPath],
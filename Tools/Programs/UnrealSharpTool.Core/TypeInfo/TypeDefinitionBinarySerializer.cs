@@ -0,0 +1,721 @@
+﻿using System.Buffers.Binary;
+using System.Security.Cryptography;
+using System.Text;
+using UnrealSharp.Utils.Extensions;
+using UnrealSharp.Utils.Misc;
+
+namespace UnrealSharpTool.Core.TypeInfo;
+
+/// <summary>
+/// Class TypeDefinitionBinarySerializer.
+/// Read and write binary type database(.tdb).
+/// The layout is shared with SharpBindingGen(TypeDatabaseFile.h), change both of them and increase the version together:
+///   header
+///   type index       sorted by utf8 bytes of the C++ name
+///   string lists     count + string indices
+///   type records     strings are indices of the string table
+///   string table     offset + length of each string
+///   string data      utf8, zero terminated
+/// </summary>
+public static class TypeDefinitionBinarySerializer
+{
+    /// <summary>
+    /// The file magic, "UTDB"
+    /// </summary>
+    public const uint FileMagic = 0x42445455;
+
+    /// <summary>
+    /// The file version
+    /// </summary>
+    public const uint FileVersion = 1;
+
+    /// <summary>
+    /// The null string index
+    /// </summary>
+    private const uint NullStringIndex = uint.MaxValue;
+
+    /// <summary>
+    /// The header size
+    /// </summary>
+    private const int HeaderSize = 44;
+
+    /// <summary>
+    /// The index entry size
+    /// </summary>
+    private const int IndexEntrySize = 16;
+
+    /// <summary>
+    /// The string entry size
+    /// </summary>
+    private const int StringEntrySize = 8;
+
+    #region Detection
+    /// <summary>
+    /// Determines whether the specified file is a binary type database.
+    /// </summary>
+    /// <param name="path">The path.</param>
+    /// <returns><c>true</c> if the file starts with the binary magic; otherwise, <c>false</c>.</returns>
+    public static bool IsBinaryFile(string path)
+    {
+        using var stream = File.OpenRead(path);
+
+        Span<byte> magic = stackalloc byte[4];
+
+        return stream.Read(magic) == magic.Length && BinaryPrimitives.ReadUInt32LittleEndian(magic) == FileMagic;
+    }
+    #endregion
+
+    #region Save
+    /// <summary>
+    /// Saves the document to a binary type database.
+    /// </summary>
+    /// <param name="document">The document.</param>
+    /// <param name="path">The path.</param>
+    public static void Save(TypeDefinitionDocument document, string path)
+    {
+        var records = new RecordWriter();
+        var entries = new List<(uint CppName, int Type, int RecordOffset, int RecordSize)>();
+
+        foreach (var type in document.Types)
+        {
+            var recordOffset = records.Position;
+            var cppName = records.AddString(type.CppName);
+
+            WriteType(records, type);
+
+            entries.Add((cppName, (int)type.Type, recordOffset, records.Position - recordOffset));
+        }
+
+        var stringLists = GetStringLists(document).Select(x => x.Select(y => records.AddString(y)).ToList()).ToList();
+
+        // same order as SharpBindingGen, binary search depends on it
+        entries.Sort((x, y) => records.GetUtf8String(x.CppName).AsSpan().SequenceCompareTo(records.GetUtf8String(y.CppName)));
+
+        using var stream = new MemoryStream();
+        using var writer = new BinaryWriter(stream);
+
+        var typeIndexOffset = HeaderSize;
+        var stringListOffset = typeIndexOffset + entries.Count * IndexEntrySize;
+        var recordOffsetBase = stringListOffset + stringLists.Sum(x => 4 + x.Count * 4);
+        var stringTableOffset = Align(recordOffsetBase + records.Position);
+        var strings = records.Strings;
+
+        writer.Write(FileMagic);
+        writer.Write(FileVersion);
+        writer.Write(document.UnrealMajorVersion);
+        writer.Write(document.UnrealMinorVersion);
+        writer.Write(document.UnrealPatchVersion);
+        writer.Write(document.DocumentAttributes);
+        writer.Write((uint)entries.Count);
+        writer.Write((uint)typeIndexOffset);
+        writer.Write((uint)stringListOffset);
+        writer.Write((uint)strings.Count);
+        writer.Write((uint)stringTableOffset);
+
+        foreach (var entry in entries)
+        {
+            writer.Write(entry.CppName);
+            writer.Write(entry.Type);
+            writer.Write((uint)(recordOffsetBase + entry.RecordOffset));
+            writer.Write((uint)entry.RecordSize);
+        }
+
+        foreach (var list in stringLists)
+        {
+            writer.Write((uint)list.Count);
+            list.ForEach(writer.Write);
+        }
+
+        writer.Write(records.ToArray());
+        writer.Write(new byte[stringTableOffset - recordOffsetBase - records.Position]);
+
+        var stringDataOffset = stringTableOffset + strings.Count * StringEntrySize;
+
+        foreach (var bytes in strings)
+        {
+            writer.Write((uint)stringDataOffset);
+            writer.Write((uint)bytes.Length);
+
+            stringDataOffset += bytes.Length + 1;
+        }
+
+        foreach (var bytes in strings)
+        {
+            writer.Write(bytes);
+            writer.Write((byte)0);
+        }
+
+        writer.Flush();
+
+        File.WriteAllBytes(path, stream.ToArray());
+    }
+
+    /// <summary>
+    /// Writes the type.
+    /// </summary>
+    /// <param name="writer">The writer.</param>
+    /// <param name="type">The type.</param>
+    private static void WriteType(RecordWriter writer, BaseTypeDefinition type)
+    {
+        writer.Write((int)type.Type);
+        writer.Write(type.Name);
+        writer.Write(type.CppName);
+        writer.Write(type.PathName);
+        writer.Write(type.PackageName);
+        writer.Write(type.ProjectName);
+        writer.Write(type.Namespace);
+        writer.Write(type.AssemblyName);
+        writer.Write(type.CSharpFullName);
+        writer.Write(type.Flags);
+        writer.Write(type.CrcCode);
+        writer.Write(type.ExportFlags);
+        writer.Write(type.Guid);
+        writer.Write(type.Size);
+        WriteMetas(writer, type.Metas);
+
+        switch (type)
+        {
+            case EnumTypeDefinition enumType:
+                writer.Write(enumType.Fields.Count);
+
+                foreach (var field in enumType.Fields)
+                {
+                    writer.Write(field.Name);
+                    writer.Write(field.Value);
+                }
+
+                break;
+            case StructTypeDefinition structType:
+                writer.Write(structType.Properties.Count);
+                structType.Properties.ForEach(x => WriteProperty(writer, x));
+
+                writer.Write(structType.DependNamespaces.Count);
+                structType.DependNamespaces.ForEach(x => writer.Write(x));
+
+                if (structType is FunctionTypeDefinition functionType)
+                {
+                    writer.Write(functionType.IsOverrideFunction);
+                    writer.Write(functionType.Signature);
+                }
+                else if (structType is ClassTypeDefinition classType)
+                {
+                    writer.Write(classType.SuperName);
+                    writer.Write(classType.ConfigName);
+
+                    writer.Write(classType.Functions.Count);
+                    classType.Functions.ForEach(x => WriteType(writer, x));
+
+                    writer.Write(classType.Interfaces.Count);
+                    classType.Interfaces.ForEach(x => writer.Write(x));
+                }
+
+                break;
+        }
+    }
+
+    /// <summary>
+    /// Writes the property.
+    /// </summary>
+    /// <param name="writer">The writer.</param>
+    /// <param name="property">The property.</param>
+    private static void WriteProperty(RecordWriter writer, PropertyDefinition property)
+    {
+        writer.Write(property.CppTypeName);
+        writer.Write(property.TypeName);
+        writer.Write(property.TypeClass);
+        writer.Write(property.Name);
+        writer.Write(property.ClassPath);
+        writer.Write(property.DefaultValue);
+        writer.Write(property.MetaClass);
+        writer.Write(property.Offset);
+        writer.Write(property.Flags);
+        writer.Write(property.Size);
+        writer.Write(property.FieldMask);
+        writer.Write((int)property.ReferenceType);
+        writer.Write(property.Guid);
+        WriteMetas(writer, property.Metas);
+
+        writer.Write(property.InnerProperties.Count);
+        property.InnerProperties.ForEach(x => WriteProperty(writer, x));
+
+        writer.Write(property.SignatureFunction != null);
+
+        if (property.SignatureFunction != null)
+        {
+            WriteType(writer, property.SignatureFunction);
+        }
+    }
+
+    /// <summary>
+    /// Writes the metas.
+    /// </summary>
+    /// <param name="writer">The writer.</param>
+    /// <param name="metas">The metas.</param>
+    private static void WriteMetas(RecordWriter writer, MetaDefinition metas)
+    {
+        writer.Write(metas.Metas.Count);
+
+        foreach (var (key, value) in metas.Metas)
+        {
+            writer.Write(key);
+            writer.Write(value);
+        }
+    }
+    #endregion
+
+    #region Load
+    /// <summary>
+    /// Loads the document from a binary type database.
+    /// </summary>
+    /// <param name="document">The document.</param>
+    /// <param name="path">The path.</param>
+    /// <returns><c>true</c> if success, <c>false</c> otherwise.</returns>
+    public static bool Load(TypeDefinitionDocument document, string path)
+    {
+        var data = File.ReadAllBytes(path);
+
+        try
+        {
+            var header = new RecordReader(data, 0, HeaderSize, []);
+
+            if (header.ReadUInt32() != FileMagic || header.ReadUInt32() != FileVersion)
+            {
+                Logger.LogError("{0} is not a valid type database file or the version is not supported.", path);
+                return false;
+            }
+
+            document.UnrealMajorVersion = header.ReadInt32();
+            document.UnrealMinorVersion = header.ReadInt32();
+            document.UnrealPatchVersion = header.ReadInt32();
+            document.DocumentAttributes = header.ReadInt32();
+
+            var typeCount = header.ReadInt32();
+            var typeIndexOffset = header.ReadInt32();
+            var stringListOffset = header.ReadInt32();
+            var stringCount = header.ReadInt32();
+            var stringTableOffset = header.ReadInt32();
+
+            var strings = new string[stringCount];
+            var stringTable = new RecordReader(data, stringTableOffset, stringCount * StringEntrySize, []);
+
+            for (var i = 0; i < stringCount; ++i)
+            {
+                var offset = stringTable.ReadInt32();
+                var length = stringTable.ReadInt32();
+
+                strings[i] = Encoding.UTF8.GetString(data, offset, length);
+            }
+
+            var index = new RecordReader(data, typeIndexOffset, typeCount * IndexEntrySize, strings);
+            var entries = new List<(EDefinitionType Type, int RecordOffset, int RecordSize)>(typeCount);
+
+            for (var i = 0; i < typeCount; ++i)
+            {
+                index.ReadUInt32();
+                entries.Add(((EDefinitionType)index.ReadInt32(), index.ReadInt32(), index.ReadInt32()));
+            }
+
+            // records are saved in the original order of types, index is sorted by name
+            foreach (var entry in entries.OrderBy(x => x.RecordOffset))
+            {
+                if (CreateType(entry.Type) is not { } type)
+                {
+                    continue;
+                }
+
+                ReadType(new RecordReader(data, entry.RecordOffset, entry.RecordSize, strings), type);
+
+                document.Types.Add(type);
+            }
+
+            var stringLists = new RecordReader(data, stringListOffset, data.Length - stringListOffset, strings);
+
+            foreach (var list in GetStringLists(document))
+            {
+                var count = stringLists.ReadInt32();
+
+                for (var i = 0; i < count; ++i)
+                {
+                    list.Add(stringLists.ReadString()!);
+                }
+            }
+        }
+        catch (Exception e) when (e is ArgumentException or EndOfStreamException or IndexOutOfRangeException)
+        {
+            Logger.LogError("{0} is broken: {1}", path, e.Message);
+            return false;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Creates the type.
+    /// </summary>
+    /// <param name="type">The type.</param>
+    /// <returns>BaseTypeDefinition?.</returns>
+    private static BaseTypeDefinition? CreateType(EDefinitionType type)
+    {
+        return type switch
+        {
+            EDefinitionType.Enum => new EnumTypeDefinition(),
+            EDefinitionType.Struct => new ScriptStructTypeDefinition(),
+            EDefinitionType.Class => new ClassTypeDefinition(),
+            EDefinitionType.Function => new FunctionTypeDefinition(),
+            EDefinitionType.Interface => new InterfaceClassTypeDefinition(),
+            _ => null
+        };
+    }
+
+    /// <summary>
+    /// Reads the type.
+    /// </summary>
+    /// <param name="reader">The reader.</param>
+    /// <param name="type">The type.</param>
+    private static void ReadType(RecordReader reader, BaseTypeDefinition type)
+    {
+        // the type has been decided by the index
+        reader.ReadInt32();
+
+        type.Name = reader.ReadString();
+        type.CppName = reader.ReadString();
+        type.PathName = reader.ReadString();
+        type.PackageName = reader.ReadString();
+        type.ProjectName = reader.ReadString();
+        type.Namespace = reader.ReadString();
+        type.AssemblyName = reader.ReadString();
+        type.CSharpFullName = reader.ReadString();
+        type.Flags = reader.ReadUInt64();
+        type.CrcCode = reader.ReadInt64();
+        type.ExportFlags = reader.ReadInt32();
+        ReadGuid(reader, x => type.Guid = x);
+        type.Size = reader.ReadInt32();
+        ReadMetas(reader, type.Metas);
+
+        switch (type)
+        {
+            case EnumTypeDefinition enumType:
+                for (int i = 0, count = reader.ReadCount(); i < count; ++i)
+                {
+                    enumType.Fields.Add(new EnumFieldDefinition { Name = reader.ReadString(), Value = reader.ReadInt64() });
+                }
+
+                break;
+            case StructTypeDefinition structType:
+                for (int i = 0, count = reader.ReadCount(); i < count; ++i)
+                {
+                    structType.Properties.Add(ReadProperty(reader));
+                }
+
+                for (int i = 0, count = reader.ReadCount(); i < count; ++i)
+                {
+                    structType.DependNamespaces.Add(reader.ReadString() ?? string.Empty);
+                }
+
+                if (structType is FunctionTypeDefinition functionType)
+                {
+                    functionType.IsOverrideFunction = reader.ReadBoolean();
+                    functionType.Signature = reader.ReadString() ?? string.Empty;
+                }
+                else if (structType is ClassTypeDefinition classType)
+                {
+                    classType.SuperName = reader.ReadString() ?? string.Empty;
+                    classType.ConfigName = reader.ReadString();
+
+                    for (int i = 0, count = reader.ReadCount(); i < count; ++i)
+                    {
+                        var function = new FunctionTypeDefinition();
+                        ReadType(reader, function);
+
+                        classType.Functions.Add(function);
+                    }
+
+                    for (int i = 0, count = reader.ReadCount(); i < count; ++i)
+                    {
+                        classType.Interfaces.Add(reader.ReadString() ?? string.Empty);
+                    }
+                }
+
+                break;
+        }
+    }
+
+    /// <summary>
+    /// Reads the property.
+    /// </summary>
+    /// <param name="reader">The reader.</param>
+    /// <returns>PropertyDefinition.</returns>
+    private static PropertyDefinition ReadProperty(RecordReader reader)
+    {
+        var property = new PropertyDefinition
+        {
+            CppTypeName = reader.ReadString(),
+            TypeName = reader.ReadString(),
+            TypeClass = reader.ReadString(),
+            Name = reader.ReadString(),
+            ClassPath = reader.ReadString(),
+            DefaultValue = reader.ReadString(),
+            MetaClass = reader.ReadString(),
+            Offset = reader.ReadInt32(),
+            Flags = reader.ReadUInt64(),
+            Size = reader.ReadInt32(),
+            FieldMask = reader.ReadByte(),
+            ReferenceType = (EReferenceType)reader.ReadInt32()
+        };
+
+        ReadGuid(reader, x => property.Guid = x);
+        ReadMetas(reader, property.Metas);
+
+        for (int i = 0, count = reader.ReadCount(); i < count; ++i)
+        {
+            property.InnerProperties.Add(ReadProperty(reader));
+        }
+
+        if (reader.ReadBoolean())
+        {
+            property.SignatureFunction = new FunctionTypeDefinition();
+            ReadType(reader, property.SignatureFunction);
+        }
+
+        return property;
+    }
+
+    /// <summary>
+    /// Reads the unique identifier, empty guid is not saved by SharpBindingGen.
+    /// </summary>
+    /// <param name="reader">The reader.</param>
+    /// <param name="setter">The setter.</param>
+    private static void ReadGuid(RecordReader reader, Action<string> setter)
+    {
+        var guid = reader.ReadString();
+
+        if (!guid.IsNullOrEmpty())
+        {
+            setter(guid!);
+        }
+    }
+
+    /// <summary>
+    /// Reads the metas.
+    /// </summary>
+    /// <param name="reader">The reader.</param>
+    /// <param name="metas">The metas.</param>
+    private static void ReadMetas(RecordReader reader, MetaDefinition metas)
+    {
+        for (int i = 0, count = reader.ReadCount(); i < count; ++i)
+        {
+            var key = reader.ReadString() ?? string.Empty;
+            var value = reader.ReadString() ?? string.Empty;
+
+            metas.SetMeta(key, value);
+        }
+    }
+    #endregion
+
+    #region Hash
+    /// <summary>
+    /// Computes the content hash of a type.
+    /// It is calculated from the binary record of the type, so it changes only when the saved data of the type changes.
+    /// </summary>
+    /// <param name="type">The type.</param>
+    /// <returns>SHA256 of the type record and its strings.</returns>
+    public static byte[] ComputeTypeHash(BaseTypeDefinition type)
+    {
+        var records = new RecordWriter();
+
+        WriteType(records, type);
+
+        using var hash = IncrementalHash.CreateHash(HashAlgorithmName.SHA256);
+
+        hash.AppendData(records.ToArray());
+
+        foreach (var bytes in records.Strings)
+        {
+            hash.AppendData(BitConverter.GetBytes(bytes.Length));
+            hash.AppendData(bytes);
+        }
+
+        return hash.GetHashAndReset();
+    }
+    #endregion
+
+    #region Utils
+    /// <summary>
+    /// Gets the string lists in file order.
+    /// </summary>
+    /// <param name="document">The document.</param>
+    /// <returns>HashSet&lt;System.String&gt;[].</returns>
+    private static HashSet<string>[] GetStringLists(TypeDefinitionDocument document)
+    {
+        return
+        [
+            document.FastAccessStructTypes,
+            document.FastFunctionInvokeModuleNames,
+            document.FastFunctionInvokeIgnoreClassNames,
+            document.FastFunctionInvokeIgnoreNames
+        ];
+    }
+
+    /// <summary>
+    /// Aligns the specified value to 4 bytes.
+    /// </summary>
+    /// <param name="value">The value.</param>
+    /// <returns>System.Int32.</returns>
+    private static int Align(int value)
+    {
+        return (value + 3) & ~3;
+    }
+
+    /// <summary>
+    /// Class RecordWriter.
+    /// Write records and collect strings.
+    /// </summary>
+    private class RecordWriter
+    {
+        /// <summary>
+        /// The stream
+        /// </summary>
+        private readonly MemoryStream _stream = new();
+
+        /// <summary>
+        /// The writer
+        /// </summary>
+        private readonly BinaryWriter _writer;
+
+        /// <summary>
+        /// The string indices
+        /// </summary>
+        private readonly Dictionary<string, uint> _stringIndices = new(StringComparer.Ordinal);
+
+        /// <summary>
+        /// Gets the strings.
+        /// </summary>
+        /// <value>The strings.</value>
+        public List<byte[]> Strings { get; } = [];
+
+        /// <summary>
+        /// Gets the position.
+        /// </summary>
+        /// <value>The position.</value>
+        public int Position => (int)_stream.Position;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="RecordWriter"/> class.
+        /// </summary>
+        public RecordWriter()
+        {
+            _writer = new BinaryWriter(_stream);
+        }
+
+        /// <summary>
+        /// Adds the string.
+        /// </summary>
+        /// <param name="value">The value.</param>
+        /// <returns>System.UInt32.</returns>
+        public uint AddString(string? value)
+        {
+            if (value == null)
+            {
+                return NullStringIndex;
+            }
+
+            if (!_stringIndices.TryGetValue(value, out var index))
+            {
+                index = (uint)Strings.Count;
+                Strings.Add(Encoding.UTF8.GetBytes(value));
+                _stringIndices.Add(value, index);
+            }
+
+            return index;
+        }
+
+        /// <summary>
+        /// Gets the UTF8 string.
+        /// </summary>
+        /// <param name="index">The index.</param>
+        /// <returns>System.Byte[].</returns>
+        public byte[] GetUtf8String(uint index) => index == NullStringIndex ? [] : Strings[(int)index];
+
+        /// <summary>
+        /// Converts to array.
+        /// </summary>
+        /// <returns>System.Byte[].</returns>
+        public byte[] ToArray()
+        {
+            _writer.Flush();
+            return _stream.ToArray();
+        }
+
+        public void Write(string? value) => _writer.Write(AddString(value));
+        public void Write(int value) => _writer.Write(value);
+        public void Write(long value) => _writer.Write(value);
+        public void Write(ulong value) => _writer.Write(value);
+        public void Write(byte value) => _writer.Write(value);
+        public void Write(bool value) => _writer.Write(value ? (byte)1 : (byte)0);
+    }
+
+    /// <summary>
+    /// Class RecordReader.
+    /// Read one record, never read beyond it.
+    /// </summary>
+    private class RecordReader
+    {
+        /// <summary>
+        /// The reader
+        /// </summary>
+        private readonly BinaryReader _reader;
+
+        /// <summary>
+        /// The strings
+        /// </summary>
+        private readonly string[] _strings;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="RecordReader"/> class.
+        /// </summary>
+        /// <param name="data">The data.</param>
+        /// <param name="offset">The offset.</param>
+        /// <param name="size">The size.</param>
+        /// <param name="strings">The strings.</param>
+        public RecordReader(byte[] data, int offset, int size, string[] strings)
+        {
+            _reader = new BinaryReader(new MemoryStream(data, offset, size, false));
+            _strings = strings;
+        }
+
+        /// <summary>
+        /// Reads the count of an array, every element takes one byte at least.
+        /// </summary>
+        /// <returns>System.Int32.</returns>
+        public int ReadCount()
+        {
+            var count = _reader.ReadInt32();
+
+            if (count < 0 || count > _reader.BaseStream.Length - _reader.BaseStream.Position)
+            {
+                throw new EndOfStreamException("invalid array count");
+            }
+
+            return count;
+        }
+
+        /// <summary>
+        /// Reads the string.
+        /// </summary>
+        /// <returns>System.String?.</returns>
+        public string? ReadString()
+        {
+            var index = _reader.ReadUInt32();
+
+            return index == NullStringIndex ? null : _strings[index];
+        }
+
+        public int ReadInt32() => _reader.ReadInt32();
+        public uint ReadUInt32() => _reader.ReadUInt32();
+        public long ReadInt64() => _reader.ReadInt64();
+        public ulong ReadUInt64() => _reader.ReadUInt64();
+        public byte ReadByte() => _reader.ReadByte();
+        public bool ReadBoolean() => _reader.ReadByte() != 0;
+    }
+    #endregion
+}
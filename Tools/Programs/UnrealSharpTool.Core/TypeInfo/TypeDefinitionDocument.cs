@@ -57,6 +57,14 @@ public class CSharpCodeBasedGenerateOptions : ITypeDefinitionDocumentInitializeO
     [Option('p', "project", Required = true, HelpText = "Your unreal project directory path.")]
     // ReSharper disable once PropertyCanBeMadeInitOnly.Global
     public string UnrealProjectDirectory { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets a value indicating whether to ignore the cached document.
+    /// </summary>
+    /// <value><c>true</c> if no cache; otherwise, <c>false</c>.</value>
+    [Option("noCache", HelpText = "always compile definition sources, don't use the cached type definition document.")]
+    // ReSharper disable once PropertyCanBeMadeInitOnly.Global
+    public bool NoCache { get; set; }
 }
 
 #endregion
@@ -326,15 +334,14 @@ public class TypeDefinitionDocument
         }
     #endregion
 
-    #region Json Support
+    #region File Support
     /// <summary>
     /// Saves to file.
+    /// save as json if the extension is .json, otherwise save as binary type database.
     /// </summary>
     /// <param name="path">The path.</param>
     public void SaveToFile(string path)
     {
-            var jsonString = JsonConvert.SerializeObject(this, Formatting.Indented, GetDefaultJsonSerializerSettings());
-
             var dir = path.GetDirectoryPath();
 
             if(!dir.IsDirectoryExists())
@@ -342,13 +349,23 @@ public class TypeDefinitionDocument
                 Directory.CreateDirectory(dir);
             }
 
-            File.WriteAllBytes(path, Encoding.UTF8.GetBytes(jsonString));
+            if (path.EndsWith(".json", StringComparison.OrdinalIgnoreCase))
+            {
+                var jsonString = JsonConvert.SerializeObject(this, Formatting.Indented, GetDefaultJsonSerializerSettings());
+
+                File.WriteAllBytes(path, Encoding.UTF8.GetBytes(jsonString));
+            }
+            else
+            {
+                TypeDefinitionBinarySerializer.Save(this, path);
+            }
 
             Logger.Log("Save file success :{0}", path.CanonicalPath());
         }
 
     /// <summary>
     /// Loads from file.
+    /// binary type database and json document are both supported.
     /// </summary>
     /// <param name="path">The path.</param>
     /// <returns>bool.</returns>
@@ -362,8 +379,19 @@ public class TypeDefinitionDocument
                 return false;
             }
 
-            var jsonString = File.ReadAllText(path, Encoding.UTF8);
-            JsonConvert.PopulateObject(jsonString, this, GetDefaultJsonSerializerSettings());
+            if (TypeDefinitionBinarySerializer.IsBinaryFile(path))
+            {
+                if (!TypeDefinitionBinarySerializer.Load(this, path))
+                {
+                    Reset();
+                    return false;
+                }
+            }
+            else
+            {
+                var jsonString = File.ReadAllText(path, Encoding.UTF8);
+                JsonConvert.PopulateObject(jsonString, this, GetDefaultJsonSerializerSettings());
+            }
 
             foreach(var type in Types)
             {
@@ -0,0 +1,182 @@
+﻿using Newtonsoft.Json;
+using UnrealSharp.Utils.Extensions.IO;
+using UnrealSharp.Utils.Misc;
+
+namespace UnrealSharpTool.Core.Utils;
+
+/// <summary>
+/// Class BindingExportManifestEntry.
+/// </summary>
+internal class BindingExportManifestEntry
+{
+    /// <summary>
+    /// Gets or sets the fingerprint of the exported type.
+    /// </summary>
+    /// <value>The fingerprint.</value>
+    public string Fingerprint { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the file length.
+    /// </summary>
+    /// <value>The length.</value>
+    public long Length { get; set; }
+
+    /// <summary>
+    /// Gets or sets the last write time in UTC ticks.
+    /// </summary>
+    /// <value>The last write time.</value>
+    public long LastWriteTime { get; set; }
+}
+
+/// <summary>
+/// Class BindingExportManifest.
+/// Records the fingerprint of every exported file, so unchanged types can be skipped,
+/// and expired files can be found without walking the export directory.
+/// </summary>
+internal class BindingExportManifest
+{
+    /// <summary>
+    /// Gets or sets the generator version.
+    /// </summary>
+    /// <value>The generator version.</value>
+    public string GeneratorVersion { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the files, key is the path relative to the export root directory.
+    /// </summary>
+    /// <value>The files.</value>
+    public Dictionary<string, BindingExportManifestEntry> Files { get; set; } = new(StringComparer.OrdinalIgnoreCase);
+
+    /// <summary>
+    /// Gets the export root directory.
+    /// </summary>
+    /// <value>The export root directory.</value>
+    [JsonIgnore]
+    public string ExportRootDirectory { get; private set; } = string.Empty;
+
+    /// <summary>
+    /// Gets a value indicating whether this manifest is loaded from a file written by the same generator.
+    /// If it is not valid, expired files must be found by walking the export directory.
+    /// </summary>
+    /// <value><c>true</c> if this instance is valid; otherwise, <c>false</c>.</value>
+    [JsonIgnore]
+    public bool IsValid { get; private set; }
+
+    /// <summary>
+    /// Loads the manifest, an empty manifest is returned if the file is missing, broken or written by another generator.
+    /// </summary>
+    /// <param name="manifestPath">The manifest path.</param>
+    /// <param name="exportRootDirectory">The export root directory.</param>
+    /// <returns>BindingExportManifest.</returns>
+    public static BindingExportManifest Load(string manifestPath, string exportRootDirectory)
+    {
+        BindingExportManifest? manifest = null;
+
+        if (manifestPath.IsFileExists())
+        {
+            try
+            {
+                manifest = JsonConvert.DeserializeObject<BindingExportManifest>(File.ReadAllText(manifestPath));
+            }
+            catch (Exception e)
+            {
+                Logger.LogWarning("Failed load binding export manifest {0}: {1}", manifestPath, e.Message);
+            }
+        }
+
+        if (manifest == null || manifest.GeneratorVersion != CoreVersion.GeneratorVersion)
+        {
+            manifest = new BindingExportManifest
+            {
+                GeneratorVersion = CoreVersion.GeneratorVersion
+            };
+        }
+        else
+        {
+            manifest.IsValid = true;
+        }
+
+        manifest.ExportRootDirectory = exportRootDirectory;
+
+        return manifest;
+    }
+
+    /// <summary>
+    /// Saves the manifest.
+    /// </summary>
+    /// <param name="manifestPath">The manifest path.</param>
+    public void Save(string manifestPath)
+    {
+        var directory = manifestPath.GetDirectoryPath();
+
+        if (!directory.IsDirectoryExists())
+        {
+            Directory.CreateDirectory(directory);
+        }
+
+        File.WriteAllText(manifestPath, JsonConvert.SerializeObject(this, Formatting.Indented));
+    }
+
+    /// <summary>
+    /// Determines whether the file is exported from the same fingerprint and is not modified after that.
+    /// </summary>
+    /// <param name="path">The path.</param>
+    /// <param name="fingerprint">The fingerprint.</param>
+    /// <returns><c>true</c> if the file is up to date; otherwise, <c>false</c>.</returns>
+    public bool IsUpToDate(string path, string fingerprint)
+    {
+        if (!Files.TryGetValue(GetKey(path), out var entry) || entry.Fingerprint != fingerprint)
+        {
+            return false;
+        }
+
+        var fileInfo = new FileInfo(path);
+
+        return fileInfo.Exists && fileInfo.Length == entry.Length && fileInfo.LastWriteTimeUtc.Ticks == entry.LastWriteTime;
+    }
+
+    /// <summary>
+    /// Records the exported file.
+    /// </summary>
+    /// <param name="path">The path.</param>
+    /// <param name="fingerprint">The fingerprint.</param>
+    public void Record(string path, string fingerprint)
+    {
+        var fileInfo = new FileInfo(path);
+
+        Files[GetKey(path)] = new BindingExportManifestEntry
+        {
+            Fingerprint = fingerprint,
+            Length = fileInfo.Length,
+            LastWriteTime = fileInfo.LastWriteTimeUtc.Ticks
+        };
+    }
+
+    /// <summary>
+    /// Removes the file.
+    /// </summary>
+    /// <param name="path">The path.</param>
+    public void Remove(string path)
+    {
+        Files.Remove(GetKey(path));
+    }
+
+    /// <summary>
+    /// Gets full paths of all recorded files.
+    /// </summary>
+    /// <returns>IEnumerable&lt;System.String&gt;.</returns>
+    public IEnumerable<string> GetFiles()
+    {
+        return Files.Keys.Select(x => Path.GetFullPath(Path.Combine(ExportRootDirectory, x)));
+    }
+
+    /// <summary>
+    /// Gets the key.
+    /// </summary>
+    /// <param name="path">The path.</param>
+    /// <returns>System.String.</returns>
+    private string GetKey(string path)
+    {
+        return Path.GetRelativePath(ExportRootDirectory, path).Replace('\\', '/');
+    }
+}
@@ -3,4 +3,9 @@
 public static class CoreVersion
 {
     public static readonly Version Version = new(1, 1, 0, 0);
+
+    /// <summary>
+    /// The generator version, any rebuild of the generator changes it, so outputs of an old generator are never reused.
+    /// </summary>
+    public static readonly string GeneratorVersion = $"{Version}-{typeof(CoreVersion).Assembly.ManifestModule.ModuleVersionId}";
 }
\ No newline at end of file
@@ -38,6 +38,12 @@ internal class ScopedExporter : IDisposable
     /// </summary>
     public Action<string>? OnDeleteFileDelegate;
 
+    /// <summary>
+    /// The manifest of the last export.
+    /// If it is valid, expired files are found from it instead of walking the export directory.
+    /// </summary>
+    public BindingExportManifest? Manifest;
+
     /// <summary>
     /// Initializes a new instance of the <see cref="ScopedExporter"/> class.
     /// </summary>
@@ -75,7 +81,11 @@ internal class ScopedExporter : IDisposable
     /// </summary>
     public void Dispose()
     {
-        if (ExportRootDirectory.IsDirectoryExists())
+        if (Manifest is { IsValid: true })
+        {
+            DeleteExpiredManifestFiles(Manifest);
+        }
+        else if (ExportRootDirectory.IsDirectoryExists())
         {
             foreach (var file in Directory.EnumerateFiles(ExportRootDirectory, "*.*", SearchOption.AllDirectories))
             {
@@ -104,6 +114,48 @@ internal class ScopedExporter : IDisposable
         }
     }
 
+    private void DeleteExpiredManifestFiles(BindingExportManifest manifest)
+    {
+        foreach (var file in manifest.GetFiles().ToList())
+        {
+            var p = file.CanonicalPath().ToLower();
+
+            if (ExportedFiles.Contains(p))
+            {
+                continue;
+            }
+
+            manifest.Remove(file);
+
+            if (!File.Exists(file) || (ReserveFilterFunc != null && ReserveFilterFunc(p)))
+            {
+                continue;
+            }
+
+            OnDeleteFileDelegate?.Invoke(file);
+
+            File.Delete(file);
+            Logger.LogWarning($"  Delete Expired File: {file}");
+
+            DeleteEmptyParentDirectories(file);
+        }
+    }
+
+    private void DeleteEmptyParentDirectories(string file)
+    {
+        var rootDirectory = ExportRootDirectory.CanonicalPath();
+        var directory = Path.GetDirectoryName(file);
+
+        while (directory != null &&
+               directory.CanonicalPath().Length > rootDirectory.Length &&
+               Directory.Exists(directory) &&
+               !Directory.EnumerateFileSystemEntries(directory).Any())
+        {
+            Directory.Delete(directory);
+            directory = Path.GetDirectoryName(directory);
+        }
+    }
+
     private static void DeleteEmptyDirectories(string rootDirectory)
     {
         foreach (var directory in Directory.GetDirectories(rootDirectory))
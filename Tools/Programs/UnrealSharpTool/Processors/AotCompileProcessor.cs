@@ -0,0 +1,321 @@
+﻿using System.Diagnostics;
+using System.Diagnostics.CodeAnalysis;
+using System.Reflection;
+using System.Text.RegularExpressions;
+using UnrealSharp.Utils.CommandLine;
+using UnrealSharp.Utils.Extensions;
+using UnrealSharp.Utils.Extensions.IO;
+using UnrealSharp.Utils.Misc;
+using UnrealSharpTool.Core.Utils;
+// ReSharper disable PropertyCanBeMadeInitOnly.Global
+
+namespace UnrealSharpTool.Processors;
+
+/// <summary>
+/// Class AotCompileProcessor.
+/// Compile managed assemblies into mono AOT images with mono-aot-cross,
+/// the runtime loads them from the AOT directory when MonoAotMode is enabled in UnrealSharp settings.
+/// </summary>
+[Export("UnrealSharpTools", typeof(IBaseWorkModeProcessor))]
+[DynamicallyAccessedMembers(DynamicallyAccessedMemberTypes.All)]
+internal class AotCompileProcessor : AbstractBaseWorkModeProcessor<AotCompileOptions>
+{
+    /// <summary>
+    /// Initializes a new instance of the <see cref="AotCompileProcessor" /> class.
+    /// </summary>
+    public AotCompileProcessor() :
+        base("aot")
+    {
+    }
+
+    /// <summary>
+    /// Checks the options.
+    /// </summary>
+    /// <param name="value">The value.</param>
+    /// <returns><c>true</c> success, <c>false</c> otherwise.</returns>
+    protected override bool CheckOptions(AotCompileOptions value)
+    {
+        if (!value.CompilerPath.IsFileExists())
+        {
+            Logger.LogError($"mono aot compiler <{value.CompilerPath}> is not exists. add argument by -c or --compiler");
+            return false;
+        }
+
+        if (!value.InputDirectory.IsDirectoryExists())
+        {
+            Logger.LogError($"input directory <{value.InputDirectory}> is not exists. add argument by -i or --input");
+            return false;
+        }
+
+        foreach (var reference in value.ReferenceDirectories.Where(reference => !reference.IsDirectoryExists()))
+        {
+            Logger.LogError($"reference directory <{reference}> is not exists.");
+            return false;
+        }
+
+        if (value.FullAot && value.ReferenceDirectories.Count == 0)
+        {
+            Logger.LogError("full AOT requires images of framework assemblies, add system managed library directory by -r or --references");
+            return false;
+        }
+
+        if (!value.TargetPlatform.IsNullOrEmpty() && GetImageExtension(value.TargetPlatform) == null)
+        {
+            Logger.LogError($"unknown target platform <{value.TargetPlatform}>, it must be windows, linux, android, mac or ios.");
+            return false;
+        }
+
+        return base.CheckOptions(value);
+    }
+
+    /// <summary>
+    /// Processes the specified value.
+    /// </summary>
+    /// <param name="value">The value.</param>
+    /// <returns>System.Int32.</returns>
+    [RequiresDynamicCode("Invoke Process")]
+    protected override int Process(AotCompileOptions value)
+    {
+        var outputDirectory = value.OutputDirectory.IsNullOrEmpty() ? Path.Combine(value.InputDirectory, "AOT") : value.OutputDirectory;
+
+        if (!outputDirectory.IsDirectoryExists())
+        {
+            Directory.CreateDirectory(outputDirectory);
+        }
+
+        var filter = new Regex(value.AssemblyFilter, RegexOptions.IgnoreCase);
+        var assemblies = Directory.GetFiles(value.InputDirectory, "*.dll").Where(x => filter.IsMatch(x.GetFileName())).ToList();
+
+        // mono can't execute any method without an AOT image in full mode, include System.Private.CoreLib
+        if (value.FullAot)
+        {
+            assemblies.AddRange(value.ReferenceDirectories.SelectMany(x => Directory.GetFiles(x, "*.dll")).Where(IsManagedAssembly));
+        }
+
+        var imageExtension = GetImageExtension(GetTargetPlatform(value))!;
+
+        Logger.Log("Start Compile {0} Assemblies To Mono AOT Images, Full AOT: {1}", assemblies.Count, value.FullAot);
+        Logger.Log("Output Directory:{0}, Image Extension:{1}", outputDirectory.CanonicalPath(), imageExtension);
+
+        using var profiler = new ScopedProfiler("Mono AOT Compile");
+
+        // mono resolve references of the assembly being compiled from MONO_PATH
+        var monoPath = string.Join(Path.PathSeparator, new[] { value.InputDirectory }.Concat(value.ReferenceDirectories));
+
+        int compiledCount = 0, skippedCount = 0, failedCount = 0;
+
+        foreach (var assembly in assemblies)
+        {
+            // same name rule as mono runtime, eg: UnrealSharp.UnrealEngine.dll.so
+            var imagePath = Path.Combine(outputDirectory, assembly.GetFileName() + imageExtension);
+
+            if (!value.Force && File.Exists(imagePath) && File.GetLastWriteTimeUtc(imagePath) >= File.GetLastWriteTimeUtc(assembly))
+            {
+                ++skippedCount;
+                continue;
+            }
+
+            if (Compile(value, assembly, imagePath, monoPath))
+            {
+                Logger.Log("  {0} -> {1}", assembly.GetFileName(), imagePath.GetFileName());
+                ++compiledCount;
+            }
+            else
+            {
+                Logger.LogError("Failed compile mono AOT image for {0}", assembly);
+                ++failedCount;
+            }
+        }
+
+        Logger.Log("Mono AOT Images: {0} compiled, {1} up to date, {2} failed.", compiledCount, skippedCount, failedCount);
+
+        return failedCount > 0 ? -1 : 0;
+    }
+
+    [RequiresDynamicCode("Invoke Process")]
+    private static bool Compile(AotCompileOptions options, string assemblyPath, string imagePath, string monoPath)
+    {
+        var aotArguments = new List<string> { $"outfile={imagePath}" };
+
+        if (options.FullAot)
+        {
+            aotArguments.Add("full");
+        }
+
+        if (!options.ExtraAotArguments.IsNullOrEmpty())
+        {
+            aotArguments.Add(options.ExtraAotArguments);
+        }
+
+        var startInfo = new ProcessStartInfo(options.CompilerPath)
+        {
+            UseShellExecute = false,
+            RedirectStandardOutput = true,
+            RedirectStandardError = true,
+            WorkingDirectory = options.InputDirectory
+        };
+
+        startInfo.ArgumentList.Add($"--aot={string.Join(',', aotArguments)}");
+        startInfo.ArgumentList.Add(assemblyPath);
+        startInfo.Environment["MONO_PATH"] = monoPath;
+
+        using var process = System.Diagnostics.Process.Start(startInfo);
+
+        if (process == null)
+        {
+            return false;
+        }
+
+        process.OutputDataReceived += (_, e) => { if (e.Data != null && options.Verbose) { Logger.Log("{0}", e.Data); } };
+        process.ErrorDataReceived += (_, e) => { if (e.Data != null) { Logger.LogWarning("{0}", e.Data); } };
+        process.BeginOutputReadLine();
+        process.BeginErrorReadLine();
+        process.WaitForExit();
+
+        return process.ExitCode == 0 && File.Exists(imagePath);
+    }
+
+    private static bool IsManagedAssembly(string path)
+    {
+        try
+        {
+            AssemblyName.GetAssemblyName(path);
+            return true;
+        }
+        catch (BadImageFormatException)
+        {
+            // native libraries
+            return false;
+        }
+    }
+
+    private static string GetTargetPlatform(AotCompileOptions options)
+    {
+        if (!options.TargetPlatform.IsNullOrEmpty())
+        {
+            return options.TargetPlatform;
+        }
+
+        // eg: mtriple=x86_64-linux-gnu
+        var match = Regex.Match(options.ExtraAotArguments, @"mtriple=([^,]+)", RegexOptions.IgnoreCase);
+
+        if (match.Success)
+        {
+            var triple = match.Groups[1].Value.ToLowerInvariant();
+
+            if (triple.Contains("windows") || triple.Contains("mingw") || triple.Contains("win32"))
+            {
+                return "windows";
+            }
+
+            if (triple.Contains("ios"))
+            {
+                return "ios";
+            }
+
+            if (triple.Contains("apple") || triple.Contains("darwin") || triple.Contains("macos"))
+            {
+                return "mac";
+            }
+
+            return triple.Contains("android") ? "android" : "linux";
+        }
+
+        if (OperatingSystem.IsWindows())
+        {
+            return "windows";
+        }
+
+        return OperatingSystem.IsMacOS() ? "mac" : "linux";
+    }
+
+    // mono probes an AOT image by assembly file name + module extension of the target platform
+    private static string? GetImageExtension(string targetPlatform)
+    {
+        return targetPlatform.ToLowerInvariant() switch
+        {
+            "windows" or "win64" => ".dll",
+            "mac" or "ios" => ".dylib",
+            "linux" or "android" => ".so",
+            _ => null
+        };
+    }
+}
+
+#region Options
+/// <summary>
+/// Class AotCompileOptions.
+/// </summary>
+internal class AotCompileOptions
+{
+    /// <summary>
+    /// Gets or sets the compiler path.
+    /// </summary>
+    /// <value>The compiler path.</value>
+    [Option('c', "compiler", Required = true, HelpText = "mono-aot-cross path, it must match the target platform and mono runtime version.")]
+    public string CompilerPath { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the input directory.
+    /// </summary>
+    /// <value>The input directory.</value>
+    [Option('i', "input", Required = true, HelpText = "C# output directory, eg: $(ProjectDir)Managed/$(Configuration)")]
+    public string InputDirectory { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the output directory.
+    /// </summary>
+    /// <value>The output directory.</value>
+    [Option('o', "output", HelpText = "AOT image directory, default is AOT directory in input directory.")]
+    public string OutputDirectory { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the reference directories.
+    /// </summary>
+    /// <value>The reference directories.</value>
+    [Option('r', "references", HelpText = "extra directories to resolve references, eg: system managed library directory of UnrealSharp plugin.")]
+    public List<string> ReferenceDirectories { get; set; } = [];
+
+    /// <summary>
+    /// Gets or sets the assembly filter.
+    /// </summary>
+    /// <value>The assembly filter.</value>
+    [Option('f', "filter", HelpText = "regex used to select assemblies by file name.")]
+    public string AssemblyFilter { get; set; } = @"^UnrealSharp\..+\.dll$";
+
+    /// <summary>
+    /// Gets or sets a value indicating whether to use full AOT.
+    /// </summary>
+    /// <value><c>true</c> if full AOT; otherwise, <c>false</c>.</value>
+    [Option("full", HelpText = "generate full AOT images, required by MonoAotMode Full. framework assemblies in reference directories are compiled too.")]
+    public bool FullAot { get; set; }
+
+    /// <summary>
+    /// Gets or sets the target platform.
+    /// </summary>
+    /// <value>The target platform.</value>
+    [Option('t', "target", HelpText = "target platform of AOT images: windows, linux, android, mac or ios, default is parsed from mtriple of extra arguments, or the host platform.")]
+    public string TargetPlatform { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the extra AOT arguments.
+    /// </summary>
+    /// <value>The extra AOT arguments.</value>
+    [Option('x', "extra", HelpText = "extra --aot arguments, eg: mtriple=x86_64-linux-gnu,tool-prefix=x86_64-linux-gnu-")]
+    public string ExtraAotArguments { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets a value indicating whether to compile up to date assemblies.
+    /// </summary>
+    /// <value><c>true</c> if force; otherwise, <c>false</c>.</value>
+    [Option("force", HelpText = "compile all assemblies even if the AOT image is up to date.")]
+    public bool Force { get; set; }
+
+    /// <summary>
+    /// Gets or sets a value indicating whether to print compiler output.
+    /// </summary>
+    /// <value><c>true</c> if verbose; otherwise, <c>false</c>.</value>
+    [Option('v', "verbose", HelpText = "print output of mono aot compiler.")]
+    public bool Verbose { get; set; }
+}
+#endregion
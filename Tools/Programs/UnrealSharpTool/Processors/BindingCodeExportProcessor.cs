@@ -148,7 +148,10 @@ internal class BindingCodeExportProcessor : AbstractBaseWorkModeProcessor<Bindin
             }
         }
 
-        var exporter = new CSharpBindingExporter(context);
+        var exporter = new CSharpBindingExporter(context)
+        {
+            ForceExport = options.Force
+        };
 
         if (!exporter.Export())
         {
@@ -221,5 +224,12 @@ internal class BindingCodeExportOptions
     /// <value>The schema.</value>
     [Option('s', "schema", HelpText = "Schema: NativeBinding/BlueprintBinding/CSharpBinding")]
     public EBindingSchemaType Schema { get; set; } = EBindingSchemaType.CSharpBinding;
+
+    /// <summary>
+    /// Gets or sets a value indicating whether to export all types.
+    /// </summary>
+    /// <value><c>true</c> if force; otherwise, <c>false</c>.</value>
+    [Option("force", HelpText = "ignore the export manifest, export all C# binding codes and find expired files by walking the export directory.")]
+    public bool Force { get; set; }
 }
 #endregion
\ No newline at end of file
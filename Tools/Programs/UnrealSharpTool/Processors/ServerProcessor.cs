@@ -0,0 +1,344 @@
+﻿using System.Diagnostics.CodeAnalysis;
+using System.IO.Pipes;
+using System.Security.Cryptography;
+using System.Text;
+using Newtonsoft.Json;
+using UnrealSharp.Utils.CommandLine;
+using UnrealSharp.Utils.Extensions;
+using UnrealSharp.Utils.Extensions.IO;
+using UnrealSharp.Utils.Misc;
+using UnrealSharpTool.Core.Utils;
+// ReSharper disable PropertyCanBeMadeInitOnly.Global
+
+namespace UnrealSharpTool.Processors;
+
+/// <summary>
+/// Class ServerProcessor.
+/// Keep UnrealSharpTool alive and execute requests from a local pipe,
+/// so the parsed sources, metadata references and compilations are reused between type database generations.
+/// Clients send requests by adding --useServer to a normal command line.
+/// </summary>
+[Export("UnrealSharpTools", typeof(IBaseWorkModeProcessor))]
+[DynamicallyAccessedMembers(DynamicallyAccessedMemberTypes.All)]
+internal class ServerProcessor : AbstractBaseWorkModeProcessor<ServerOptions>
+{
+    /// <summary>
+    /// Initializes a new instance of the <see cref="ServerProcessor" /> class.
+    /// </summary>
+    public ServerProcessor() :
+        base("server")
+    {
+    }
+
+    /// <summary>
+    /// Checks the options.
+    /// </summary>
+    /// <param name="value">The value.</param>
+    /// <returns><c>true</c> success, <c>false</c> otherwise.</returns>
+    protected override bool CheckOptions(ServerOptions value)
+    {
+        if (!value.UnrealProjectDirectory.IsDirectoryExists())
+        {
+            Logger.LogError("server need your unreal project directory. add argument by -p or --project");
+            return false;
+        }
+
+        return base.CheckOptions(value);
+    }
+
+    /// <summary>
+    /// Processes the specified value.
+    /// </summary>
+    /// <param name="value">The value.</param>
+    /// <returns>System.Int32.</returns>
+    [RequiresDynamicCode("Invoke Process")]
+    protected override int Process(ServerOptions value)
+    {
+        var pipeName = ServerClient.GetPipeName(value.UnrealProjectDirectory);
+
+        Logger.Log("Start UnrealSharpTool server on pipe {0}, exit after {1} minutes without request.", pipeName, value.IdleTimeout);
+
+        while (true)
+        {
+            using var server = new NamedPipeServerStream(pipeName, PipeDirection.InOut, 1, PipeTransmissionMode.Byte, PipeOptions.Asynchronous);
+            using var cancellation = new CancellationTokenSource(TimeSpan.FromMinutes(value.IdleTimeout));
+
+            try
+            {
+                server.WaitForConnectionAsync(cancellation.Token).GetAwaiter().GetResult();
+            }
+            catch (OperationCanceledException)
+            {
+                Logger.Log("No request in {0} minutes, server exit.", value.IdleTimeout);
+                return 0;
+            }
+
+            try
+            {
+                HandleRequest(server);
+            }
+            catch (IOException e)
+            {
+                Logger.LogWarning("Client disconnected: {0}", e.Message);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Handles one request, logs are sent to client while the request is executing.
+    /// </summary>
+    /// <param name="stream">The stream.</param>
+    [RequiresDynamicCode("Invoke Process")]
+    private static void HandleRequest(Stream stream)
+    {
+        using var reader = new StreamReader(stream, Encoding.UTF8, false, 4096, true);
+        using var writer = new StreamWriter(stream, new UTF8Encoding(false), 4096, true);
+        writer.AutoFlush = true;
+
+        var request = JsonConvert.DeserializeObject<ServerRequest>(reader.ReadLine() ?? "{}") ?? new ServerRequest();
+        var args = request.Arguments;
+
+        Logger.Log("Request: {0}", string.Join(' ', args));
+
+        void SendLog(LoggerLevel level, string? tag, string message)
+        {
+            lock (writer)
+            {
+                try
+                {
+                    writer.WriteLine(JsonConvert.SerializeObject(new ServerMessage { Level = level, Tag = tag, Message = message }));
+                }
+                catch (IOException)
+                {
+                    // client is gone, keep working
+                }
+            }
+        }
+
+        int exitCode;
+
+        Logger.OnSystemLogEvent += SendLog;
+
+        try
+        {
+            // relative paths in arguments are relative to the client
+            if (request.WorkingDirectory.IsDirectoryExists())
+            {
+                Environment.CurrentDirectory = request.WorkingDirectory;
+            }
+
+            exitCode = Execute(args);
+        }
+        catch (Exception e)
+        {
+            Logger.LogError($"{e.Message}\n{e.StackTrace}");
+            exitCode = 5;
+        }
+        finally
+        {
+            Logger.OnSystemLogEvent -= SendLog;
+        }
+
+        writer.WriteLine(JsonConvert.SerializeObject(new ServerMessage { ExitCode = exitCode }));
+    }
+
+    /// <summary>
+    /// Executes the work mode of the request.
+    /// </summary>
+    /// <param name="args">The arguments.</param>
+    /// <returns>System.Int32.</returns>
+    [RequiresDynamicCode("Invoke Process")]
+    private static int Execute(string[] args)
+    {
+        var result = Parser.Default.Parse<UnrealSharpToolBaseOptions>(args);
+        var mode = result.Value?.Mode;
+
+        if (mode.IsNullOrEmpty() || mode.iEquals("server"))
+        {
+            Logger.LogError("Invalid work mode of server request: {0}", mode ?? "");
+            return 7;
+        }
+
+        // create new processors for each request, they are not designed to be reused
+        var provider = new WorkModeProvider();
+        ExtensibilityFramework.ComposeParts(provider, provider);
+
+        var processor = provider.Processors.Find(x => x.Mode.iEquals(mode));
+
+        if (processor == null)
+        {
+            Logger.LogError($"No work mode:{mode}");
+            return 3;
+        }
+
+        return processor.Main(args);
+    }
+}
+
+/// <summary>
+/// Class ServerRequest.
+/// The first line sent by client.
+/// </summary>
+internal class ServerRequest
+{
+    /// <summary>
+    /// Gets or sets the working directory of client.
+    /// </summary>
+    /// <value>The working directory.</value>
+    public string WorkingDirectory { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the command line arguments.
+    /// </summary>
+    /// <value>The arguments.</value>
+    public string[] Arguments { get; set; } = [];
+}
+
+/// <summary>
+/// Class ServerMessage.
+/// One line of json in the pipe, it is a log message or the exit code of the request.
+/// </summary>
+internal class ServerMessage
+{
+    /// <summary>
+    /// Gets or sets the level.
+    /// </summary>
+    /// <value>The level.</value>
+    public LoggerLevel Level { get; set; }
+
+    /// <summary>
+    /// Gets or sets the tag.
+    /// </summary>
+    /// <value>The tag.</value>
+    public string? Tag { get; set; }
+
+    /// <summary>
+    /// Gets or sets the message.
+    /// </summary>
+    /// <value>The message.</value>
+    public string? Message { get; set; }
+
+    /// <summary>
+    /// Gets or sets the exit code, it is the last message of a request.
+    /// </summary>
+    /// <value>The exit code.</value>
+    public int? ExitCode { get; set; }
+}
+
+/// <summary>
+/// Class ServerClient.
+/// Forward a command line to the server of the same unreal project.
+/// </summary>
+internal static class ServerClient
+{
+    /// <summary>
+    /// The use server argument
+    /// </summary>
+    public const string UseServerArgument = "--useServer";
+
+    /// <summary>
+    /// The connect timeout in milliseconds
+    /// </summary>
+    private const int ConnectTimeout = 500;
+
+    /// <summary>
+    /// Gets the name of the pipe of a project.
+    /// </summary>
+    /// <param name="unrealProjectDirectory">The unreal project directory.</param>
+    /// <returns>System.String.</returns>
+    public static string GetPipeName(string unrealProjectDirectory)
+    {
+        var hash = SHA256.HashData(Encoding.UTF8.GetBytes(Path.GetFullPath(unrealProjectDirectory).CanonicalPath().ToLower()));
+
+        return $"UnrealSharpTool.{Convert.ToHexString(hash)[..16]}";
+    }
+
+    /// <summary>
+    /// Try to run the command line on server.
+    /// </summary>
+    /// <param name="args">The arguments.</param>
+    /// <param name="exitCode">The exit code.</param>
+    /// <returns><c>true</c> if the request is executed by server, <c>false</c> if it should be executed locally.</returns>
+    [RequiresDynamicCode("Parse Options")]
+    public static bool TryRun(string[] args, out int exitCode)
+    {
+        exitCode = 0;
+
+        if (!args.Contains(UseServerArgument))
+        {
+            return false;
+        }
+
+        var options = Parser.Default.Parse<ServerOptions>(args).Value;
+
+        if (options == null || !options.UnrealProjectDirectory.IsDirectoryExists())
+        {
+            Logger.LogWarning("Server needs unreal project directory(-p), run locally.");
+            return false;
+        }
+
+        var pipeName = GetPipeName(options.UnrealProjectDirectory);
+
+        try
+        {
+            using var client = new NamedPipeClientStream(".", pipeName, PipeDirection.InOut);
+            client.Connect(ConnectTimeout);
+
+            using var reader = new StreamReader(client, Encoding.UTF8);
+            using var writer = new StreamWriter(client, new UTF8Encoding(false));
+            writer.AutoFlush = true;
+
+            writer.WriteLine(JsonConvert.SerializeObject(new ServerRequest
+            {
+                WorkingDirectory = Environment.CurrentDirectory,
+                Arguments = args.Where(x => x != UseServerArgument).ToArray()
+            }));
+
+            while (reader.ReadLine() is { } line)
+            {
+                var message = JsonConvert.DeserializeObject<ServerMessage>(line);
+
+                if (message?.ExitCode != null)
+                {
+                    exitCode = message.ExitCode.Value;
+                    return true;
+                }
+
+                if (message?.Message != null)
+                {
+                    Logger.Log(message.Level, message.Tag, message.Message);
+                }
+            }
+
+            Logger.LogWarning("Server {0} closed the connection before finished, run locally.", pipeName);
+        }
+        catch (Exception e) when (e is TimeoutException or IOException)
+        {
+            Logger.Log("Server {0} is not available, run locally.", pipeName);
+        }
+
+        return false;
+    }
+}
+
+#region Options
+/// <summary>
+/// Class ServerOptions.
+/// </summary>
+internal class ServerOptions
+{
+    /// <summary>
+    /// Gets or sets the project directory.
+    /// </summary>
+    /// <value>The project directory.</value>
+    [Option('p', "project", Required = true, HelpText = "unreal project directory, one server serves one project.")]
+    public string UnrealProjectDirectory { get; set; } = string.Empty;
+
+    /// <summary>
+    /// Gets or sets the idle timeout.
+    /// </summary>
+    /// <value>The idle timeout in minutes.</value>
+    [Option("idleTimeout", HelpText = "exit server after this minutes without request.")]
+    public int IdleTimeout { get; set; } = 30;
+}
+#endregion
@@ -86,6 +86,11 @@ internal class TypeDatabaseGenerateProcessor : AbstractBaseWorkModeProcessor<Typ
 
         document.SaveToFile(value.OutputPath!);
 
+        if (value.ExportJson)
+        {
+            document.SaveToFile(value.OutputPath! + ".json");
+        }
+
         Logger.Log("Success.");
 
         return 0;
@@ -124,4 +129,11 @@ internal class TypeDatabaseGenerationOptions
     /// <value>The output path.</value>
     [Option('o', "output", Required = true, HelpText = "output path")]
     public string? OutputPath { get; set; }
+
+    /// <summary>
+    /// Gets or sets a value indicating whether to export a json copy.
+    /// </summary>
+    /// <value><c>true</c> if export json; otherwise, <c>false</c>.</value>
+    [Option("json", Required = false, HelpText = "also save a json copy of the binary type database beside the output file for debugging.")]
+    public bool ExportJson { get; set; }
 }
\ No newline at end of file
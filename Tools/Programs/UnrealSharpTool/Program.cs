@@ -3,6 +3,7 @@ using UnrealSharp.Utils.CommandLine;
 using UnrealSharp.Utils.Extensions;
 using UnrealSharp.Utils.Misc;
 using UnrealSharpTool.Core.Utils;
+using UnrealSharpTool.Processors;
 
 namespace UnrealSharpTool;
 
@@ -19,6 +20,12 @@ internal class Program
     [RequiresDynamicCode("Calls UnrealSharpTool.Core.Utils.ExtensibilityFramework.ComposeParts<T>(T, Object, params Object[])")]
     private static int Main(string[] args)
     {
+        // forward to the server if there is one
+        if (ServerClient.TryRun(args, out var serverExitCode))
+        {
+            return serverExitCode;
+        }
+
         var result = Parser.Default.Parse<UnrealSharpToolBaseOptions>(args);
 
         if(result.Value == null)